@@ -4,7 +4,7 @@
  *  - some functions using fixed notation to (optimized)
  *
  *  author: Haroldo Amaral - agaelema@gmail.com
- *  v0.4.3 - 2017/10/09
+ *  v0.5 - 2026/10/16
  ******************************************************************************
  *  log:
  *    v0.1      . Initial version
@@ -30,57 +30,245 @@
  *              - remove old remain functions
  *    v0.4.2    . fix "sineWaveGen_GetSample()" function - phase error
  *    v0.4.3    . organized defines
+ *    v0.5      + add block versions of iir high pass filters (array in/out)
+ *              + add multi-channel (SoA) banks of iir low pass filters - SSE/AVX lanes
+ *              + add Goertzel bank - K bins in a single pass over the array
+ *              + add sliding DFT (Goertzel sliding) - bin updated every sample
+ *              + add sine wave oscillator (rotating phasor) - no sinf per sample
+ *              + add DDS (NCO) sine generator - 32 bit phase and Q31 table
+ *              + add rms int16 array with 64 bit accumulation (SIMD pmaddwd)
+ *              + add rms sliding window (ring buffer, O(1) update)
+ *              + add power metering - Vrms, Irms, P, S, PF and energy in one pass
+ *              + add isqrt32, isqrt64 and isqrt32_Q16 (clz + table + Newton)
+ *              . sqrt_Int32 and rms int16 optimized versions use the new sqrt
+ *              + add cascaded biquad filters (TDF-II) float and Q31 - single and banks
+ *              + add DSP_and_Math.hpp - C++17 templates (compile time shift/coefficients)
+ *              + add inline build (DSP_MATH_INLINE) - per-sample functions in DSP_and_Math_inline.h
+ *              + add host benchmark (Examples/Linux) - ns/sample, cycles/sample, MS/s and JSON
+ *              + add runtime dispatch (CPUID) - scalar/SSE2/SSE4.1/AVX2/AVX-512 array kernels
+ *              + add radix-2/4 FFT (complex and real input) - plans with twiddle/bit reversal tables
+ *              + add Q15/Q31 FFT (radix-2, block floating point) - constant twiddle tables, int16 input
+ *              + add harmonic analyzer - magnitude/phase of K harmonics, THD-F, THD-R (Goertzel bank or FFT)
+ *              + add block pipeline - chain of stages (filters, rms, Goertzel) in place, block by block
+ *              + add block version of iir low pass filter float
+ *              + add SPSC ring buffer (lock free) - int16, int32 and float, batch push/pop with contiguous spans
+ *              + add worker pool and channel engine (DSP_and_Math_threads.c) - pinned workers, work stealing, per block barrier
+ *              + add segmented Goertzel - independent segments (SIMD lanes, threads) joined by rotation of their partial DFTs (double)
+ *              + add scan version of iir single pole low/high pass float (first order scan) - 16 samples lookahead (SIMD), segments on threads
+ *              + add decimation - CIC (integer only) and polyphase FIR Q15 (SIMD) stages, int16 input
+ *              + add FIR filter float (direct form SIMD, overlap-save FFT for long filters - short blocks in direct form), Q15 and Q31 (SIMD)
  ******************************************************************************/
 
+#define     _DSP_AND_MATH_C_
+
 #include    "DSP_and_Math.h"
+#include    "DSP_and_Math_inline.h"      // per-sample functions (extern, or static inline if DSP_MATH_INLINE)
 #include    "math.h"
 
+/* x86 SIMD intrinsics - all levels with runtime dispatch, otherwise only when enabled by the compiler flags */
+#if defined(DSP_MATH_DISPATCH) || defined(__SSE__) || defined(__SSE2__) || defined(__AVX__) || defined(__AVX2__)
+#include    <immintrin.h>
+#endif
+#include    <string.h>
+#if defined(DSP_MATH_DISPATCH)
+#include    <cpuid.h>
+#include    <stdlib.h>
+#endif
+
+
+/******************************************************************************
+ *  SIMD kernels (internal)
+ *  - array/block functions defined in "DSP_and_Math_simd.h", one table per
+ *    instruction set (see RUNTIME DISPATCH at the end of this file)
+ *  - public functions keep the same names and call the selected table
+ ******************************************************************************/
+struct power_sums_;
+
+struct dsp_simd_kernels_
+{
+    uint_fast8_t level;
+    uint64_t (*rmsSumSquaresArray_Int16)(const int16_t *, size_t, int16_t);
+    void (*powerMeterSums_Int16)(const int16_t *, const int16_t *, const int16_t *, size_t, struct power_sums_ *);
+    void (*ddsGen_Array_Float)(dds_parameters *, float *, size_t);
+    void (*ddsGen_Array_Q15)(dds_parameters *, int16_t *, size_t);
+    void (*ddsGen_Array_Q31)(dds_parameters *, int32_t *, size_t);
+    void (*iir_SinglePoleLowPass_Float_Bank_Block)(iirLowPassFloatBank_t *, const float *, float *, size_t);
+    void (*iir_SinglePoleLowPass_Fixed_Bank_Block)(iirLowPassFixedBank_t *, const int32_t *, int32_t *, size_t);
+    void (*iir_SinglePoleLowPass_Fixed_Fast_Bank_Block)(iirLowPassFixedFastBank_t *, const int32_t *, int32_t *, size_t);
+    void (*iir_Biquad_Float_Bank_Block)(iirBiquadFloatBank_t *, const float *, float *, size_t);
+    void (*iir_Biquad_Fixed_Bank_Block)(iirBiquadFixedBank_t *, const int32_t *, int32_t *, size_t);
+    void (*goertzelBankFloat_Float)(goertzel_bank_float_t *, const float *);
+    void (*goertzelBankInt16_Float)(goertzel_bank_float_t *, const int16_t *);
+    void (*fftComplex_Float)(const fft_plan_float_t *, float *);
+    float (*iir_FirstOrderScan_Float)(const float *, const float *, float *, size_t, float, float);
+    void (*firDecimator_Q15)(const int16_t *, size_t, const int16_t *, size_t, size_t, int16_t *);
+    void (*firFilter_Float)(const float *, size_t, const float *, size_t, float *);
+    void (*firFilter_Q15)(const int16_t *, size_t, const int16_t *, size_t, int16_t *);
+    void (*firFilter_Q31)(const int32_t *, size_t, const int32_t *, size_t, int32_t *);
+};
+
+static const struct dsp_simd_kernels_ * dspSimd_kernels = NULL;        // selected table
+
+static inline const struct dsp_simd_kernels_ * dspSimd_Kernels(void)
+{
+    if (dspSimd_kernels == NULL)
+    {
+        dspSimd_Init();
+    }
+    return dspSimd_kernels;
+}
+
 /******************************************************************************
  *                          MATH FUNCTIONS
  ******************************************************************************/
 
+/******************************************************************************
+ *  Count leading zeros of a 32 bit number (internal)
+ *  - use the compiler builtin when available (single instruction in most cores)
+ ******************************************************************************/
+static inline uint_fast8_t clz_Uint32(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (x == 0) ? 32 : (uint_fast8_t)__builtin_clz(x);
+#else
+    uint_fast8_t n = 0;
+    if (x == 0) return 32;
+    if (x <= 0x0000FFFFUL) { n += 16; x <<= 16; }
+    if (x <= 0x00FFFFFFUL) { n += 8; x <<= 8; }
+    if (x <= 0x0FFFFFFFUL) { n += 4; x <<= 4; }
+    if (x <= 0x3FFFFFFFUL) { n += 2; x <<= 2; }
+    if (x <= 0x7FFFFFFFUL) { n += 1; }
+    return n;
+#endif
+}
+
+
+/******************************************************************************
+ *  Initial estimate of square root (internal)
+ *  - sqrt((i + 0.5)/64) * 2^16 for the 6 MSB (i = 16..63) of a normalized number
+ ******************************************************************************/
+static const uint16_t isqrtTable[48] =
+{
+    33276, 34270, 35235, 36175, 37091, 37985, 38858, 39712,
+    40548, 41368, 42171, 42959, 43733, 44494, 45242, 45977,
+    46702, 47415, 48117, 48809, 49492, 50166, 50830, 51486,
+    52134, 52773, 53405, 54030, 54647, 55258, 55862, 56459,
+    57051, 57636, 58215, 58789, 59357, 59919, 60477, 61029,
+    61576, 62119, 62657, 63190, 63719, 64243, 64763, 65279,
+};
+
+
+/******************************************************************************
+ *  Calculate the Square root of a 32 bit unsigned number
+ *  - normalize with count leading zeros (even shift), table estimate of 6 bits
+ *    and 2 Newton steps, then correct to the exact floor(sqrt(x))
+ *
+ *  - INPUT:    uint32_t x          (32 bit unsigned input number)
+ *
+ *  - RETURN:   root                (integer square root of x - floor)
+ ******************************************************************************/
+uint32_t isqrt32(uint32_t x)
+{
+    uint_fast8_t shift;
+    uint32_t x_norm;
+    uint32_t root;
+
+    if (x == 0)
+    {
+        return 0;
+    }
+
+    shift = clz_Uint32(x) & ~1u;                    // even shift - sqrt(x * 4^k) = sqrt(x) * 2^k
+    x_norm = x << shift;                            // 2 MSB not zero: [2^30, 2^32)
+
+    root = isqrtTable[(x_norm >> 26) - 16];         // estimate in [2^15, 2^16)
+    root = (root + (x_norm / root)) >> 1;           // Newton steps (6 -> 12 -> 24 bits)
+    root = (root + (x_norm / root)) >> 1;
+    if (root > 0xFFFFUL)
+    {
+        root = 0xFFFFUL;
+    }
+    while ((root * root) > x_norm)                  // correct to floor
+    {
+        root--;
+    }
+
+    return root >> (shift >> 1);
+}
+
+
+/******************************************************************************
+ *  Calculate the Square root of a 64 bit unsigned number
+ *  - same approach of "isqrt32()" with 3 Newton steps
+ *
+ *  - INPUT:    uint64_t x          (64 bit unsigned input number)
+ *
+ *  - RETURN:   root                (integer square root of x - floor)
+ ******************************************************************************/
+uint32_t isqrt64(uint64_t x)
+{
+    uint_fast8_t shift;
+    uint64_t x_norm;
+    uint64_t root;
+
+    if ((x >> 32) == 0)
+    {
+        return isqrt32((uint32_t)x);
+    }
+
+    shift = clz_Uint32((uint32_t)(x >> 32)) & ~1u;  // even shift
+    x_norm = x << shift;                            // 2 MSB not zero: [2^62, 2^64)
+
+    root = (uint64_t)isqrtTable[(x_norm >> 58) - 16] << 16;     // estimate in [2^31, 2^32)
+    root = (root + (x_norm / root)) >> 1;           // Newton steps (6 -> 12 -> 24 -> 48 bits)
+    root = (root + (x_norm / root)) >> 1;
+    root = (root + (x_norm / root)) >> 1;
+    if (root > 0xFFFFFFFFULL)
+    {
+        root = 0xFFFFFFFFULL;
+    }
+    while ((root * root) > x_norm)                  // correct to floor
+    {
+        root--;
+    }
+
+    return (uint32_t)(root >> (shift >> 1));
+}
+
+
+/******************************************************************************
+ *  Calculate the Square root of a 32 bit unsigned number in fixed point Q16.16
+ *  - result normalized to 32 bits: floor(sqrt(x) * 2^16) = isqrt64(x * 2^32)
+ *  - useful to keep the fractional part of small values (e.g. RMS)
+ *
+ *  - INPUT:    uint32_t x          (32 bit unsigned input number)
+ *
+ *  - RETURN:   root                (square root of x in Q16.16)
+ ******************************************************************************/
+uint32_t isqrt32_Q16(uint32_t x)
+{
+    return isqrt64((uint64_t)x << 32);
+}
+
+
 /******************************************************************************
  *  Calculate the Square root of a 32 bit signed number
  *  - will return "-1" if the number is negative
+ *  - use "isqrt32()" (count leading zeros + Newton)
  *
  *  - INPUT:    int32_t x           (32 bit signed input number)
  *
  *  - RETURN:   root                (integer square root of x)
- *
- * Reference: http://www.codecodex.com/wiki/Calculate_an_integer_square_root
  ******************************************************************************/
 int32_t sqrt_Int32(int32_t x)
 {
-    register uint32_t root, remainder, place;
-
     /* verify if number is negative */
     if (x < 0)
     {
         return (-1);        // return "-1" - error
     }
-    /* verify if number is zero */
-    if (x == 0)
-    {
-        return (0);
-    }
-
-    root = 0;
-    remainder = x;
-    place = 0x40000000;         // to 32 bit input
 
-    while (place > remainder)
-        place = place >> 2;
-    while (place)
-    {
-        if (remainder >= root + place)
-        {
-            remainder = remainder - root - place;
-            root = root + (place << 1);
-        }
-        root = root >> 1;
-        place = place >> 2;
-    }
-    return root;
+    return (int32_t)isqrt32((uint32_t)x);
 }
 
 
@@ -142,28 +330,11 @@ float rmsValueArray_Float_StdMath(const float * arrayIn, uint_fast16_t size, flo
  ******************************************************************************/
 float rmsValueArray_Int16_StdMath(const int16_t * arrayIn, uint_fast16_t size, int16_t dcLevel)
 {
-    uint_fast16_t counter;
-    int32_t sample_temp;
-    uint32_t acc = 0;
-
-    /* check if there is a dc leve (different of zero) */
-    if (dcLevel)
-    {
-        for (counter = 0; counter < size; counter++)
-            {
-            sample_temp = (int32_t)(arrayIn[counter] - dcLevel);        // subtraction of dc level before square
-            acc = acc + (uint32_t)(sample_temp * sample_temp);          // square and accumulate
-            }
-    }
-    /* if dc level is zero, the subtraction can be removed */
-    else
-    {
-        for (counter = 0; counter < size; counter++)
-            {
-                sample_temp = (int32_t)arrayIn[counter];                // save the sample
-                acc = acc + (uint32_t)(sample_temp * sample_temp);      // square and accumulate
-            }
-    }
+    /*
+     * square and accumulate (dc level removed) - 32 bit accumulator, the low
+     * 32 bits of the exact 64 bit sum (SIMD kernel selected at runtime)
+     */
+    uint32_t acc = (uint32_t)rmsSumSquaresArray_Int16(arrayIn, size, dcLevel);
 
     /*
      * calculate the average and then extract square root - RMS value
@@ -179,54 +350,11 @@ float rmsValueArray_Int16_StdMath(const int16_t * arrayIn, uint_fast16_t size, i
 #elif   defined(RMS_ARRAY_OPTIMIZED)
     /************************************************************
      * version using integer square root function
+     * - Q16.16 result keeps the fractional part of small values
      ************************************************************/
     uint32_t result;
     result = acc/size;
-
-    /************************************************************
-     * To reach better accuracy, shift the result when possible
-     * - transform in a fixed point math
-     ************************************************************/
-    if (result & (3UL << 30))   // verify if bit 30 and 31 is true
-    {
-        result = sqrt_Int32(result);    // if yes, do the sqrt
-        return (float)(result);
-    }
-    else if (result & (3UL << 28))  // verify bits 28 and 29
-    {
-        result = sqrt_Int32((result) << 1); // rotate 1x to left == multiply by 2
-        return (float)(result/1.414213f);   // divide the result by sqrt of 2
-    }
-    else if (result & (15UL << 24)) // verify bits between 24 and 27
-    {
-        result = sqrt_Int32((result) << 3); // rotate 3x to left == multiply by 2
-        return (float)(result/2.828427f);   // divide the result by sqrt of 8
-    }
-    else if (result & (15UL << 20))
-    {
-        result = sqrt_Int32((result) << 7);
-        return (float)(result/11.313708f);
-    }
-    else if (result & (15UL << 16))
-    {
-        result = sqrt_Int32((result) << 11);
-        return (float)(result/45.254834f);
-    }
-    else if (result & (15UL << 12))
-    {
-        result = sqrt_Int32((result) << 15);
-        return (float)(result/181.019336f);
-    }
-    else if (result & (15UL << 8))
-    {
-        result = sqrt_Int32((result) << 19);
-        return (float)(result/724.077343f);
-    }
-    else
-    {
-        result = sqrt_Int32((result) << 23);
-        return (float)(result/2896.309376f);
-    }
+    return (float)isqrt32_Q16(result) * (1.0f / 65536.0f);
 
 #else
 #error      "RMS Array Int16 - invalid option, select one define!"
@@ -234,49 +362,49 @@ float rmsValueArray_Int16_StdMath(const int16_t * arrayIn, uint_fast16_t size, i
 }
 
 
-
-
 /******************************************************************************
- *  Add sample to accumulator - Allow to calculate RMS value sample by sample
- *  - square input values and accumulate
- *  - Finalizing calculations in a separate function
+ *  Sum of squares of N samples of a int16_t array - 64 bit accumulation
+ *  - sum((x - dcLevel)^2) = sum(x^2) - 2*dcLevel*sum(x) + N*dcLevel^2 (exact)
+ *  - SSE2/AVX2/AVX-512BW multiply-add (pmaddwd) selected at runtime,
+ *    partial sums are widened to 64 bits before overflow
  *
- *  - INPUT:    rms_float_t * inputStruct       (pointer to struct with RMS parameters)
- *              const float * sampleFloat       (pointer to float sample)
+ *  - INPUT:    const int16_t * arrayIn (pointer to array with the samples)
+ *              size_t size             (number of samples)
+ *              int16_t dcLevel         (previously calculated dc level)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   sum of squares (uint64_t) - exact while result < 2^64
  ******************************************************************************/
-void rmsValueAddSample_Float(rms_float_t * inputStruct, float sample)
+uint64_t rmsSumSquaresArray_Int16(const int16_t * arrayIn, size_t size, int16_t dcLevel)
 {
-    /* square value and accumulate */
-    inputStruct->acc += (sample * sample);
-    /* increment counter - used in final step */
-    inputStruct->size_counter++;
+    return dspSimd_Kernels()->rmsSumSquaresArray_Int16(arrayIn, size, dcLevel);
 }
 
 
 /******************************************************************************
- *  Add sample to accumulator - Allow to calculate RMS value sample by sample
- *  - square input values and accumulate
- *  - Finalizing calculations in a separate function
+ *  Calculate the RMS value of N sample of a int16_t array - 64 bit accumulation
+ *  - no limit of array size (size_t) and no accumulator overflow
+ *  - use SIMD when available (see "rmsSumSquaresArray_Int16()")
  *
- *  - INPUT:    rms_int16_t * inputStruct       (pointer to struct with RMS parameters)
- *              const float * sampleFloat       (pointer to float sample)
+ *  - INPUT:    const int16_t * arrayIn (pointer to array with the samples)
+ *              size_t size             (number of samples)
+ *              int16_t dcLevel         (previously calculated dc level)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   calculated RMS value (float)
  ******************************************************************************/
-void rmsValueAddSample_Int16(rms_int16_t * inputStruct, int16_t sample)
+float rmsValueArray_Int16_Acc64(const int16_t * arrayIn, size_t size, int16_t dcLevel)
 {
-    int32_t sample_temp;
-    sample_temp = (int32_t)sample;                 // save the sample
+    if (size == 0)
+    {
+        return 0;
+    }
 
-    /* square value and accumulate */
-    inputStruct->acc = inputStruct->acc + (uint32_t)(sample_temp * sample_temp);             // square and accumulate
-    /* increment counter - used in final step */
-    inputStruct->size_counter++;
+    uint64_t acc = rmsSumSquaresArray_Int16(arrayIn, size, dcLevel);
+    return sqrtf((float)((double)acc / (double)size));
 }
 
 
+
+
 /******************************************************************************
  *  Clear RMS Float Struct - reset all parameters (variables)
  *  - enable to clear some rms calculation without do the math
@@ -355,52 +483,247 @@ void rmsValueCalcRmsStdMath_Int16(rms_int16_t * inputStruct)
 #elif   defined(RMS_SAMPLE_OPTIMIZED)
     uint32_t result;
     result = inputStruct->acc/inputStruct->size_counter;
+    inputStruct->rmsValue = (float)isqrt32_Q16(result) * (1.0f / 65536.0f);
+
+#else
+#error      "RMS Sample by Sample Int16 - invalid option, select one define!"
+#endif
+
+}
+
+
+
+
+/******************************************************************************
+ *  RMS sliding window - Float Version - Initialize struct
+ *  - RMS of the last N samples, updated in O(1) for each new sample
+ *  - the last N samples are stored in a ring buffer provided by the user
+ *  - the running sum is replaced by an exact sum every N samples (no drift)
+ *
+ *  - INPUT:    rms_sliding_float_t * inputStruct   (pointer to struct with RMS parameters)
+ *              float * buffer                      (ring buffer - array with "size" elements)
+ *              uint_fast16_t size                  (window size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void rmsSlidingInit_Float(rms_sliding_float_t * inputStruct, float * buffer, uint_fast16_t size)
+{
+    uint_fast16_t counter;
+
+    inputStruct->size = size;
+    inputStruct->size_counter = 0;
+    inputStruct->index = 0;
+    inputStruct->buffer = buffer;
+    inputStruct->acc = 0;
+    inputStruct->acc_window = 0;
+    inputStruct->rmsValue = 0;
 
-    if (result & (3UL << 30))
+    for (counter = 0; counter < size; counter++)
     {
-        result = sqrt_Int32(result);
-        inputStruct->rmsValue = result;
+        buffer[counter] = 0;
     }
-    else if (result & (3UL << 28))
+}
+
+
+/******************************************************************************
+ *  RMS sliding window - Float Version - Calculate RMS value
+ *  - can be called after any sample - the state is not changed
+ *
+ *  - INPUT:    rms_sliding_float_t * inputStruct   (pointer to struct with RMS parameters)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void rmsSlidingCalcRms_Float(rms_sliding_float_t * inputStruct)
+{
+    float acc = inputStruct->acc;
+
+    if ((acc <= 0) || (inputStruct->size_counter == 0))
     {
-        result = sqrt_Int32((result) << 1);
-        inputStruct->rmsValue = (float)(result/1.414213f);
+        inputStruct->rmsValue = 0;                  // rounding can give small negative values
+        return;
     }
-    else if (result & (15UL << 24))
+    inputStruct->rmsValue = sqrtf(acc / inputStruct->size_counter);
+}
+
+
+/******************************************************************************
+ *  RMS sliding window - Int16 Version - Initialize struct
+ *  - RMS of the last N samples, updated in O(1) for each new sample
+ *  - the last N samples are stored in a ring buffer provided by the user
+ *  - exact integer running sum (64 bits) - no drift
+ *
+ *  - INPUT:    rms_sliding_int16_t * inputStruct   (pointer to struct with RMS parameters)
+ *              int16_t * buffer                    (ring buffer - array with "size" elements)
+ *              uint_fast16_t size                  (window size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void rmsSlidingInit_Int16(rms_sliding_int16_t * inputStruct, int16_t * buffer, uint_fast16_t size)
+{
+    uint_fast16_t counter;
+
+    inputStruct->size = size;
+    inputStruct->size_counter = 0;
+    inputStruct->index = 0;
+    inputStruct->buffer = buffer;
+    inputStruct->acc = 0;
+    inputStruct->rmsValue = 0;
+
+    for (counter = 0; counter < size; counter++)
     {
-        result = sqrt_Int32((result) << 3);
-        inputStruct->rmsValue = (float)(result/2.828427f);
+        buffer[counter] = 0;
     }
-    else if (result & (15UL << 20))
+}
+
+
+/******************************************************************************
+ *  RMS sliding window - Int16 Version - Calculate RMS value
+ *  - can be called after any sample - the state is not changed
+ *
+ *  - INPUT:    rms_sliding_int16_t * inputStruct   (pointer to struct with RMS parameters)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void rmsSlidingCalcRms_Int16(rms_sliding_int16_t * inputStruct)
+{
+    if (inputStruct->size_counter == 0)
     {
-        result = sqrt_Int32((result) << 7);
-        inputStruct->rmsValue = (float)(result/11.313708f);
+        inputStruct->rmsValue = 0;
+        return;
     }
-    else if (result & (15UL << 16))
+    inputStruct->rmsValue = sqrtf((float)inputStruct->acc / inputStruct->size_counter);
+}
+
+
+
+
+/******************************************************************************
+ *  Power metering - sums of one block (internal)
+ *  - sum(v^2), sum(i^2), sum(v*i), sum(v), sum(i) in a single read of the input
+ *  - same multiply-add (pmaddwd) approach of "rmsSumSquaresArray_Int16()"
+ *    ("powerMeterSums_Int16()" in "DSP_and_Math_simd.h")
+ *  - arrayVI != NULL: interleaved input (v0, i0, v1, i1, ...)
+ ******************************************************************************/
+struct power_sums_
+{
+    uint64_t vv;
+    uint64_t ii;
+    int64_t vi;
+    int64_t v;
+    int64_t i;
+};
+
+/******************************************************************************
+ *  Power metering - finalize one block (internal)
+ *  - remove dc levels (exact), calculate results and accumulate energy
+ ******************************************************************************/
+static void powerMeterFinalize_Int16(power_meter_int16_t * meterStruct, struct power_sums_ * sums, size_t size)
+{
+    int64_t dcV = meterStruct->dcLevel_V;
+    int64_t dcI = meterStruct->dcLevel_I;
+
+    /* sum((v - dcV)^2) = sum(v^2) - 2*dcV*sum(v) + N*dcV^2 - modular math (exact) */
+    uint64_t vv = sums->vv - (uint64_t)(2 * dcV * sums->v) + ((uint64_t)size * (uint64_t)(dcV * dcV));
+    uint64_t ii = sums->ii - (uint64_t)(2 * dcI * sums->i) + ((uint64_t)size * (uint64_t)(dcI * dcI));
+    /* sum((v - dcV)*(i - dcI)) = sum(v*i) - dcI*sum(v) - dcV*sum(i) + N*dcV*dcI */
+    int64_t vi = sums->vi - (dcI * sums->v) - (dcV * sums->i) + ((int64_t)size * dcV * dcI);
+
+    meterStruct->Vrms = sqrtf((float)((double)vv / (double)size));
+    meterStruct->Irms = sqrtf((float)((double)ii / (double)size));
+    meterStruct->activePower = (float)((double)vi / (double)size);
+    meterStruct->apparentPower = meterStruct->Vrms * meterStruct->Irms;
+
+    if (meterStruct->apparentPower > 0)
     {
-        result = sqrt_Int32((result) << 11);
-        inputStruct->rmsValue = (float)(result/45.254834f);
+        meterStruct->powerFactor = meterStruct->activePower / meterStruct->apparentPower;
     }
-    else if (result & (15UL << 12))
+    else
     {
-        result = sqrt_Int32((result) << 15);
-        inputStruct->rmsValue = (float)(result/181.019336f);
+        meterStruct->powerFactor = 0;
     }
-    else if (result & (15UL << 8))
+
+    meterStruct->energy_acc += vi;
+    meterStruct->samples_acc += size;
+}
+
+
+/******************************************************************************
+ *  Power metering - Initialize struct
+ *  - values in ADC units: power in (V units * I units), energy in
+ *    (V units * I units * samples) - scale by the user
+ *
+ *  - INPUT:    power_meter_int16_t * meterStruct   (pointer to struct with meter parameters)
+ *              int16_t dcLevel_V                   (previously calculated dc level of voltage)
+ *              int16_t dcLevel_I                   (previously calculated dc level of current)
+ *              uint_fast8_t doClean                (clean accumulated energy)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void powerMeterInit_Int16(power_meter_int16_t * meterStruct, int16_t dcLevel_V, int16_t dcLevel_I, uint_fast8_t doClean)
+{
+    meterStruct->dcLevel_V = dcLevel_V;
+    meterStruct->dcLevel_I = dcLevel_I;
+
+    if (doClean)
     {
-        result = sqrt_Int32((result) << 19);
-        inputStruct->rmsValue = (float)(result/724.077343f);
+        meterStruct->Vrms = 0;
+        meterStruct->Irms = 0;
+        meterStruct->activePower = 0;
+        meterStruct->apparentPower = 0;
+        meterStruct->powerFactor = 0;
+        meterStruct->energy_acc = 0;
+        meterStruct->samples_acc = 0;
     }
-    else
+}
+
+
+/******************************************************************************
+ *  Power metering - Calculate block (separate voltage and current arrays)
+ *  - Vrms, Irms, active power, apparent power and power factor in one pass
+ *  - active energy accumulated in 64 bits (sum of v*i of all blocks)
+ *
+ *  - INPUT:    power_meter_int16_t * meterStruct   (pointer to struct with meter parameters)
+ *              const int16_t * arrayV              (pointer to array with voltage samples)
+ *              const int16_t * arrayI              (pointer to array with current samples)
+ *              size_t size                         (number of samples of each array)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void powerMeterCalc_Int16(power_meter_int16_t * meterStruct, const int16_t * arrayV, const int16_t * arrayI, size_t size)
+{
+    struct power_sums_ sums;
+
+    if (size == 0)
     {
-        result = sqrt_Int32((result) << 23);
-        inputStruct->rmsValue = (float)(result/2896.309376f);
+        return;
     }
 
-#else
-#error      "RMS Sample by Sample Int16 - invalid option, select one define!"
-#endif
+    dspSimd_Kernels()->powerMeterSums_Int16(arrayV, arrayI, NULL, size, &sums);
+    powerMeterFinalize_Int16(meterStruct, &sums, size);
+}
+
+
+/******************************************************************************
+ *  Power metering - Calculate block (interleaved voltage and current)
+ *  - same of "powerMeterCalc_Int16()" with input array (v0, i0, v1, i1, ...)
+ *
+ *  - INPUT:    power_meter_int16_t * meterStruct   (pointer to struct with meter parameters)
+ *              const int16_t * arrayVI             (pointer to array with interleaved samples)
+ *              size_t size                         (number of pairs - array has 2*size elements)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void powerMeterCalcInterleaved_Int16(power_meter_int16_t * meterStruct, const int16_t * arrayVI, size_t size)
+{
+    struct power_sums_ sums;
+
+    if (size == 0)
+    {
+        return;
+    }
 
+    dspSimd_Kernels()->powerMeterSums_Int16(NULL, NULL, arrayVI, size, &sums);
+    powerMeterFinalize_Int16(meterStruct, &sums, size);
 }
 
 
@@ -496,798 +819,4946 @@ float sineWaveGen_GetSample(sine_wave_parameters *inputParameters)
 }
 
 
-
-
 /******************************************************************************
- *                          DSP FUNCTIONS
+ *  Sine wave generator - Oscillator - Renormalize the phasor (internal)
+ *  - one Newton step to keep (cos^2 + sin^2) = 1, removing the rounding drift
  ******************************************************************************/
+static inline void sineWaveGenOsc_Renormalize(float * cos_value, float * sin_value)
+{
+    float gain = 1.5f - 0.5f * ((*cos_value * *cos_value) + (*sin_value * *sin_value));
+    *cos_value *= gain;
+    *sin_value *= gain;
+}
+
 
 /******************************************************************************
- *  IIR Single Pole High Pass - Float Version - Initialization
+ *  Sine wave generator - Oscillator - array version
+ *  - same wave of "sineWaveGen_Array_Float()" without "sinf" per sample
+ *  - rotating phasor: 4 phasors (n, n+1, n+2, n+3) rotated by 4 increments,
+ *    generating 4 samples per iteration
+ *  - phasors renormalized every SINE_OSC_RENORM_PERIOD samples
  *
- * - INPUT:     iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
- *              float cutoffFreq                    (pole value)
- *              uint_fast8_t doClean                (clean variables after change the pole)
+ *  - INPUT:    float * outputArray         (array to store samples)
+ *              float freq                  (frequency of signal)
+ *              float phase_rad             (phase displacement in rad)
+ *              float amplitude             (amplitude of wave - peak value)
+ *              float V_offset              (offset value)
+ *              uint_fast16_t points        (points peer cycle)
+ *              uint_fast8_t doClean        (clean the array before gen)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   N/A
  ******************************************************************************/
-void iir_SinglePoleHighPass_Float_Init(iirHighPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean)
+void sineWaveGenOsc_Array_Float(float * outputArray, float freq, float phase_rad,
+                                float amplitude, float V_offset, uint_fast16_t points, uint_fast8_t doClean)
 {
-    structInput->cutoff_Freq = (1.0f - cutoffFreq);
+    uint_fast16_t counter;
+    uint_fast16_t lane;
+    float increment = (TWO_PI * freq)/points;           // samples interval in rad
+    float cos_step = cosf(4 * increment);               // rotation of 4 samples
+    float sin_step = sinf(4 * increment);
+    float cos_value[4];
+    float sin_value[4];
 
+    /* clean array before calculate new samples */
     if (doClean)
     {
-        structInput->prev_x = 0;
-        structInput->prev_y = 0;
-        structInput->y = 0;
+        for (counter = 0; counter < points; counter++)
+        {
+            outputArray[counter] = 0;                   // reset all array
+        }
+    }
+
+    for (lane = 0; lane < 4; lane++)
+    {
+        cos_value[lane] = cosf(phase_rad + lane * increment);
+        sin_value[lane] = sinf(phase_rad + lane * increment);
+    }
+
+    for (counter = 0; counter + 4 <= points; counter += 4)
+    {
+        for (lane = 0; lane < 4; lane++)
+        {
+            float cos_temp = cos_value[lane];
+            outputArray[counter + lane] += (amplitude * sin_value[lane]) + V_offset;
+            cos_value[lane] = (cos_temp * cos_step) - (sin_value[lane] * sin_step);
+            sin_value[lane] = (sin_value[lane] * cos_step) + (cos_temp * sin_step);
+        }
+
+        if (((counter + 4) % SINE_OSC_RENORM_PERIOD) == 0)
+        {
+            for (lane = 0; lane < 4; lane++)
+            {
+                sineWaveGenOsc_Renormalize(&cos_value[lane], &sin_value[lane]);
+            }
+        }
+    }
+
+    /* remaining samples */
+    for (lane = 0; counter < points; counter++, lane++)
+    {
+        outputArray[counter] += (amplitude * sin_value[lane]) + V_offset;
     }
 }
 
 
 /******************************************************************************
- *  IIR Single Pole High Pass - Float Version
- *  - use float math
- *  - more efficient with FPU
- *
- * - INPUT:     iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
- *              float xValueFloat                   (input/sample value)
+ *  Sine wave generator - Oscillator - Initialize struct parameters
+ *  - sample-by-sample version - same parameters of "sineWaveGen_bySample_Init()"
+ *  - if not clean, keep the current phasor (phase continuous frequency change)
+ *    and apply only the difference of phase
  *
- * - RETURN:    N/A (result returned inside the struct)
+ *  - INPUT:    sine_wave_oscillator *inputParameters   (struct with parameters)
+ *              float freq                          (frequency of signal)
+ *              float phase_rad                     (phase displacement in rad)
+ *              float amplitude                     (amplitude of wave - peak value)
+ *              float V_offset                      (offset value)
+ *              uint_fast16_t points                (points peer cycle)
+ *              uint_fast8_t doClean                (reset wave to initial phase)
  *
- * Reference: https://www.dsprelated.com/freebooks/filters/DC_Blocker.html
+ *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void iir_SinglePoleHighPass_Float(iirHighPassFloat_t * structInput, float xValueFloat)
+void sineWaveGenOsc_bySample_Init(sine_wave_oscillator *inputParameters, float freq, float phase, float amp, float v_off, uint_fast16_t points, uint_fast8_t doClean)
 {
-    /********************************
-     * y = x - xm1 + (0.995 * ym1);
-     * xm1 = x;
-     * ym1 = y;
-     ********************************/
-    structInput->y = xValueFloat - structInput->prev_x + (structInput->cutoff_Freq * structInput->prev_y);
-    structInput->prev_x = xValueFloat;
-    structInput->prev_y = structInput->y;
-}
+    float increment = (TWO_PI * freq)/points;           // samples interval in rad
 
+    inputParameters->freq = freq;
+    inputParameters->amplitude = amp;
+    inputParameters->V_offset = v_off;
+    inputParameters->points = points;
+    inputParameters->cos_step = cosf(increment);
+    inputParameters->sin_step = sinf(increment);
 
+    if (doClean)
+    {
+        inputParameters->cos_value = cosf(phase);
+        inputParameters->sin_value = sinf(phase);
+        inputParameters->counter = 0;
+    }
+    else
+    {
+        /* rotate the current phasor by the phase difference */
+        float delta = phase - inputParameters->phase_rad;
+        float cos_delta = cosf(delta);
+        float sin_delta = sinf(delta);
+        float cos_temp = inputParameters->cos_value;
+        inputParameters->cos_value = (cos_temp * cos_delta) - (inputParameters->sin_value * sin_delta);
+        inputParameters->sin_value = (inputParameters->sin_value * cos_delta) + (cos_temp * sin_delta);
+    }
+    inputParameters->phase_rad = phase;
+}
 
 
 /******************************************************************************
- *  IIR Single Pole High Pass - Fixed Version Initialization
+ *  Sine wave generator - Oscillator - Calculate the current sample
+ *  - rotate the phasor by one increment (4 multiplications, no "sinf")
  *
- *  - INPUT:    iirHighPassFixed_t * structInput    (pointer to struct with filter parameters)
- *              float cutoffFreq                    (pole value)
- *              uint_fast8_t shift                  (shift of fixed math - from 8 to 15)
- *              uint_fast8_t doClean                (clean variables after change the pole)
+ *  - INPUT:    sine_wave_oscillator *inputParameters   (struct with parameters)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   (float)WaveSample                   (current sample)
  ******************************************************************************/
-void iir_SinglePoleHighPass_Fixed_Init(iirHighPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+float sineWaveGenOsc_GetSample(sine_wave_oscillator *inputParameters)
 {
-    uint_fast8_t shift_temp = shift;
+    float cos_temp = inputParameters->cos_value;
+    float sin_temp = inputParameters->sin_value;
 
-    /*
-     * prevent shift bigger than 15 (filter stop to work)
-     */
-    if (shift_temp > 15)
-    {
-        structInput->shift_size = 15;
-    }
-    else if(shift_temp < 8)
-    {
-        structInput->shift_size = 8;
-    }
-    else
+    /* calculate the sample */
+    float WaveSample = inputParameters->amplitude * sin_temp + inputParameters->V_offset;
+
+    /* rotate the phasor */
+    inputParameters->cos_value = (cos_temp * inputParameters->cos_step) - (sin_temp * inputParameters->sin_step);
+    inputParameters->sin_value = (sin_temp * inputParameters->cos_step) + (cos_temp * inputParameters->sin_step);
+
+    if (++inputParameters->counter >= SINE_OSC_RENORM_PERIOD)
     {
-        structInput->shift_size = shift_temp;
+        sineWaveGenOsc_Renormalize(&inputParameters->cos_value, &inputParameters->sin_value);
+        inputParameters->counter = 0;
     }
+    return WaveSample;
+}
 
-    structInput->cutoff_Freq = cutoffFreq;
-    structInput->A_param = (int32_t)((1u << structInput->shift_size) * (structInput->cutoff_Freq));
+
+
+/******************************************************************************
+ *  DDS - sine table in Q31 (256 points of one cycle + 2 points to interpolation)
+ *  - generated off-line: round(sin(2*pi*i/256) * (2^31 - 1))
+ ******************************************************************************/
+#define     DDS_TABLE_BITS      8
+#define     DDS_FRAC_BITS       (32 - DDS_TABLE_BITS)
+
+static const int32_t ddsSineTable_Q31[(1 << DDS_TABLE_BITS) + 2] =
+{
+              0,    52701887,   105372028,   157978697,   210490206,   262874923,
+      315101294,   367137860,   418953276,   470516330,   521795963,   572761285,
+      623381597,   673626408,   723465451,   772868706,   821806413,   870249095,
+      918167571,   965532978,  1012316784,  1058490807,  1104027236,  1148898640,
+     1193077990,  1236538675,  1279254515,  1321199780,  1362349204,  1402677999,
+     1442161874,  1480777044,  1518500249,  1555308767,  1591180425,  1626093615,
+     1660027308,  1692961061,  1724875039,  1755750016,  1785567395,  1814309215,
+     1841958164,  1868497585,  1893911493,  1918184580,  1941302224,  1963250500,
+     1984016188,  2003586778,  2021950483,  2039096240,  2055013722,  2069693341,
+     2083126253,  2095304369,  2106220351,  2115867625,  2124240379,  2131333571,
+     2137142926,  2141664947,  2144896909,  2146836865,  2147483647,  2146836865,
+     2144896909,  2141664947,  2137142926,  2131333571,  2124240379,  2115867625,
+     2106220351,  2095304369,  2083126253,  2069693341,  2055013722,  2039096240,
+     2021950483,  2003586778,  1984016188,  1963250500,  1941302224,  1918184580,
+     1893911493,  1868497585,  1841958164,  1814309215,  1785567395,  1755750016,
+     1724875039,  1692961061,  1660027308,  1626093615,  1591180425,  1555308767,
+     1518500249,  1480777044,  1442161874,  1402677999,  1362349204,  1321199780,
+     1279254515,  1236538675,  1193077990,  1148898640,  1104027236,  1058490807,
+     1012316784,   965532978,   918167571,   870249095,   821806413,   772868706,
+      723465451,   673626408,   623381597,   572761285,   521795963,   470516330,
+      418953276,   367137860,   315101294,   262874923,   210490206,   157978697,
+      105372028,    52701887,           0,   -52701887,  -105372028,  -157978697,
+     -210490206,  -262874923,  -315101294,  -367137860,  -418953276,  -470516330,
+     -521795963,  -572761285,  -623381597,  -673626408,  -723465451,  -772868706,
+     -821806413,  -870249095,  -918167571,  -965532978, -1012316784, -1058490807,
+    -1104027236, -1148898640, -1193077990, -1236538675, -1279254515, -1321199780,
+    -1362349204, -1402677999, -1442161874, -1480777044, -1518500249, -1555308767,
+    -1591180425, -1626093615, -1660027308, -1692961061, -1724875039, -1755750016,
+    -1785567395, -1814309215, -1841958164, -1868497585, -1893911493, -1918184580,
+    -1941302224, -1963250500, -1984016188, -2003586778, -2021950483, -2039096240,
+    -2055013722, -2069693341, -2083126253, -2095304369, -2106220351, -2115867625,
+    -2124240379, -2131333571, -2137142926, -2141664947, -2144896909, -2146836865,
+    -2147483647, -2146836865, -2144896909, -2141664947, -2137142926, -2131333571,
+    -2124240379, -2115867625, -2106220351, -2095304369, -2083126253, -2069693341,
+    -2055013722, -2039096240, -2021950483, -2003586778, -1984016188, -1963250500,
+    -1941302224, -1918184580, -1893911493, -1868497585, -1841958164, -1814309215,
+    -1785567395, -1755750016, -1724875039, -1692961061, -1660027308, -1626093615,
+    -1591180425, -1555308767, -1518500249, -1480777044, -1442161874, -1402677999,
+    -1362349204, -1321199780, -1279254515, -1236538675, -1193077990, -1148898640,
+    -1104027236, -1058490807, -1012316784,  -965532978,  -918167571,  -870249095,
+     -821806413,  -772868706,  -723465451,  -673626408,  -623381597,  -572761285,
+     -521795963,  -470516330,  -418953276,  -367137860,  -315101294,  -262874923,
+     -210490206,  -157978697,  -105372028,   -52701887,           0,    52701887
+};
+
+
+/******************************************************************************
+ *  DDS (NCO) sine wave generator - Initialize struct parameters
+ *  - 32 bit phase accumulator wrapping at 2*pi - never lose precision
+ *  - same frequency convention of "sineWaveGen_bySample_Init()"
+ *  - float/double math only in the initialization
+ *
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
+ *              float freq                          (frequency of signal)
+ *              float phase_rad                     (phase displacement in rad)
+ *              float amplitude                     (amplitude of wave - float output only)
+ *              float V_offset                      (offset value - float output only)
+ *              uint_fast16_t points                (points peer cycle)
+ *              uint_fast8_t interpolation          (DDS_INTERP_LINEAR or DDS_INTERP_QUADRATIC)
+ *              uint_fast8_t doClean                (reset the phase accumulator)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void ddsGen_Init(dds_parameters *inputParameters, float freq, float phase, float amp, float v_off,
+                 uint_fast16_t points, uint_fast8_t interpolation, uint_fast8_t doClean)
+{
+    inputParameters->amplitude = amp;
+    inputParameters->V_offset = v_off;
+    inputParameters->interpolation = interpolation;
+
+    ddsGen_SetFrequency(inputParameters, freq, points);
 
     if (doClean)
     {
-        structInput->acc = 0;
-        structInput->prev_x = 0;
-        structInput->y = 0;
-        structInput->prev_y = 0;
+        /* phase in rad to 32 bit phase word (2*pi == 2^32) */
+        double phase_cycles = (double)phase / TWO_PI;
+        phase_cycles = phase_cycles - floor(phase_cycles);
+        inputParameters->phase_acc = (uint32_t)(phase_cycles * 4294967296.0);
     }
 }
 
 
 /******************************************************************************
- *  IIR Single Pole High Pass - Fixed Version
- *  - use fixed integer math with internal variables of 32 bit
- *  - faster than float version without FPU
+ *  DDS (NCO) sine wave generator - Change frequency
+ *  - only the tuning word is changed - phase continuous (useful to sweeps)
  *
- *  - INPUT:    iirHighPassFixed_t * inputStuct (pointer to struct with filter parameters)
- *              int32_t xValue                  (input/sample value)
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
+ *              float freq                          (frequency of signal)
+ *              uint_fast16_t points                (points peer cycle)
  *
  *  - RETURN:   N/A (result returned inside the struct)
- *
- ******************************************************************************
- * - LIMITS:    SHIFTS      INPUT VALUE (Approximate value, influenced by cutoff value)
- *                15          +/- 61.7k
- *                14          +/-123.4k
- *                13          +/-246.9k
- *                12          +/-493.8k
- *                11          +/-987.5k
- *                10          +/-1.975M
- *                 9          +/-3.950M
- *                 8          +/-7.900M
- *
- * Reference: https://dspguru.com/dsp/tricks/fixed-point-dc-blocking-filter-with-noise-shaping/
  ******************************************************************************/
-void iir_SinglePoleHighPass_Fixed(iirHighPassFixed_t * inputStuct, int32_t xValue)
+void ddsGen_SetFrequency(dds_parameters *inputParameters, float freq, uint_fast16_t points)
 {
-    inputStuct->acc -= inputStuct->prev_x;
-    inputStuct->prev_x = (xValue << inputStuct->shift_size);
-    inputStuct->acc += inputStuct->prev_x;
-    inputStuct->acc -= (inputStuct->A_param * inputStuct->prev_y);
-    inputStuct->prev_y = inputStuct->acc >> inputStuct->shift_size;
-    inputStuct->y = inputStuct->prev_y;
+    double cycles = (double)freq / points;      // cycles per sample - double to keep 32 bit resolution
+    cycles = cycles - floor(cycles);            // alias to [0, 1) cycle
+    inputParameters->phase_inc = (uint32_t)(uint64_t)(cycles * 4294967296.0 + 0.5);    // rounding (wrap 2^32 to 0)
 }
 
 
-
-
 /******************************************************************************
- *  IIR Single Pole High Pass - Fixed Extended Version Initialization
+ *  DDS (NCO) sine wave generator - Change tuning word (integer only)
+ *  - phase_inc = (freq/points) * 2^32 - phase continuous, no float math
  *
- *  - INPUT:    iirHighPassFixedExtended_t * structInput    (pointer to struct with filter parameters)
- *              double cutoffFreq                           (pole value)
- *              uint_fast8_t shift                          (shift of fixed math - from 8 to 15)
- *              uint_fast8_t doClean                        (clean variables after change the pole)
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
+ *              uint32_t tuningWord                 (phase increment per sample)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void iir_SinglePoleHighPass_FixedExtended_Init(iirHighPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+void ddsGen_SetTuningWord(dds_parameters *inputParameters, uint32_t tuningWord)
 {
-    uint_fast8_t shift_temp = shift;
+    inputParameters->phase_inc = tuningWord;
+}
 
-    /*
-     * prevent shift bigger than 30 (filter stop to work)
-     */
-    if (shift_temp > 30)
-    {
-        structInput->shift_size = 30;
-    }
-    else if(shift_temp < 8)
+
+/******************************************************************************
+ *  DDS (NCO) sine wave generator - Table lookup with interpolation (internal)
+ *  - 8 MSB of phase select the table point, 24 LSB are the fraction
+ *  - linear:    y = t0 + f*(t1 - t0)
+ *  - quadratic: y = t0 + f*(t1 - t0) + f*(f - 1)/2 * (t2 - 2*t1 + t0)
+ ******************************************************************************/
+static inline int32_t ddsGen_Lookup_Q31(uint32_t phase, uint_fast8_t interpolation)
+{
+    uint32_t index = phase >> DDS_FRAC_BITS;
+    int64_t frac = (int64_t)(phase & ((1UL << DDS_FRAC_BITS) - 1));
+    int64_t t0 = ddsSineTable_Q31[index];
+    int64_t t1 = ddsSineTable_Q31[index + 1];
+    int64_t value = t0 + (((t1 - t0) * frac) >> DDS_FRAC_BITS);
+
+    if (interpolation == DDS_INTERP_QUADRATIC)
     {
-        structInput->shift_size = 8;
+        int64_t t2 = ddsSineTable_Q31[index + 2];
+        int64_t frac2 = (frac * (frac - (1LL << DDS_FRAC_BITS))) >> DDS_FRAC_BITS;  // f*(f - 1), negative
+        value += ((t2 - 2 * t1 + t0) * frac2) >> (DDS_FRAC_BITS + 1);
     }
-    else
+
+    /* saturate - interpolation can pass the full scale near the peaks */
+    if (value > INT32_MAX)
     {
-        structInput->shift_size = shift_temp;
+        value = INT32_MAX;
     }
-
-    structInput->cutoff_Freq = cutoffFreq;
-    structInput->A_param = (int32_t)( (1L << structInput->shift_size) * (structInput->cutoff_Freq) );
-    if (doClean)
+    else if (value < -INT32_MAX)
     {
-        structInput->acc = 0;
-        structInput->prev_x = 0;
-        structInput->y = 0;
-        structInput->prev_y = 0;
+        value = -INT32_MAX;
     }
+    return (int32_t)value;
 }
 
 
 /******************************************************************************
- *  IIR Single Pole High Pass - Fixed Extended Version
- *  - use fixed integer math with internal variables of 64 bit
- *  - more headroom
- *
- *  - INPUT:    iirHighPassFixedExtended_t * inputStuct (pointer to struct with filter parameters)
- *              int32_t xValue                          (input/sample value)
- *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  DDS (NCO) sine wave generator - Calculate the current sample (Q31)
+ *  - unity amplitude, no offset (amplitude/offset applied only to float output)
  *
- ******************************************************************************
- * - LIMITS:    SHIFTS      INPUT VALUE (Approximate value, influenced by cutoff)
- *                30          +/- 61.7k
- *                29          +/-123.4k
- *                28          +/-246.9k
- *                27          +/-493.8k
- *                26          +/-987.5k
- *                25          +/-1.975M
- *                24          +/-3.950M
- *                23          +/-7.900M
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
  *
- * Reference: https://dspguru.com/dsp/tricks/fixed-point-dc-blocking-filter-with-noise-shaping/
+ *  - RETURN:   (int32_t) sample in Q31
  ******************************************************************************/
-void iir_SinglePoleHighPass_FixedExtended(iirHighPassFixedExtended_t * inputStuct, int32_t xValue)
+int32_t ddsGen_GetSample_Q31(dds_parameters *inputParameters)
 {
-    inputStuct->acc -= inputStuct->prev_x;
-    inputStuct->prev_x = ((int64_t)xValue << inputStuct->shift_size);
-    inputStuct->acc += inputStuct->prev_x;
-    inputStuct->acc -= (inputStuct->A_param * (int64_t)inputStuct->prev_y);
-    inputStuct->prev_y = (int32_t)(inputStuct->acc >> inputStuct->shift_size);
-    inputStuct->y = inputStuct->prev_y;
+    int32_t WaveSample = ddsGen_Lookup_Q31(inputParameters->phase_acc, inputParameters->interpolation);
+    inputParameters->phase_acc += inputParameters->phase_inc;      // wrap at 2^32 == 2*pi
+    return WaveSample;
 }
 
 
-
-
 /******************************************************************************
- *  IIR Single Pole Low Pass - Float Version - Initialization
+ *  DDS (NCO) sine wave generator - Calculate the current sample (Q15)
+ *  - unity amplitude, no offset (amplitude/offset applied only to float output)
  *
- *  - INPUT:    iirLowPassFloat_t * structInput     (pointer to struct with filter parameters)
- *              float cutoffFreq                    (pole value)
- *              uint_fast8_t doClean                (clean variables after change the pole)
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   (int16_t) sample in Q15
  ******************************************************************************/
-void iir_SinglePoleLowPass_Float_Init(iirLowPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean)
+int16_t ddsGen_GetSample_Q15(dds_parameters *inputParameters)
 {
-    structInput->cutoff_Freq = cutoffFreq;
-
-    /***************************************
-     * b0 = (1.0f - x)      input coeff
-     * a1 = x               output coeff
-     ***************************************/
-    structInput->b0 = (structInput->cutoff_Freq);
-    structInput->a1 = (1.0f - structInput->cutoff_Freq);
+    int32_t WaveSample = ddsGen_Lookup_Q31(inputParameters->phase_acc, inputParameters->interpolation);
+    inputParameters->phase_acc += inputParameters->phase_inc;      // wrap at 2^32 == 2*pi
 
-    if (doClean)
+    /* round to Q15 */
+    WaveSample = (int32_t)(((int64_t)WaveSample + (1L << 15)) >> 16);
+    if (WaveSample > INT16_MAX)
     {
-        structInput->prev_y = 0;
-        structInput->y = 0;
+        WaveSample = INT16_MAX;
     }
+    return (int16_t)WaveSample;
 }
 
 
-
 /******************************************************************************
- *  IIR Single Pole Low Pass - Float Version
- *  - use float math (more efficient with FPU)
+ *  DDS (NCO) sine wave generator - Calculate the current sample (FLOAT)
  *
- *  - INPUT:    iirLowPassFloat_t * structInput     (pointer to struct with filter parameters)
- *              float xValueFloat                   (input/sample value)
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   (float)WaveSample                   (amplitude * sin + V_offset)
+ ******************************************************************************/
+float ddsGen_GetSample_Float(dds_parameters *inputParameters)
+{
+    int32_t sample_Q31 = ddsGen_Lookup_Q31(inputParameters->phase_acc, inputParameters->interpolation);
+    inputParameters->phase_acc += inputParameters->phase_inc;      // wrap at 2^32 == 2*pi
+
+    return (inputParameters->amplitude * ((float)sample_Q31 * (1.0f / 2147483648.0f))) + inputParameters->V_offset;
+}
+
+
+/******************************************************************************
+ *  DDS (NCO) sine wave generator - array versions
+ *  - continue from the current phase (successive calls are phase continuous)
+ *  - AVX2 (8 samples, linear interpolation) selected at runtime
+ *
+ *  - INPUT:    dds_parameters *inputParameters     (struct with parameters)
+ *              (float/int16_t/int32_t) * outputArray   (array to store samples)
+ *              size_t size                         (number of samples)
  *
- *  Reference: http://www.dspguide.com/ch19.htm
+ *  - RETURN:   N/A
  ******************************************************************************/
-void iir_SinglePoleLowPass_Float(iirLowPassFloat_t * inputStruct, float xValueFloat)
+void ddsGen_Array_Float(dds_parameters *inputParameters, float * outputArray, size_t size)
+{
+    dspSimd_Kernels()->ddsGen_Array_Float(inputParameters, outputArray, size);
+}
+
+void ddsGen_Array_Q15(dds_parameters *inputParameters, int16_t * outputArray, size_t size)
 {
-    /***************************************
-     * b = input coefficients
-     * a = output coefficients
-     *
-     * y = b0*input + a1*y1
-     * y1 = y
-     ***************************************/
-    inputStruct->y = (inputStruct->b0 * xValueFloat) + (inputStruct->a1 * inputStruct->prev_y);
-    inputStruct->prev_y = inputStruct->y;
+    dspSimd_Kernels()->ddsGen_Array_Q15(inputParameters, outputArray, size);
 }
 
+void ddsGen_Array_Q31(dds_parameters *inputParameters, int32_t * outputArray, size_t size)
+{
+    dspSimd_Kernels()->ddsGen_Array_Q31(inputParameters, outputArray, size);
+}
+
+
 
 
+/******************************************************************************
+ *                          DSP FUNCTIONS
+ ******************************************************************************/
 
 /******************************************************************************
- *  IIR Single Pole Low Pass - Fixed Version - Initialization
+ *  IIR Single Pole High Pass - Float Version - Block processing
+ *  - filter an array of samples keeping the state in local variables
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - same math of "iir_SinglePoleHighPass_Float()" (bit-identical output)
  *
- *  - INPUT:    iirLowPassFixed_t * structInput     (pointer to struct with filter parameters)
- *              float cutoffFreq                    (pole value)
- *              uint_fast8_t shift                  (shift of fixed math - from 8 to 15)
- *              uint_fast8_t doClean                (clean variables after change the pole)
+ * - INPUT:     iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
+ *              const float * arrayIn               (pointer to array with input samples)
+ *              float * arrayOut                    (pointer to array to store filtered samples)
+ *              size_t size                         (number of samples)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ * - RETURN:    N/A (filtered samples in arrayOut, last output in struct "y")
  ******************************************************************************/
-void iir_SinglePoleLowPass_Fixed_Init(iirLowPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+void iir_SinglePoleHighPass_Float_Block(iirHighPassFloat_t * structInput, const float * arrayIn, float * arrayOut, size_t size)
 {
-    uint_fast8_t shift_temp = shift;
+    float cutoff = structInput->cutoff_Freq;
+    float prev_x = structInput->prev_x;
+    float prev_y = structInput->prev_y;
+    float x;
+    size_t counter;
 
-    /**********************************************************
-     * prevent shift bigger than 12 (filter stop to work)
-     **********************************************************/
-    if (shift_temp > 12)
-    {
-        structInput->shift_size = 12;
-    }
-    else if(shift_temp < 8)
+    if (size == 0)
     {
-        structInput->shift_size = 8;
+        return;
     }
-    else
+
+    for (counter = 0; counter < size; counter++)
     {
-        structInput->shift_size = shift_temp;
+        x = arrayIn[counter];                           // read before write - allow in-place
+        prev_y = x - prev_x + (cutoff * prev_y);
+        prev_x = x;
+        arrayOut[counter] = prev_y;
     }
 
-    structInput->RoundNumber = (1l << structInput->shift_size);
+    structInput->prev_x = prev_x;
+    structInput->prev_y = prev_y;
+    structInput->y = prev_y;
+}
+
 
-    structInput->cutoff_Freq = cutoffFreq;
-    structInput->A_param = (int32_t)(structInput->cutoff_Freq * (1l << structInput->shift_size));
+/******************************************************************************
+ *  IIR First Order Scan - coefficients of the kernel (internal)
+ *  - matrix columns: 15 zeros (upper triangle), c0 = b0 and
+ *    cm = b0 * a1^m + b1 * a1^(m-1) (m = 1 ... 15), 0
+ *  - input before the block: b1 * a1^k - output before the block: a1^(k+1)
+ *  - computed in double and rounded
+ ******************************************************************************/
+static void iir_FirstOrderScan_Powers(float b0, float b1, float a1, float * powers)
+{
+    double power = 1.0;                                 // a1^k
+    size_t k;
 
-    if (doClean)
+    for (k = 0; k < (IIR_SCAN_LOOKAHEAD - 1); k++)
+    {
+        powers[k] = 0.0f;
+    }
+    powers[(2 * IIR_SCAN_LOOKAHEAD) - 1] = 0.0f;
+    powers[IIR_SCAN_LOOKAHEAD - 1] = b0;
+    for (k = 0; k < IIR_SCAN_LOOKAHEAD; k++)
+    {
+        if (k > 0)
         {
-            structInput->SHIFTED_filtered = 0;
-            structInput->SHIFTED_last_filtered = 0;
-            structInput->y = 0;
+            powers[(IIR_SCAN_LOOKAHEAD - 1) + k] = (float)(((double)b0 * power * (double)a1) + ((double)b1 * power));
+            power *= (double)a1;
         }
+        powers[(2 * IIR_SCAN_LOOKAHEAD) + k] = (float)((double)b1 * power);
+        powers[(3 * IIR_SCAN_LOOKAHEAD) + k] = (float)(power * (double)a1);
+    }
 }
 
 
 /******************************************************************************
- *  IIR Single Pole Low Pass - Fixed Version
- *
- *  - INPUT:    iirLowPassFixed_t * structInput     (pointer to struct with filter parameters)
- *              int32_t xValue                      (input/sample value)
- *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  IIR Single Pole High Pass - Float Version - Scan (parallel prefix)
+ *  - same filter of "iir_SinglePoleHighPass_Float_Block()" for long arrays:
+ *    y[n] = x[n] - x[n-1] + cutoff * y[n-1] solved 16 samples at a time
+ *    (see "iir_FirstOrderScan_Float()")
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - different rounding of the serial recursion (float tolerance)
+ *  - faster with SIMD (x86) - on MCUs use the block version
  *
- ******************************************************************************
- * - LIMITS:    SHIFTS      INPUT VALUE (Approximate value, influenced by cuttof)
- *                12          +/- 30k
- *                11          +/- 120k
- *                10          +/- 480k
- *                09          +/- 1.920M
- *                08          +/- 7.680M
+ * - INPUT:     iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
+ *              const float * arrayIn               (pointer to array with input samples)
+ *              float * arrayOut                    (pointer to array to store filtered samples)
+ *              size_t size                         (number of samples)
  *
- *  Reference: https://learn.openenergymonitor.org/electricity-monitoring/ctac/digital-filters-for-offset-removal
+ * - RETURN:    N/A (filtered samples in arrayOut, last output in struct "y")
  ******************************************************************************/
-void iir_SinglePoleLowPass_Fixed(iirLowPassFixed_t * inputStruct, int32_t xValue)
+void iir_SinglePoleHighPass_Float_Scan(iirHighPassFloat_t * structInput, const float * arrayIn, float * arrayOut, size_t size)
 {
-    /***************************************
-     * y = y1 + cutoffFreq * (input - y1)
-     * y1 = y
-     ***************************************/
+    float last_x;
+
+    if (size == 0)
+    {
+        return;
+    }
 
-    /* RoundNumber math adding 0.5 before return the number */
-    inputStruct->SHIFTED_filtered = inputStruct->SHIFTED_last_filtered + (inputStruct->A_param * ((xValue << inputStruct->shift_size) - inputStruct->SHIFTED_filtered + inputStruct->RoundNumber) >> inputStruct->shift_size);
-    inputStruct->SHIFTED_last_filtered = inputStruct->SHIFTED_filtered;
-    inputStruct->y = inputStruct->SHIFTED_filtered >> inputStruct->shift_size;
+    last_x = arrayIn[size - 1];                         // read before write - allow in-place
+    structInput->prev_y = iir_FirstOrderScan_Float(1.0f, -1.0f, structInput->cutoff_Freq, arrayIn, arrayOut, size,
+                                                   structInput->prev_x, structInput->prev_y);
+    structInput->prev_x = last_x;
+    structInput->y = structInput->prev_y;
 }
 
 
 
+
 /******************************************************************************
- *  IIR Single Pole Low Pass - Fixed Extended Version - Initialization
+ *  IIR Single Pole High Pass - Fixed Version - Block processing
+ *  - filter an array of samples keeping the state in local variables
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - same math of "iir_SinglePoleHighPass_Fixed()" (bit-identical output)
  *
- *  - INPUT:    iirLowPassFixedExtended_t * structInput (pointer to struct with filter parameters)
- *              double cutoffFreq                       (pole value)
- *              uint_fast8_t shift                      (shift of fixed math - from 8 to 15)
- *              uint_fast8_t doClean                    (clean variables after change the pole)
+ *  - INPUT:    iirHighPassFixed_t * inputStuct (pointer to struct with filter parameters)
+ *              const int32_t * arrayIn         (pointer to array with input samples)
+ *              int32_t * arrayOut              (pointer to array to store filtered samples)
+ *              size_t size                     (number of samples)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   N/A (filtered samples in arrayOut, last output in struct "y")
+ *
+ *  - LIMITS:   same of "iir_SinglePoleHighPass_Fixed()"
  ******************************************************************************/
-void iir_SinglePoleLowPass_FixedExtended_Init(iirLowPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+void iir_SinglePoleHighPass_Fixed_Block(iirHighPassFixed_t * inputStuct, const int32_t * arrayIn, int32_t * arrayOut, size_t size)
 {
-    uint_fast8_t shift_temp = shift;
-
-    /*
-     * prevent shift bigger than 28 (filter stop to work)
-     */
-    if (shift_temp > 28)
-    {
-        structInput->shift_size = 28;
-    }
-    else if(shift_temp < 8)
+    uint_fast8_t shift = inputStuct->shift_size;
+    int32_t A_param = inputStuct->A_param;
+    int32_t acc = inputStuct->acc;
+    int32_t prev_x = inputStuct->prev_x;
+    int32_t prev_y = inputStuct->prev_y;
+    size_t counter;
+
+    if (size == 0)
     {
-        structInput->shift_size = 8;
+        return;
     }
-    else
+
+    for (counter = 0; counter < size; counter++)
     {
-        structInput->shift_size = shift_temp;
+        acc -= prev_x;
+        prev_x = (arrayIn[counter] << shift);
+        acc += prev_x;
+        acc -= (A_param * prev_y);
+        prev_y = acc >> shift;
+        arrayOut[counter] = prev_y;
     }
 
-    structInput->RoundNumber = (int64_t)(1LL << structInput->shift_size);
-
-    structInput->cutoff_Freq = cutoffFreq;
-    structInput->A_param = (int64_t)(structInput->cutoff_Freq * (1LL << structInput->shift_size));
-
-    if (doClean)
-        {
-            structInput->SHIFTED_filtered = 0;
-            structInput->SHIFTED_last_filtered = 0;
-            structInput->y = 0;
-        }
+    inputStuct->acc = acc;
+    inputStuct->prev_x = prev_x;
+    inputStuct->prev_y = prev_y;
+    inputStuct->y = prev_y;
 }
 
 
 
+
 /******************************************************************************
- *  IIR Single Pole Low Pass - Fixed Extended Version
+ *  IIR Single Pole High Pass - Fixed Extended Version - Block processing
+ *  - filter an array of samples keeping the state in local variables
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - same math of "iir_SinglePoleHighPass_FixedExtended()" (bit-identical output)
  *
- *  - INPUT:    iirLowPassFixed_t * structInput     (pointer to struct with filter parameters)
- *              int32_t xValue                      (input/sample value)
+ *  - INPUT:    iirHighPassFixedExtended_t * inputStuct (pointer to struct with filter parameters)
+ *              const int32_t * arrayIn                 (pointer to array with input samples)
+ *              int32_t * arrayOut                      (pointer to array to store filtered samples)
+ *              size_t size                             (number of samples)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   N/A (filtered samples in arrayOut, last output in struct "y")
  *
- *  Reference: https://learn.openenergymonitor.org/electricity-monitoring/ctac/digital-filters-for-offset-removal
+ *  - LIMITS:   same of "iir_SinglePoleHighPass_FixedExtended()"
  ******************************************************************************/
-void iir_SinglePoleLowPass_FixedExtended(iirLowPassFixedExtended_t * inputStruct, int32_t xValue)
+void iir_SinglePoleHighPass_FixedExtended_Block(iirHighPassFixedExtended_t * inputStuct, const int32_t * arrayIn, int32_t * arrayOut, size_t size)
 {
-    /***************************************
-     * y = y1 + cutoffFreq * (input - y1)
-     * y1 = y
-     ***************************************/
+    uint_fast8_t shift = inputStuct->shift_size;
+    int64_t A_param = inputStuct->A_param;
+    int64_t acc = inputStuct->acc;
+    int64_t prev_x = inputStuct->prev_x;
+    int32_t prev_y = inputStuct->prev_y;
+    size_t counter;
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    for (counter = 0; counter < size; counter++)
+    {
+        acc -= prev_x;
+        prev_x = ((int64_t)arrayIn[counter] << shift);
+        acc += prev_x;
+        acc -= (A_param * (int64_t)prev_y);
+        prev_y = (int32_t)(acc >> shift);
+        arrayOut[counter] = prev_y;
+    }
 
-    /* RoundNumber math adding 0.5 before return the number */
-    inputStruct->SHIFTED_filtered = inputStruct->SHIFTED_last_filtered + (inputStruct->A_param * (((int64_t)xValue << inputStruct->shift_size) - inputStruct->SHIFTED_filtered + inputStruct->RoundNumber) >> inputStruct->shift_size);
-    inputStruct->SHIFTED_last_filtered = inputStruct->SHIFTED_filtered;
-    inputStruct->y = (int32_t)(inputStruct->SHIFTED_filtered >> inputStruct->shift_size);
+    inputStuct->acc = acc;
+    inputStuct->prev_x = prev_x;
+    inputStuct->prev_y = prev_y;
+    inputStuct->y = prev_y;
 }
 
 
 
 
 /******************************************************************************
- *  IIR Single Pole Low Pass - Fixed FAST Version - Initialization
+ *  IIR Single Pole Low Pass - Float Version - Block processing
+ *  - filter an array of samples keeping the state in local variables
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - same math of "iir_SinglePoleLowPass_Float()" (bit-identical output)
  *
- *  - INPUT:    iirLowPassFixedExtended_t * structInput (pointer to struct with filter parameters)
- *              int_fast8_t attenuation                 (attenuation factor - see reference)
- *              uint_fast8_t doClean                    (clean variables after change the pole)
+ * - INPUT:     iirLowPassFloat_t * inputStruct     (pointer to struct with filter parameters)
+ *              const float * arrayIn               (pointer to array with input samples)
+ *              float * arrayOut                    (pointer to array to store filtered samples)
+ *              size_t size                         (number of samples)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ * - RETURN:    N/A (filtered samples in arrayOut, last output in struct "y")
  ******************************************************************************/
-void iir_SinglePoleLowPass_Fixed_Fast_Init(iirLowPassFixedFast_t * structInput, int_fast8_t attenuation, int_fast8_t doClean)
+void iir_SinglePoleLowPass_Float_Block(iirLowPassFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size)
 {
-    structInput->attenuation = attenuation;
+    float b0 = inputStruct->b0;
+    float a1 = inputStruct->a1;
+    float prev_y = inputStruct->prev_y;
+    size_t counter;
 
-    if (doClean)
+    if (size == 0)
     {
-        structInput->filter_acc = 0;
-        structInput->y = 0;
+        return;
+    }
+
+    for (counter = 0; counter < size; counter++)
+    {
+        prev_y = (b0 * arrayIn[counter]) + (a1 * prev_y);
+        arrayOut[counter] = prev_y;
     }
+
+    inputStruct->prev_y = prev_y;
+    inputStruct->y = prev_y;
 }
 
 
 /******************************************************************************
- *  IIR Single Pole Low Pass - Fixed FAST Version - Initialization
- *  - leaky integrator - very efficient
- *
- *  - INPUT:    iirLowPassFixedExtended_t * structInput (pointer to struct with filter parameters)
- *              int_fast8_t attenuation                 (attenuation factor - see reference)
- *              uint_fast8_t doClean                    (clean variables after change the pole)
+ *  IIR Single Pole Low Pass - Float Version - Scan (parallel prefix)
+ *  - same filter of "iir_SinglePoleLowPass_Float_Block()" for long arrays:
+ *    y[n] = b0 * x[n] + a1 * y[n-1] solved 16 samples at a time (see
+ *    "iir_FirstOrderScan_Float()")
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - different rounding of the serial recursion (float tolerance)
+ *  - faster with SIMD (x86) - on MCUs use the block version
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ * - INPUT:     iirLowPassFloat_t * inputStruct     (pointer to struct with filter parameters)
+ *              const float * arrayIn               (pointer to array with input samples)
+ *              float * arrayOut                    (pointer to array to store filtered samples)
+ *              size_t size                         (number of samples)
  *
- *  Reference: http://www.edn.com/design/systems-design/4320010/A-simple-software-lowpass-filter-suits-embedded-system-applications
+ * - RETURN:    N/A (filtered samples in arrayOut, last output in struct "y")
  ******************************************************************************/
-void iir_SinglePoleLowPass_Fixed_Fast(iirLowPassFixedFast_t * inputStruct, int32_t xValue)
+void iir_SinglePoleLowPass_Float_Scan(iirLowPassFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size)
 {
-    /*******************************************************
-     * filt = filt - (filt >> attenuationFactor) + input
-     * y = filt >> attenuationFactor
-     *******************************************************/
-    inputStruct->filter_acc = inputStruct->filter_acc - (inputStruct->filter_acc >> inputStruct->attenuation) + xValue;
-    inputStruct->y = (inputStruct->filter_acc >> inputStruct->attenuation);
+    if (size == 0)
+    {
+        return;
+    }
+
+    inputStruct->prev_y = iir_FirstOrderScan_Float(inputStruct->b0, 0.0f, inputStruct->a1, arrayIn, arrayOut, size, 0.0f, inputStruct->prev_y);
+    inputStruct->y = inputStruct->prev_y;
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Float Array Version - Initialize Structure Parameters (FLOAT)
+ *  IIR First Order Scan - Float
+ *  - y[n] = b0 * x[n] + b1 * x[n-1] + a1 * y[n-1] as an associative scan:
+ *    each block of IIR_SCAN_LOOKAHEAD outputs is a matrix of coefficients
+ *    times the block inputs (independent of the previous outputs - SIMD
+ *    lanes) plus a1^(k+1) * y[-1] - one serial step per block
+ *  - all SIMD levels give the same output (runtime dispatch)
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - base of the scan filters and of the segments on threads
+ *    ("DSP_and_Math_threads.h")
  *
- *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
- *              float bin                               (desired bin - what harmonic)
- *              uint_fast16_t size_array                (array size - number of samples)
+ * - INPUT:     float b0                (input coefficient)
+ *              float b1                (previous input coefficient)
+ *              float a1                (pole - previous output coefficient)
+ *              const float * arrayIn   (pointer to array with input samples)
+ *              float * arrayOut        (pointer to array to store the outputs)
+ *              size_t size             (number of samples)
+ *              float xInit             (input before the first sample - x[-1])
+ *              float yInit             (output before the first sample - y[-1])
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ * - RETURN:    last output (yInit if size = 0)
  ******************************************************************************/
-void goertzelArrayInit_Float(goertzel_array_float_t * inputStruct, float bin, uint_fast16_t size_array)
+float iir_FirstOrderScan_Float(float b0, float b1, float a1, const float * arrayIn, float * arrayOut, size_t size,
+                               float xInit, float yInit)
 {
-    float w = (2 * PI * bin)/size_array;
-    inputStruct->cr_float = cosf(w);
-    inputStruct->ci_float = sinf(w);
+    float powers[IIR_SCAN_POWERS_SIZE];
 
-    inputStruct->coeff_float = 2 * inputStruct->cr_float;
-    inputStruct->size_array = size_array;
+    iir_FirstOrderScan_Powers(b0, b1, a1, powers);
+    return dspSimd_Kernels()->iir_FirstOrderScan_Float(powers, arrayIn, arrayOut, size, xInit, yInit);
 }
 
 
+
+
 /******************************************************************************
- *  Goertzel DFT - Float Math Array Version - Do the Math (FLOAT INPUT)
- *  - Calculate the amplitude of a desired bin (frequency) of a wave
+ *  IIR Single Pole Low Pass - Float Bank (multi-channel) - Initialization
+ *  - coefficients and states of N channels stored in contiguous arrays (SoA)
+ *  - arrays are provided by the user (each one with "channels" elements)
+ *  - all channels start with the same cutoff (see "_Bank_SetChannel()")
  *
- *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
- *              const float * arrayInput                (pointer to array with input samples)
+ *  - INPUT:    iirLowPassFloatBank_t * bankInput   (pointer to struct with bank parameters)
+ *              float * b0                          (array to store input coefficients)
+ *              float * a1                          (array to store output coefficients)
+ *              float * prev_y                      (array to store filter states)
+ *              uint_fast16_t channels              (number of channels)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelArrayFloat_Float(goertzel_array_float_t * inputStruct, const float * arrayInput)
+void iir_SinglePoleLowPass_Float_Bank_Init(iirLowPassFloatBank_t * bankInput, float * b0, float * a1, float * prev_y,
+                                           uint_fast16_t channels, float cutoffFreq, uint_fast8_t doClean)
 {
-    float s_float = 0;
-    float sprev_float = 0;
-    float sprev_float2 = 0;
+    uint_fast16_t counter;
 
-    uint_fast16_t size_array = inputStruct->size_array;
+    bankInput->channels = channels;
+    bankInput->b0 = b0;
+    bankInput->a1 = a1;
+    bankInput->prev_y = prev_y;
 
-    uint_fast16_t i;
-    for (i = 0; i < size_array ; i++)
+    for (counter = 0; counter < channels; counter++)
     {
-        s_float = arrayInput[i] + (inputStruct->coeff_float * sprev_float) - sprev_float2;
-        sprev_float2 = sprev_float;
-        sprev_float = s_float;
+        iir_SinglePoleLowPass_Float_Bank_SetChannel(bankInput, counter, cutoffFreq, doClean);
     }
-
-    float real_float = (sprev_float - sprev_float2 * inputStruct->cr_float);
-    float imag_float = (sprev_float2 * inputStruct->ci_float);
-    inputStruct->real_float = real_float;
-    inputStruct->imag_float = imag_float;
-
-    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float)))/(size_array/2);
-    inputStruct->result = result;
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Float Math Array Version - Do the Math (INT16 INPUT)
- *  - Calculate the amplitude of a desired bin (frequency) of a wave
+ *  IIR Single Pole Low Pass - Float Bank (multi-channel) - Set one channel
+ *  - same coefficients of "iir_SinglePoleLowPass_Float_Init()"
  *
- *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
- *              const int16_t * arrayInput              (pointer to array with input samples)
+ *  - INPUT:    iirLowPassFloatBank_t * bankInput   (pointer to struct with bank parameters)
+ *              uint_fast16_t channel               (channel index - from 0 to channels-1)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelArrayInt16_Float(goertzel_array_float_t * inputStruct, const int16_t * arrayInput)
+void iir_SinglePoleLowPass_Float_Bank_SetChannel(iirLowPassFloatBank_t * bankInput, uint_fast16_t channel, float cutoffFreq, uint_fast8_t doClean)
 {
-    float s_float = 0;
-    float sprev_float = 0;
-    float sprev_float2 = 0;
+    if (channel >= bankInput->channels)
+    {
+        return;
+    }
 
-    uint_fast16_t size_array = inputStruct->size_array;
+    bankInput->b0[channel] = cutoffFreq;
+    bankInput->a1[channel] = (1.0f - cutoffFreq);
 
-    uint_fast16_t i;
-    for (i = 0; i < size_array ; i++)
+    if (doClean)
     {
-        s_float = (float)arrayInput[i] + inputStruct->coeff_float * sprev_float - sprev_float2;
-        sprev_float2 = sprev_float;
-        sprev_float = s_float;
+        bankInput->prev_y[channel] = 0;
     }
+}
 
-    float real_float = (sprev_float - sprev_float2 * inputStruct->cr_float);
-    float imag_float = (sprev_float2 * inputStruct->ci_float);
-    inputStruct->real_float = real_float;
-    inputStruct->imag_float = imag_float;
 
-//    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float))) / ((float)size_array/2.0f);   // waste more time
-//    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float))) / (size_array/2);
-    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float)));        // extract square root
-    result = result / size_array;                   // divide by the total of samples
-    result = result * 2.0f;                         // multiply by 2
-    inputStruct->result = result;                   // store in the struct
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Float Bank (multi-channel) - Block of frames
+ *  - arrays are interleaved: arrayIn[frame * channels + channel]
+ *  - each group of channels keeps the state in registers for all frames
+ *  - use SSE (4 lanes), AVX (8 lanes) or AVX-512 (16 lanes) across channels -
+ *    selected at runtime
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    iirLowPassFloatBank_t * bankInput   (pointer to struct with bank parameters)
+ *              const float * arrayIn               (interleaved input samples)
+ *              float * arrayOut                    (interleaved filtered samples)
+ *              size_t frames                       (number of frames)
+ *
+ *  - RETURN:   N/A (filtered samples in arrayOut, states inside the struct)
+ ******************************************************************************/
+void iir_SinglePoleLowPass_Float_Bank_Block(iirLowPassFloatBank_t * bankInput, const float * arrayIn, float * arrayOut, size_t frames)
+{
+    dspSimd_Kernels()->iir_SinglePoleLowPass_Float_Bank_Block(bankInput, arrayIn, arrayOut, frames);
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Fixed 64 Math Array Version - Initialize Structure Parameters (FIXED64)
+ *  IIR Single Pole Low Pass - Float Bank (multi-channel) - One frame
+ *  - filter one sample of each channel
  *
- *  - INPUT:    goertzel_array_fixed64_t * inputStruct  (pointer to struct with parameters)
- *              float bin                               (desired bin - what harmonic)
- *              uint_fast16_t size_array                (array size - number of samples)
- *              uint_fast8_t shift                      (shift size used in fixed math)
+ *  - INPUT:    iirLowPassFloatBank_t * bankInput   (pointer to struct with bank parameters)
+ *              const float * frameIn               (one input sample per channel)
+ *              float * frameOut                    (one filtered sample per channel)
+ *
+ *  - RETURN:   N/A (filtered samples in frameOut, states inside the struct)
+ ******************************************************************************/
+void iir_SinglePoleLowPass_Float_Bank_Frame(iirLowPassFloatBank_t * bankInput, const float * frameIn, float * frameOut)
+{
+    iir_SinglePoleLowPass_Float_Bank_Block(bankInput, frameIn, frameOut, 1);
+}
+
+
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Bank (multi-channel) - Initialization
+ *  - coefficients and states of N channels stored in contiguous arrays (SoA)
+ *  - arrays are provided by the user (each one with "channels" elements)
+ *  - shift is shared by all channels (from 8 to 12 - same of fixed version)
+ *
+ *  - INPUT:    iirLowPassFixedBank_t * bankInput   (pointer to struct with bank parameters)
+ *              int32_t * A_param                   (array to store coefficients)
+ *              int32_t * state                     (array to store filter states)
+ *              uint_fast16_t channels              (number of channels)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t shift                  (shift of fixed math - from 8 to 12)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelArrayInit_Fixed64(goertzel_array_fixed64_t * inputStruct, float bin, uint_fast16_t size_array, uint_fast8_t shift)
+void iir_SinglePoleLowPass_Fixed_Bank_Init(iirLowPassFixedBank_t * bankInput, int32_t * A_param, int32_t * state,
+                                           uint_fast16_t channels, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
 {
-    float w = (2 * PI * bin)/size_array;
-    float cr_float = cosf(w);
-    float ci_float = sinf(w);
+    uint_fast16_t counter;
 
-    inputStruct->cr_fix = (int64_t)(cr_float * (1LL << shift));     // try rounding
-    inputStruct->ci_fix = (int64_t)(ci_float * (1LL << shift));     // try rounding
+    /* same limits of "iir_SinglePoleLowPass_Fixed_Init()" */
+    if (shift > 12)
+    {
+        bankInput->shift_size = 12;
+    }
+    else if (shift < 8)
+    {
+        bankInput->shift_size = 8;
+    }
+    else
+    {
+        bankInput->shift_size = shift;
+    }
 
-    float coeff_float = 2 * cr_float;
-    inputStruct->coeff_fix = (int64_t)(coeff_float * (1LL << shift));
+    bankInput->RoundNumber = (1l << bankInput->shift_size);
+    bankInput->channels = channels;
+    bankInput->A_param = A_param;
+    bankInput->SHIFTED_last_filtered = state;
 
-    inputStruct->size_array = size_array;
-    inputStruct->shift = shift;
+    for (counter = 0; counter < channels; counter++)
+    {
+        iir_SinglePoleLowPass_Fixed_Bank_SetChannel(bankInput, counter, cutoffFreq, doClean);
+    }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Fixed 64 Math Array Version - Do the Math (INT16 INPUT)
- *  - Calculate the amplitude of a desired bin (frequency) of a wave
+ *  IIR Single Pole Low Pass - Fixed Bank (multi-channel) - Set one channel
+ *  - same coefficient of "iir_SinglePoleLowPass_Fixed_Init()"
  *
- *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
- *              const int16_t * arrayInput              (pointer to array with input samples)
+ *  - INPUT:    iirLowPassFixedBank_t * bankInput   (pointer to struct with bank parameters)
+ *              uint_fast16_t channel               (channel index - from 0 to channels-1)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelArrayInt16_Fixed64(goertzel_array_fixed64_t * inputStruct, const int16_t * arrayInput)
+void iir_SinglePoleLowPass_Fixed_Bank_SetChannel(iirLowPassFixedBank_t * bankInput, uint_fast16_t channel, float cutoffFreq, uint_fast8_t doClean)
 {
-    int64_t s_fix = 0;
-    int64_t sprev_fix = 0;
-    int64_t sprev_fix2 = 0;
+    if (channel >= bankInput->channels)
+    {
+        return;
+    }
 
-    uint_fast16_t size_array = inputStruct->size_array;
-    uint_fast8_t shift = inputStruct->shift;
+    bankInput->A_param[channel] = (int32_t)(cutoffFreq * (1l << bankInput->shift_size));
 
-    uint_fast16_t i;
-    for (i = (0); i < size_array ; i++)
+    if (doClean)
     {
-        s_fix = ((int64_t)arrayInput[i] << shift) + ((int64_t)(inputStruct->coeff_fix * sprev_fix) >> shift) - sprev_fix2;
-        sprev_fix2 = sprev_fix;
-        sprev_fix = s_fix;
+        bankInput->SHIFTED_last_filtered[channel] = 0;
     }
+}
 
-    int64_t real_fix = (sprev_fix - ((sprev_fix2 * inputStruct->cr_fix) >> shift));
-    int64_t imag_fix = (sprev_fix2 * inputStruct->ci_fix) >> shift;
-
-    inputStruct->real_fix = real_fix;
-    inputStruct->imag_fix = imag_fix;
 
-    //    float result = sqrtf((float)((real_fix*real_fix)>>shift) + ((imag_fix*imag_fix)>>shift) );   // two shift
-    float result = sqrtf((float)((((real_fix*real_fix) + (imag_fix*imag_fix)) >> shift)));      // one shift
-    result = result / inputStruct->size_array;
-    result = result * 2;
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Bank (multi-channel) - Block of frames
+ *  - arrays are interleaved: arrayIn[frame * channels + channel]
+ *  - same math of "iir_SinglePoleLowPass_Fixed()" (same output)
+ *  - use SSE4.1 (4 lanes), AVX2 (8 lanes) or AVX-512 (16 lanes) across
+ *    channels - selected at runtime
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    iirLowPassFixedBank_t * bankInput   (pointer to struct with bank parameters)
+ *              const int32_t * arrayIn             (interleaved input samples)
+ *              int32_t * arrayOut                  (interleaved filtered samples)
+ *              size_t frames                       (number of frames)
+ *
+ *  - RETURN:   N/A (filtered samples in arrayOut, states inside the struct)
+ *
+ *  - LIMITS:   same of "iir_SinglePoleLowPass_Fixed()"
+ ******************************************************************************/
+void iir_SinglePoleLowPass_Fixed_Bank_Block(iirLowPassFixedBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames)
+{
+    dspSimd_Kernels()->iir_SinglePoleLowPass_Fixed_Bank_Block(bankInput, arrayIn, arrayOut, frames);
+}
 
 
-    float result_float = (float)result / (1LL << (shift >> 1)); // divide pela raiz quadarda de Shift. ex.: shift = 10 (2^10), divide por 2^5
-    inputStruct->result = result_float;
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Bank (multi-channel) - One frame
+ *  - filter one sample of each channel
+ *
+ *  - INPUT:    iirLowPassFixedBank_t * bankInput   (pointer to struct with bank parameters)
+ *              const int32_t * frameIn             (one input sample per channel)
+ *              int32_t * frameOut                  (one filtered sample per channel)
+ *
+ *  - RETURN:   N/A (filtered samples in frameOut, states inside the struct)
+ ******************************************************************************/
+void iir_SinglePoleLowPass_Fixed_Bank_Frame(iirLowPassFixedBank_t * bankInput, const int32_t * frameIn, int32_t * frameOut)
+{
+    iir_SinglePoleLowPass_Fixed_Bank_Block(bankInput, frameIn, frameOut, 1);
 }
 
 
+
+
 /******************************************************************************
- *  Goertzel DFT - Float Math Sample-by-sample Version - Initialize Structure Parameters
+ *  IIR Single Pole Low Pass - Fixed FAST Bank (multi-channel) - Initialization
+ *  - attenuations and accumulators of N channels stored in contiguous arrays (SoA)
+ *  - arrays are provided by the user (each one with "channels" elements)
  *
- *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
- *              float bin                               (desired bin - what harmonic)
- *              uint_fast16_t size_array                (array size - number of samples)
+ *  - INPUT:    iirLowPassFixedFastBank_t * bankInput   (pointer to struct with bank parameters)
+ *              int32_t * attenuation                   (array to store attenuation factors)
+ *              int32_t * filter_acc                    (array to store accumulators)
+ *              uint_fast16_t channels                  (number of channels)
+ *              int_fast8_t attenuationValue            (attenuation factor - see reference)
+ *              uint_fast8_t doClean                    (clean variables after change the pole)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelSampleInit_Float(goertzel_sample_float_t * inputStruct, float bin, uint_fast16_t size_array)
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_Init(iirLowPassFixedFastBank_t * bankInput, int32_t * attenuation, int32_t * filter_acc,
+                                                uint_fast16_t channels, int_fast8_t attenuationValue, uint_fast8_t doClean)
 {
-    float w = (2 * PI * bin)/size_array;
-    inputStruct->cr_float = cosf(w);
-    inputStruct->ci_float = sinf(w);
+    uint_fast16_t counter;
 
-    inputStruct->coeff_float = 2 * inputStruct->cr_float;
-    inputStruct->size_array = size_array;
+    bankInput->channels = channels;
+    bankInput->attenuation = attenuation;
+    bankInput->filter_acc = filter_acc;
+
+    for (counter = 0; counter < channels; counter++)
+    {
+        iir_SinglePoleLowPass_Fixed_Fast_Bank_SetChannel(bankInput, counter, attenuationValue, doClean);
+    }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Float Math Sample-by-sample Version - Add sample (FLOAT)
- *  - Pre calculate each sample
+ *  IIR Single Pole Low Pass - Fixed FAST Bank (multi-channel) - Set one channel
  *
- *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
- *              float sample                            (input sample)
+ *  - INPUT:    iirLowPassFixedFastBank_t * bankInput   (pointer to struct with bank parameters)
+ *              uint_fast16_t channel                   (channel index - from 0 to channels-1)
+ *              int_fast8_t attenuationValue            (attenuation factor - see reference)
+ *              uint_fast8_t doClean                    (clean variables after change the pole)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelSampleAddFloat_Float(goertzel_sample_float_t * inputStruct, float sample)
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_SetChannel(iirLowPassFixedFastBank_t * bankInput, uint_fast16_t channel, int_fast8_t attenuationValue, uint_fast8_t doClean)
 {
-    if (inputStruct->counter < inputStruct->size_array)
+    if (channel >= bankInput->channels)
     {
-        float s_float = sample + (inputStruct->coeff_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
-        inputStruct->sprev_float2 = inputStruct->sprev_float;
-        inputStruct->sprev_float = s_float;
+        return;
+    }
+
+    bankInput->attenuation[channel] = attenuationValue;
 
-        inputStruct->counter++;
-        inputStruct->s_float = s_float;
+    if (doClean)
+    {
+        bankInput->filter_acc[channel] = 0;
     }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Float Math Sample-by-sample Version - Add sample (INT16)
- *  - Pre calculate each sample
+ *  IIR Single Pole Low Pass - Fixed FAST Bank (multi-channel) - Block of frames
+ *  - arrays are interleaved: arrayIn[frame * channels + channel]
+ *  - same math of "iir_SinglePoleLowPass_Fixed_Fast()" (same output)
+ *  - use AVX2 (8 lanes) or AVX-512 (16 lanes) per lane shift across channels -
+ *    selected at runtime
+ *  - arrayIn and arrayOut can be the same array (in-place)
  *
- *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
- *              int16_t sample                          (input sample)
+ *  - INPUT:    iirLowPassFixedFastBank_t * bankInput   (pointer to struct with bank parameters)
+ *              const int32_t * arrayIn                 (interleaved input samples)
+ *              int32_t * arrayOut                      (interleaved filtered samples)
+ *              size_t frames                           (number of frames)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   N/A (filtered samples in arrayOut, states inside the struct)
+ ******************************************************************************/
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_Block(iirLowPassFixedFastBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames)
+{
+    dspSimd_Kernels()->iir_SinglePoleLowPass_Fixed_Fast_Bank_Block(bankInput, arrayIn, arrayOut, frames);
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed FAST Bank (multi-channel) - One frame
+ *  - filter one sample of each channel
+ *
+ *  - INPUT:    iirLowPassFixedFastBank_t * bankInput   (pointer to struct with bank parameters)
+ *              const int32_t * frameIn                 (one input sample per channel)
+ *              int32_t * frameOut                      (one filtered sample per channel)
+ *
+ *  - RETURN:   N/A (filtered samples in frameOut, states inside the struct)
+ ******************************************************************************/
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_Frame(iirLowPassFixedFastBank_t * bankInput, const int32_t * frameIn, int32_t * frameOut)
+{
+    iir_SinglePoleLowPass_Fixed_Fast_Bank_Block(bankInput, frameIn, frameOut, 1);
+}
+
+
+
+
+/******************************************************************************
+ *  Biquad - Design a Low Pass second order section (float coefficients)
+ *  - Butterworth response when q = 0.7071 (1/sqrt(2))
+ *  - coefficients normalized by a0: b0, b1, b2, a1, a2
+ *  - cascade N sections writing in "&coeffs[5 * stage]"
+ *
+ *  - INPUT:    float * coeffs          (array to store 5 coefficients)
+ *              float cutoffFreq        (cutoff frequency / sampling frequency - from 0 to 0.5)
+ *              float q                 (quality factor)
+ *
+ *  - RETURN:   N/A (coefficients returned inside the array)
+ ******************************************************************************/
+void iir_Biquad_Design_LowPass(float * coeffs, float cutoffFreq, float q)
+{
+    float w = 2 * PI * cutoffFreq;
+    float cosw = cosf(w);
+    float alpha = sinf(w) / (2 * q);
+    float a0_inv = 1.0f / (1.0f + alpha);
+
+    coeffs[0] = ((1.0f - cosw) * 0.5f) * a0_inv;    // b0
+    coeffs[1] = (1.0f - cosw) * a0_inv;             // b1
+    coeffs[2] = coeffs[0];                          // b2
+    coeffs[3] = (-2.0f * cosw) * a0_inv;            // a1
+    coeffs[4] = (1.0f - alpha) * a0_inv;            // a2
+}
+
+
+/******************************************************************************
+ *  Biquad - Design a High Pass second order section (float coefficients)
+ *  - Butterworth response when q = 0.7071 (1/sqrt(2))
+ *  - coefficients normalized by a0: b0, b1, b2, a1, a2
+ *
+ *  - INPUT:    float * coeffs          (array to store 5 coefficients)
+ *              float cutoffFreq        (cutoff frequency / sampling frequency - from 0 to 0.5)
+ *              float q                 (quality factor)
+ *
+ *  - RETURN:   N/A (coefficients returned inside the array)
+ ******************************************************************************/
+void iir_Biquad_Design_HighPass(float * coeffs, float cutoffFreq, float q)
+{
+    float w = 2 * PI * cutoffFreq;
+    float cosw = cosf(w);
+    float alpha = sinf(w) / (2 * q);
+    float a0_inv = 1.0f / (1.0f + alpha);
+
+    coeffs[0] = ((1.0f + cosw) * 0.5f) * a0_inv;    // b0
+    coeffs[1] = -(1.0f + cosw) * a0_inv;            // b1
+    coeffs[2] = coeffs[0];                          // b2
+    coeffs[3] = (-2.0f * cosw) * a0_inv;            // a1
+    coeffs[4] = (1.0f - alpha) * a0_inv;            // a2
+}
+
+
+/******************************************************************************
+ *  Biquad - Convert float coefficients to fixed Q(31 - postShift)
+ *  - postShift = 1 (Q30) is enough for low/high pass sections (|a1| < 2)
+ *  - values out of range are saturated
+ *
+ *  - INPUT:    const float * coeffsIn      (float coefficients - 5 per stage)
+ *              int32_t * coeffsOut         (fixed coefficients - 5 per stage)
+ *              uint_fast8_t stages         (number of second order sections)
+ *              uint_fast8_t postShift      (from 0 to 30)
+ *
+ *  - RETURN:   N/A (coefficients returned inside the array)
  ******************************************************************************/
-void goertzelSampleAddInt16_Float(goertzel_sample_float_t * inputStruct, int16_t sample)
+void iir_Biquad_Coeffs_ToFixed(const float * coeffsIn, int32_t * coeffsOut, uint_fast8_t stages, uint_fast8_t postShift)
 {
-    if (inputStruct->counter < inputStruct->size_array)
+    double scale;
+    double value;
+    size_t counter;
+
+    /* same limit of "iir_Biquad_Fixed_Init()" */
+    if (postShift > 30)
     {
-        float s_float = (float)sample + (inputStruct->coeff_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
-        inputStruct->sprev_float2 = inputStruct->sprev_float;
-        inputStruct->sprev_float = s_float;
+        postShift = 30;
+    }
+    scale = (double)(1UL << (31 - postShift));
+
+    for (counter = 0; counter < IIR_BIQUAD_COEFFS_SIZE((size_t)stages); counter++)
+    {
+        value = (double)coeffsIn[counter] * scale;
+        value = (value >= 0) ? (value + 0.5) : (value - 0.5);
 
-        inputStruct->counter++;
-        inputStruct->s_float = s_float;
+        if (value >= 2147483647.0)
+        {
+            coeffsOut[counter] = INT32_MAX;
+        }
+        else if (value <= -2147483648.0)
+        {
+            coeffsOut[counter] = INT32_MIN;
+        }
+        else
+        {
+            coeffsOut[counter] = (int32_t)value;
+        }
     }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Float Math Sample-by-sample Version - Finalize math
- *  - calculate the Real, Imag and Magnitude
+ *  Biquad Cascade - Float - Initialization
+ *  - transposed direct form II - 2 states per section
+ *  - arrays are provided by the user:
+ *      coeffs: "IIR_BIQUAD_COEFFS_SIZE(stages)" elements (b0, b1, b2, a1, a2 per stage)
+ *      state:  "IIR_BIQUAD_STATE_SIZE(stages)" elements
+ *  - coefficients are not copied (can be shared by many filters)
  *
- *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
+ *  - INPUT:    iirBiquadFloat_t * structInput  (pointer to struct with filter parameters)
+ *              const float * coeffs            (array with coefficients)
+ *              float * state                   (array to store filter states)
+ *              uint_fast8_t stages             (number of second order sections - at least 1)
+ *              uint_fast8_t doClean            (clean states)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelSampleCalc_Float(goertzel_sample_float_t * inputStruct)
+void iir_Biquad_Float_Init(iirBiquadFloat_t * structInput, const float * coeffs, float * state, uint_fast8_t stages, uint_fast8_t doClean)
 {
-    float real_float = (inputStruct->sprev_float - inputStruct->sprev_float2 * inputStruct->cr_float);
-    float imag_float = (inputStruct->sprev_float2 * inputStruct->ci_float);
-    inputStruct->real_float = real_float;
-    inputStruct->imag_float = imag_float;
+    size_t counter;
 
-    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float)))/(inputStruct->size_array/2);
-    inputStruct->result = result;
+    structInput->stages = stages;
+    structInput->coeffs = coeffs;
+    structInput->state = state;
 
-    inputStruct->s_float = 0;
-    inputStruct->sprev_float = 0;
-    inputStruct->sprev_float2 = 0;
-    inputStruct->counter = 0;
+    if (doClean)
+    {
+        for (counter = 0; counter < IIR_BIQUAD_STATE_SIZE((size_t)stages); counter++)
+        {
+            state[counter] = 0;
+        }
+        structInput->y = 0;
+    }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Fixed 64 Math Sample-by-sample Version - Initialize Structure Parameters
+ *  Biquad Cascade - Float - Block version (array in, array out)
+ *  - each section filters the whole block with coefficients and states in
+ *    registers, then the next section runs over the output array
+ *  - arrayIn and arrayOut can be the same array (in-place)
  *
- *  - INPUT:    goertzel_sample_fixed64_t* inputStruct  (pointer to struct with parameters)
- *              float bin                               (desired bin - what harmonic)
- *              uint_fast16_t size_array                (array size - number of samples)
- *              uint_fast8_t shift                      (shift size used in fixed math)
+ *  - INPUT:    iirBiquadFloat_t * inputStruct  (pointer to struct with filter parameters)
+ *              const float * arrayIn           (input samples)
+ *              float * arrayOut                (filtered samples)
+ *              size_t size                     (number of samples)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   N/A (filtered samples in arrayOut, last output inside the struct)
  ******************************************************************************/
-void goertzelSampleInit_Fixed64(goertzel_sample_fixed64_t* inputStruct, float bin, uint_fast16_t size_array, uint_fast8_t shift)
+void iir_Biquad_Float_Block(iirBiquadFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size)
 {
-    float w = (2 * PI * bin)/size_array;
-    float cr_float = cosf(w);
-    float ci_float = sinf(w);
+    const float * coeffs = inputStruct->coeffs;
+    float * state = inputStruct->state;
+    const float * source = arrayIn;
+    uint_fast8_t stage;
+    size_t counter;
 
-    inputStruct->cr_fix = (int64_t)(cr_float * (1LL << shift));     // try rounding
-    inputStruct->ci_fix = (int64_t)(ci_float * (1LL << shift));     // try rounding
+    for (stage = 0; stage < inputStruct->stages; stage++)
+    {
+        float b0 = coeffs[0];
+        float b1 = coeffs[1];
+        float b2 = coeffs[2];
+        float a1 = coeffs[3];
+        float a2 = coeffs[4];
+        float s1 = state[0];
+        float s2 = state[1];
 
-    float coeff_float = 2 * cr_float;
-    inputStruct->coeff_fix = (int64_t)(coeff_float * (1LL << shift));
+        for (counter = 0; counter < size; counter++)
+        {
+            float x = source[counter];
+            float y = (b0 * x) + s1;
+            s1 = (b1 * x) - (a1 * y) + s2;
+            s2 = (b2 * x) - (a2 * y);
+            arrayOut[counter] = y;
+        }
 
-    inputStruct->size_array = size_array;
-    inputStruct->shift = shift;
+        state[0] = s1;
+        state[1] = s2;
+        coeffs += 5;
+        state += 2;
+        source = arrayOut;
+    }
+
+    if (size)
+    {
+        inputStruct->y = arrayOut[size - 1];
+    }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Fixed 64 Math Sample-by-sample Version - Add sample (INT16)
- *  - Pre calculate each sample using fixed math
+ *  Biquad Cascade - Fixed (Q31) - Initialization
+ *  - samples in Q31 (or any int32), coefficients in Q(31 - postShift)
+ *  - products and states use 64 bits - no precision loss between sections
+ *  - input must have headroom for the filter gain (output is not saturated)
  *
- *  - INPUT:    goertzel_sample_fixed64_t * inputStruct (pointer to struct with parameters)
- *              int16_t sample                          (input sample)
+ *  - INPUT:    iirBiquadFixed_t * structInput  (pointer to struct with filter parameters)
+ *              const int32_t * coeffs          (array with coefficients - "iir_Biquad_Coeffs_ToFixed()")
+ *              int64_t * state                 (array to store filter states)
+ *              uint_fast8_t stages             (number of second order sections - at least 1)
+ *              uint_fast8_t postShift          (from 0 to 30 - same used in coefficients)
+ *              uint_fast8_t doClean            (clean states)
  *
  *  - RETURN:   N/A (result returned inside the struct)
  ******************************************************************************/
-void goertzelSampleAddInt16_Fixed64(goertzel_sample_fixed64_t * inputStruct, int16_t sample)
+void iir_Biquad_Fixed_Init(iirBiquadFixed_t * structInput, const int32_t * coeffs, int64_t * state, uint_fast8_t stages,
+                           uint_fast8_t postShift, uint_fast8_t doClean)
 {
-    if (inputStruct->counter < inputStruct->size_array)
+    size_t counter;
+
+    /*
+     * prevent shift bigger than 30 (products shifted by 31 - postShift)
+     */
+    if (postShift > 30)
+    {
+        structInput->postShift = 30;
+    }
+    else
     {
-        int_fast16_t shift = inputStruct->shift;
+        structInput->postShift = postShift;
+    }
+
+    structInput->stages = stages;
+    structInput->coeffs = coeffs;
+    structInput->state = state;
 
-        int64_t s_fix = ((int64_t)sample << shift) + ((inputStruct->coeff_fix * inputStruct->sprev_fix) >> shift) - inputStruct->sprev_fix2;
-        inputStruct->sprev_fix2 = inputStruct->sprev_fix;
-        inputStruct->sprev_fix = s_fix;
-        inputStruct->s_fix = s_fix;
+    if (doClean)
+    {
+        for (counter = 0; counter < IIR_BIQUAD_STATE_SIZE((size_t)stages); counter++)
+        {
+            state[counter] = 0;
+        }
+        structInput->y = 0;
     }
 }
 
 
 /******************************************************************************
- *  Goertzel DFT - Fixed 64 Math Sample-by-sample Version - Finalize math
- *  - calculate the Real, Imag and Magnitude - use float math in final step
+ *  Biquad Cascade - Fixed (Q31) - Block version (array in, array out)
+ *  - each section filters the whole block with coefficients and states in
+ *    registers, then the next section runs over the output array
+ *  - arrayIn and arrayOut can be the same array (in-place)
  *
- *  - INPUT:    goertzel_sample_fixed64_t * inputStruct  (pointer to struct with parameters)
+ *  - INPUT:    iirBiquadFixed_t * inputStruct  (pointer to struct with filter parameters)
+ *              const int32_t * arrayIn         (input samples)
+ *              int32_t * arrayOut              (filtered samples)
+ *              size_t size                     (number of samples)
  *
- *  - RETURN:   N/A (result returned inside the struct)
+ *  - RETURN:   N/A (filtered samples in arrayOut, last output inside the struct)
  ******************************************************************************/
-void goertzelSampleCalc_Fixed64(goertzel_sample_fixed64_t * inputStruct)
+void iir_Biquad_Fixed_Block(iirBiquadFixed_t * inputStruct, const int32_t * arrayIn, int32_t * arrayOut, size_t size)
 {
-    int_fast16_t shift = inputStruct->shift;
+    const int32_t * coeffs = inputStruct->coeffs;
+    int64_t * state = inputStruct->state;
+    const int32_t * source = arrayIn;
+    uint_fast8_t shift = 31 - inputStruct->postShift;
+    int64_t roundNumber = (int64_t)1 << (shift - 1);
+    uint_fast8_t stage;
+    size_t counter;
+
+    for (stage = 0; stage < inputStruct->stages; stage++)
+    {
+        int64_t b0 = coeffs[0];
+        int64_t b1 = coeffs[1];
+        int64_t b2 = coeffs[2];
+        int64_t a1 = coeffs[3];
+        int64_t a2 = coeffs[4];
+        int64_t s1 = state[0];
+        int64_t s2 = state[1];
 
-    int64_t real_fix = (inputStruct->sprev_fix - ((inputStruct->sprev_fix2 * inputStruct->cr_fix) >> shift));
-    int64_t imag_fix = (inputStruct->sprev_fix2 * inputStruct->ci_fix) >> shift;
-    inputStruct->real_fix = real_fix;
-    inputStruct->imag_fix = imag_fix;
+        for (counter = 0; counter < size; counter++)
+        {
+            int64_t x = source[counter];
+            int32_t y = (int32_t)(((b0 * x) + s1 + roundNumber) >> shift);
+            s1 = (b1 * x) - (a1 * y) + s2;
+            s2 = (b2 * x) - (a2 * y);
+            arrayOut[counter] = y;
+        }
 
-//    float result = sqrtf((float)((real_fix*real_fix)>>shift) + ((imag_fix*imag_fix)>>shift) );   // two shift
-    float result = sqrtf((float)((((real_fix*real_fix) + (imag_fix*imag_fix)) >> shift)));      // one shift
-    result = result / inputStruct->size_array;
-    result = result * 2;
+        state[0] = s1;
+        state[1] = s2;
+        coeffs += 5;
+        state += 2;
+        source = arrayOut;
+    }
 
-    float result_float = (float)result / (1LL << (shift >> 1)); // sivide by sqrt(Shift). ex.: shift = 10 (2^10), divide by 2^5
-    inputStruct->result = result_float;
+    if (size)
+    {
+        inputStruct->y = arrayOut[size - 1];
+    }
+}
+
+
+
+
+/******************************************************************************
+ *  Biquad Cascade - Float Bank (multi-channel) - Initialization
+ *  - coefficients and states of N channels stored in contiguous arrays (SoA)
+ *      coeffs[(stage * 5 + k) * channels + channel] - "channels * IIR_BIQUAD_COEFFS_SIZE(stages)"
+ *      state[(stage * 2 + k) * channels + channel]  - "channels * IIR_BIQUAD_STATE_SIZE(stages)"
+ *  - arrays are provided by the user
+ *  - all channels start with the same coefficients (see "_Bank_SetChannel()")
+ *
+ *  - INPUT:    iirBiquadFloatBank_t * bankInput    (pointer to struct with bank parameters)
+ *              float * coeffs                      (array to store coefficients)
+ *              float * state                       (array to store filter states)
+ *              uint_fast16_t channels              (number of channels)
+ *              uint_fast8_t stages                 (number of second order sections - at least 1)
+ *              const float * coeffsIn              (coefficients of one channel - 5 per stage)
+ *              uint_fast8_t doClean                (clean states)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Float_Bank_Init(iirBiquadFloatBank_t * bankInput, float * coeffs, float * state, uint_fast16_t channels,
+                                uint_fast8_t stages, const float * coeffsIn, uint_fast8_t doClean)
+{
+    uint_fast16_t counter;
+
+    bankInput->channels = channels;
+    bankInput->stages = stages;
+    bankInput->coeffs = coeffs;
+    bankInput->state = state;
+
+    for (counter = 0; counter < channels; counter++)
+    {
+        iir_Biquad_Float_Bank_SetChannel(bankInput, counter, coeffsIn, doClean);
+    }
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Float Bank (multi-channel) - Set one channel
+ *
+ *  - INPUT:    iirBiquadFloatBank_t * bankInput    (pointer to struct with bank parameters)
+ *              uint_fast16_t channel               (channel index - from 0 to channels-1)
+ *              const float * coeffsIn              (coefficients of the channel - 5 per stage)
+ *              uint_fast8_t doClean                (clean states of the channel)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Float_Bank_SetChannel(iirBiquadFloatBank_t * bankInput, uint_fast16_t channel, const float * coeffsIn, uint_fast8_t doClean)
+{
+    size_t channels = bankInput->channels;
+    size_t counter;
+
+    if (channel >= bankInput->channels)
+    {
+        return;
+    }
+
+    for (counter = 0; counter < IIR_BIQUAD_COEFFS_SIZE((size_t)bankInput->stages); counter++)
+    {
+        bankInput->coeffs[counter * channels + channel] = coeffsIn[counter];
+    }
+
+    if (doClean)
+    {
+        for (counter = 0; counter < IIR_BIQUAD_STATE_SIZE((size_t)bankInput->stages); counter++)
+        {
+            bankInput->state[counter * channels + channel] = 0;
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Float Bank (multi-channel) - Block of frames
+ *  - arrays are interleaved: arrayIn[frame * channels + channel]
+ *  - each section runs over all frames with a group of channels in registers
+ *  - use SSE (4 lanes), AVX (8 lanes) or AVX-512 (16 lanes) across channels -
+ *    selected at runtime
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    iirBiquadFloatBank_t * bankInput    (pointer to struct with bank parameters)
+ *              const float * arrayIn               (interleaved input samples)
+ *              float * arrayOut                    (interleaved filtered samples)
+ *              size_t frames                       (number of frames)
+ *
+ *  - RETURN:   N/A (filtered samples in arrayOut, states inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Float_Bank_Block(iirBiquadFloatBank_t * bankInput, const float * arrayIn, float * arrayOut, size_t frames)
+{
+    dspSimd_Kernels()->iir_Biquad_Float_Bank_Block(bankInput, arrayIn, arrayOut, frames);
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Float Bank (multi-channel) - One frame
+ *  - filter one sample of each channel
+ *
+ *  - INPUT:    iirBiquadFloatBank_t * bankInput    (pointer to struct with bank parameters)
+ *              const float * frameIn               (one input sample per channel)
+ *              float * frameOut                    (one filtered sample per channel)
+ *
+ *  - RETURN:   N/A (filtered samples in frameOut, states inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Float_Bank_Frame(iirBiquadFloatBank_t * bankInput, const float * frameIn, float * frameOut)
+{
+    iir_Biquad_Float_Bank_Block(bankInput, frameIn, frameOut, 1);
+}
+
+
+
+
+/******************************************************************************
+ *  Biquad Cascade - Fixed (Q31) Bank (multi-channel) - Initialization
+ *  - same layout of the float bank, states with 64 bits
+ *  - postShift is shared by all channels
+ *
+ *  - INPUT:    iirBiquadFixedBank_t * bankInput    (pointer to struct with bank parameters)
+ *              int32_t * coeffs                    (array to store coefficients)
+ *              int64_t * state                     (array to store filter states)
+ *              uint_fast16_t channels              (number of channels)
+ *              uint_fast8_t stages                 (number of second order sections - at least 1)
+ *              uint_fast8_t postShift              (from 0 to 30 - same used in coefficients)
+ *              const int32_t * coeffsIn            (coefficients of one channel - 5 per stage)
+ *              uint_fast8_t doClean                (clean states)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Fixed_Bank_Init(iirBiquadFixedBank_t * bankInput, int32_t * coeffs, int64_t * state, uint_fast16_t channels,
+                                uint_fast8_t stages, uint_fast8_t postShift, const int32_t * coeffsIn, uint_fast8_t doClean)
+{
+    uint_fast16_t counter;
+
+    /* same limit of "iir_Biquad_Fixed_Init()" */
+    if (postShift > 30)
+    {
+        bankInput->postShift = 30;
+    }
+    else
+    {
+        bankInput->postShift = postShift;
+    }
+
+    bankInput->channels = channels;
+    bankInput->stages = stages;
+    bankInput->coeffs = coeffs;
+    bankInput->state = state;
+
+    for (counter = 0; counter < channels; counter++)
+    {
+        iir_Biquad_Fixed_Bank_SetChannel(bankInput, counter, coeffsIn, doClean);
+    }
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Fixed (Q31) Bank (multi-channel) - Set one channel
+ *
+ *  - INPUT:    iirBiquadFixedBank_t * bankInput    (pointer to struct with bank parameters)
+ *              uint_fast16_t channel               (channel index - from 0 to channels-1)
+ *              const int32_t * coeffsIn            (coefficients of the channel - 5 per stage)
+ *              uint_fast8_t doClean                (clean states of the channel)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Fixed_Bank_SetChannel(iirBiquadFixedBank_t * bankInput, uint_fast16_t channel, const int32_t * coeffsIn, uint_fast8_t doClean)
+{
+    size_t channels = bankInput->channels;
+    size_t counter;
+
+    if (channel >= bankInput->channels)
+    {
+        return;
+    }
+
+    for (counter = 0; counter < IIR_BIQUAD_COEFFS_SIZE((size_t)bankInput->stages); counter++)
+    {
+        bankInput->coeffs[counter * channels + channel] = coeffsIn[counter];
+    }
+
+    if (doClean)
+    {
+        for (counter = 0; counter < IIR_BIQUAD_STATE_SIZE((size_t)bankInput->stages); counter++)
+        {
+            bankInput->state[counter * channels + channel] = 0;
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Fixed (Q31) Bank (multi-channel) - Block of frames
+ *  - arrays are interleaved: arrayIn[frame * channels + channel]
+ *  - use SSE4.1 (2 lanes), AVX2 (4 lanes) or AVX-512 (8 lanes) of 32x32 -> 64
+ *    bit products across channels - selected at runtime
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    iirBiquadFixedBank_t * bankInput    (pointer to struct with bank parameters)
+ *              const int32_t * arrayIn             (interleaved input samples)
+ *              int32_t * arrayOut                  (interleaved filtered samples)
+ *              size_t frames                       (number of frames)
+ *
+ *  - RETURN:   N/A (filtered samples in arrayOut, states inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Fixed_Bank_Block(iirBiquadFixedBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames)
+{
+    dspSimd_Kernels()->iir_Biquad_Fixed_Bank_Block(bankInput, arrayIn, arrayOut, frames);
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Fixed (Q31) Bank (multi-channel) - One frame
+ *  - filter one sample of each channel
+ *
+ *  - INPUT:    iirBiquadFixedBank_t * bankInput    (pointer to struct with bank parameters)
+ *              const int32_t * frameIn             (one input sample per channel)
+ *              int32_t * frameOut                  (one filtered sample per channel)
+ *
+ *  - RETURN:   N/A (filtered samples in frameOut, states inside the struct)
+ ******************************************************************************/
+void iir_Biquad_Fixed_Bank_Frame(iirBiquadFixedBank_t * bankInput, const int32_t * frameIn, int32_t * frameOut)
+{
+    iir_Biquad_Fixed_Bank_Block(bankInput, frameIn, frameOut, 1);
+}
+
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Array Version - Initialize Structure Parameters (FLOAT)
+ *
+ *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
+ *              float bin                               (desired bin - what harmonic)
+ *              uint_fast16_t size_array                (array size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelArrayInit_Float(goertzel_array_float_t * inputStruct, float bin, uint_fast16_t size_array)
+{
+    float w = (2 * PI * bin)/size_array;
+    inputStruct->cr_float = cosf(w);
+    inputStruct->ci_float = sinf(w);
+
+    inputStruct->coeff_float = 2 * inputStruct->cr_float;
+    inputStruct->size_array = size_array;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Array Version - Do the Math (FLOAT INPUT)
+ *  - Calculate the amplitude of a desired bin (frequency) of a wave
+ *
+ *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
+ *              const float * arrayInput                (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelArrayFloat_Float(goertzel_array_float_t * inputStruct, const float * arrayInput)
+{
+    float s_float = 0;
+    float sprev_float = 0;
+    float sprev_float2 = 0;
+
+    uint_fast16_t size_array = inputStruct->size_array;
+
+    uint_fast16_t i;
+    for (i = 0; i < size_array ; i++)
+    {
+        s_float = arrayInput[i] + (inputStruct->coeff_float * sprev_float) - sprev_float2;
+        sprev_float2 = sprev_float;
+        sprev_float = s_float;
+    }
+
+    float real_float = (sprev_float - sprev_float2 * inputStruct->cr_float);
+    float imag_float = (sprev_float2 * inputStruct->ci_float);
+    inputStruct->real_float = real_float;
+    inputStruct->imag_float = imag_float;
+
+    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float)))/(size_array/2);
+    inputStruct->result = result;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Array Version - Do the Math (INT16 INPUT)
+ *  - Calculate the amplitude of a desired bin (frequency) of a wave
+ *
+ *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
+ *              const int16_t * arrayInput              (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelArrayInt16_Float(goertzel_array_float_t * inputStruct, const int16_t * arrayInput)
+{
+    float s_float = 0;
+    float sprev_float = 0;
+    float sprev_float2 = 0;
+
+    uint_fast16_t size_array = inputStruct->size_array;
+
+    uint_fast16_t i;
+    for (i = 0; i < size_array ; i++)
+    {
+        s_float = (float)arrayInput[i] + inputStruct->coeff_float * sprev_float - sprev_float2;
+        sprev_float2 = sprev_float;
+        sprev_float = s_float;
+    }
+
+    float real_float = (sprev_float - sprev_float2 * inputStruct->cr_float);
+    float imag_float = (sprev_float2 * inputStruct->ci_float);
+    inputStruct->real_float = real_float;
+    inputStruct->imag_float = imag_float;
+
+//    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float))) / ((float)size_array/2.0f);   // waste more time
+//    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float))) / (size_array/2);
+    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float)));        // extract square root
+    result = result / size_array;                   // divide by the total of samples
+    result = result * 2.0f;                         // multiply by 2
+    inputStruct->result = result;                   // store in the struct
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Segments - Initialize Structure Parameters
+ *  - w, cos, sin and coefficient calculated in double from bin / size_array:
+ *    on long arrays the float coefficient of "goertzelArrayInit_Float()"
+ *    is the main error (e.g. 2*cos(w) rounds to 2.0 for low bins of a 10M
+ *    samples array)
+ *
+ *  - INPUT:    goertzel_segmented_float_t * inputStruct    (pointer to struct with parameters)
+ *              double bin                                  (bin - cycles in the array)
+ *              size_t size_array                           (samples of the array)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void goertzelSegmentedInit_Float(goertzel_segmented_float_t * inputStruct, double bin, size_t size_array)
+{
+    inputStruct->w = (2.0 * 3.14159265358979323846 * bin) / (double)size_array;
+    inputStruct->cr = cos(inputStruct->w);
+    inputStruct->ci = sin(inputStruct->w);
+
+    inputStruct->coeff = 2.0 * inputStruct->cr;
+    inputStruct->size_array = size_array;
+    inputStruct->real_float = 0.0f;
+    inputStruct->imag_float = 0.0f;
+    inputStruct->result = 0.0f;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Segments - state = e^(j*w*size) * state + partial (internal)
+ *  - state Y = sum x[k]*e^(j*w*(n - k)), referenced to the last sample n
+ *    (the "real" and "imag" of the Goertzel): appending "size" samples
+ *    rotates it by e^(j*w*size) - rotation = [cos, sin] of w*size
+ ******************************************************************************/
+static inline void goertzelSegment_Append(const double * rotation, double * state, double re, double im)
+{
+    double s0 = state[0];
+    double s1 = state[1];
+    state[0] = (rotation[0] * s0) - (rotation[1] * s1) + re;
+    state[1] = (rotation[1] * s0) + (rotation[0] * s1) + im;
+}
+
+/******************************************************************************
+ *  Goertzel DFT - Segments - GOERTZEL_SEGMENT_LANES recursions of "length"
+ *  samples from zero state (double), appended to the state (internal)
+ *  - short recursions: s(n-1) and s(n-2) stay small, little cancellation
+ *    in s(n-1) - e^(-j*w)*s(n-2) even for bins close to zero
+ ******************************************************************************/
+static void goertzelSegment_Lanes(const goertzel_segmented_float_t * inputStruct, const double * rotation,
+                                  const int16_t * arrayInput, size_t length, double * state)
+{
+    const double coeff = inputStruct->coeff;
+    double sprev[GOERTZEL_SEGMENT_LANES] = {0};
+    double sprev2[GOERTZEL_SEGMENT_LANES] = {0};
+    size_t i, k;
+
+    for (i = 0; i < length; i++)
+    {
+        for (k = 0; k < GOERTZEL_SEGMENT_LANES; k++)
+        {
+            double s = (double)arrayInput[(k * length) + i] + coeff * sprev[k] - sprev2[k];
+            sprev2[k] = sprev[k];
+            sprev[k] = s;
+        }
+    }
+    for (k = 0; k < GOERTZEL_SEGMENT_LANES; k++)
+    {
+        goertzelSegment_Append(rotation, state, sprev[k] - (sprev2[k] * inputStruct->cr), sprev2[k] * inputStruct->ci);
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Segments - State of a segment (INT16 INPUT)
+ *  - partial DFT of "size" samples, independent of the other segments
+ *    (threads, cores) - [real, imag] referenced to the last sample of the
+ *    segment (same "real" and "imag" of the Goertzel of the segment alone)
+ *  - split in GOERTZEL_SEGMENT_LANES interleaved recursions of up to
+ *    GOERTZEL_SEGMENT_LENGTH samples (independent - SIMD lanes / pipelined
+ *    FPU), joined by the rotation e^(j*w*length) - no long recursion, so
+ *    the error does not grow with the size of the array
+ *
+ *  - INPUT:    const goertzel_segmented_float_t * inputStruct  (pointer to struct with parameters)
+ *              const int16_t * arrayInput                      (first sample of the segment)
+ *              size_t size                                     (samples of the segment)
+ *              double * state                                  (returns [real, imag] - 2 doubles)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void goertzelSegmentStateInt16_Float(const goertzel_segmented_float_t * inputStruct, const int16_t * arrayInput, size_t size, double * state)
+{
+    const size_t chunk = GOERTZEL_SEGMENT_LANES * GOERTZEL_SEGMENT_LENGTH;
+    double rotation[2];
+    double s = 0.0, sprev = 0.0, sprev2 = 0.0;
+    size_t length, i;
+
+    state[0] = 0.0;
+    state[1] = 0.0;
+
+    /* full chunks - same length, rotation calculated once */
+    if (size >= chunk)
+    {
+        rotation[0] = cos(inputStruct->w * GOERTZEL_SEGMENT_LENGTH);
+        rotation[1] = sin(inputStruct->w * GOERTZEL_SEGMENT_LENGTH);
+        while (size >= chunk)
+        {
+            goertzelSegment_Lanes(inputStruct, rotation, arrayInput, GOERTZEL_SEGMENT_LENGTH, state);
+            arrayInput += chunk;
+            size -= chunk;
+        }
+    }
+
+    /* last chunk - shorter lanes */
+    length = size / GOERTZEL_SEGMENT_LANES;
+    if (length >= GOERTZEL_SEGMENT_MIN_LANE)
+    {
+        rotation[0] = cos(inputStruct->w * (double)length);
+        rotation[1] = sin(inputStruct->w * (double)length);
+        goertzelSegment_Lanes(inputStruct, rotation, arrayInput, length, state);
+        arrayInput += GOERTZEL_SEGMENT_LANES * length;
+        size -= GOERTZEL_SEGMENT_LANES * length;
+    }
+
+    /* remaining samples - serial, appended as one more segment */
+    if (size > 0)
+    {
+        for (i = 0; i < size; i++)
+        {
+            s = (double)arrayInput[i] + (inputStruct->coeff * sprev) - sprev2;
+            sprev2 = sprev;
+            sprev = s;
+        }
+        rotation[0] = cos(inputStruct->w * (double)size);
+        rotation[1] = sin(inputStruct->w * (double)size);
+        goertzelSegment_Append(rotation, state, sprev - (sprev2 * inputStruct->cr), sprev2 * inputStruct->ci);
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Segments - Append a segment to the state
+ *  - state after the previous segments followed by "size" samples whose
+ *    state alone is "partial" (goertzelSegmentStateInt16_Float)
+ *  - segments combined in order (first to last)
+ *
+ *  - INPUT:    const goertzel_segmented_float_t * inputStruct  (pointer to struct with parameters)
+ *              double * state                                  (state of previous segments - start with {0, 0})
+ *              const double * partial                          (state of the segment alone)
+ *              size_t size                                     (samples of the segment)
+ *
+ *  - RETURN:   N/A (result returned in "state")
+ ******************************************************************************/
+void goertzelSegmentCombine_Float(const goertzel_segmented_float_t * inputStruct, double * state, const double * partial, size_t size)
+{
+    double rotation[2];
+
+    rotation[0] = cos(inputStruct->w * (double)size);
+    rotation[1] = sin(inputStruct->w * (double)size);
+    goertzelSegment_Append(rotation, state, partial[0], partial[1]);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Segments - Result from the final state
+ *  - same outputs of "goertzelArrayInt16_Float()" (real, imag and result)
+ *
+ *  - INPUT:    goertzel_segmented_float_t * inputStruct    (pointer to struct with parameters)
+ *              const double * state                        (state after all "size_array" samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSegmentResult_Float(goertzel_segmented_float_t * inputStruct, const double * state)
+{
+    inputStruct->real_float = (float)state[0];
+    inputStruct->imag_float = (float)state[1];
+    inputStruct->result = (float)((2.0 * sqrt((state[0] * state[0]) + (state[1] * state[1]))) / (double)inputStruct->size_array);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Array Version - Segments (INT16 INPUT)
+ *  - long arrays (up to millions of samples): the serial recursion is
+ *    split in GOERTZEL_SEGMENT_LANES independent short recursions (no
+ *    dependency between them - SIMD lanes or pipelined FPU) joined by the
+ *    rotation of their partial DFTs
+ *  - double coefficients (goertzelSegmentedInit_Float), recursions and
+ *    state: close to a double precision DFT at any size, while the float
+ *    "goertzelArrayInt16_Float()" loses precision above ~64k samples
+ *  - multiple cores: "dspPoolGoertzelInt16_Float()" (DSP_and_Math_threads.h)
+ *
+ *  - INPUT:    goertzel_segmented_float_t * inputStruct    (pointer to struct with parameters)
+ *              const int16_t * arrayInput                  (pointer to array with "size_array" samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelArraySegmentedInt16_Float(goertzel_segmented_float_t * inputStruct, const int16_t * arrayInput)
+{
+    double state[2];
+
+    goertzelSegmentStateInt16_Float(inputStruct, arrayInput, inputStruct->size_array, state);
+    goertzelSegmentResult_Float(inputStruct, state);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Fixed 64 Math Array Version - Initialize Structure Parameters (FIXED64)
+ *
+ *  - INPUT:    goertzel_array_fixed64_t * inputStruct  (pointer to struct with parameters)
+ *              float bin                               (desired bin - what harmonic)
+ *              uint_fast16_t size_array                (array size - number of samples)
+ *              uint_fast8_t shift                      (shift size used in fixed math)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelArrayInit_Fixed64(goertzel_array_fixed64_t * inputStruct, float bin, uint_fast16_t size_array, uint_fast8_t shift)
+{
+    float w = (2 * PI * bin)/size_array;
+    float cr_float = cosf(w);
+    float ci_float = sinf(w);
+
+    inputStruct->cr_fix = (int64_t)(cr_float * (1LL << shift));     // try rounding
+    inputStruct->ci_fix = (int64_t)(ci_float * (1LL << shift));     // try rounding
+
+    float coeff_float = 2 * cr_float;
+    inputStruct->coeff_fix = (int64_t)(coeff_float * (1LL << shift));
+
+    inputStruct->size_array = size_array;
+    inputStruct->shift = shift;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Fixed 64 Math Array Version - Do the Math (INT16 INPUT)
+ *  - Calculate the amplitude of a desired bin (frequency) of a wave
+ *
+ *  - INPUT:    goertzel_array_float_t * inputStruct    (pointer to struct with parameters)
+ *              const int16_t * arrayInput              (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelArrayInt16_Fixed64(goertzel_array_fixed64_t * inputStruct, const int16_t * arrayInput)
+{
+    int64_t s_fix = 0;
+    int64_t sprev_fix = 0;
+    int64_t sprev_fix2 = 0;
+
+    uint_fast16_t size_array = inputStruct->size_array;
+    uint_fast8_t shift = inputStruct->shift;
+
+    uint_fast16_t i;
+    for (i = (0); i < size_array ; i++)
+    {
+        s_fix = ((int64_t)arrayInput[i] << shift) + ((int64_t)(inputStruct->coeff_fix * sprev_fix) >> shift) - sprev_fix2;
+        sprev_fix2 = sprev_fix;
+        sprev_fix = s_fix;
+    }
+
+    int64_t real_fix = (sprev_fix - ((sprev_fix2 * inputStruct->cr_fix) >> shift));
+    int64_t imag_fix = (sprev_fix2 * inputStruct->ci_fix) >> shift;
+
+    inputStruct->real_fix = real_fix;
+    inputStruct->imag_fix = imag_fix;
+
+    //    float result = sqrtf((float)((real_fix*real_fix)>>shift) + ((imag_fix*imag_fix)>>shift) );   // two shift
+    float result = sqrtf((float)((((real_fix*real_fix) + (imag_fix*imag_fix)) >> shift)));      // one shift
+    result = result / inputStruct->size_array;
+    result = result * 2;
+
+
+    float result_float = (float)result / (1LL << (shift >> 1)); // divide pela raiz quadarda de Shift. ex.: shift = 10 (2^10), divide por 2^5
+    inputStruct->result = result_float;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank Version - Initialize Structure Parameters (FLOAT)
+ *  - evaluate K bins of the same array with a single read of the input
+ *  - parameters of all bins stored in contiguous arrays (SoA)
+ *  - "buffer" is provided by the user: GOERTZEL_BANK_BUFFER_SIZE(bins) floats
+ *
+ *  - INPUT:    goertzel_bank_float_t * inputStruct     (pointer to struct with parameters)
+ *              float * buffer                          (memory used to store the bins parameters)
+ *              const float * binList                   (array with desired bins - what harmonics)
+ *              uint_fast16_t bins                      (number of bins)
+ *              uint_fast16_t size_array                (array size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelBankInit_Float(goertzel_bank_float_t * inputStruct, float * buffer, const float * binList,
+                            uint_fast16_t bins, uint_fast16_t size_array)
+{
+    uint_fast16_t k;
+
+    inputStruct->bins = bins;
+    inputStruct->size_array = size_array;
+
+    inputStruct->coeff_float = &buffer[0 * bins];
+    inputStruct->cr_float = &buffer[1 * bins];
+    inputStruct->ci_float = &buffer[2 * bins];
+    inputStruct->sprev_float = &buffer[3 * bins];
+    inputStruct->sprev_float2 = &buffer[4 * bins];
+    inputStruct->real_float = &buffer[5 * bins];
+    inputStruct->imag_float = &buffer[6 * bins];
+    inputStruct->result = &buffer[7 * bins];
+
+    for (k = 0; k < bins; k++)
+    {
+        float w = (2 * PI * binList[k])/size_array;
+        inputStruct->cr_float[k] = cosf(w);
+        inputStruct->ci_float[k] = sinf(w);
+        inputStruct->coeff_float[k] = 2 * inputStruct->cr_float[k];
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank Version - Finalize math (internal)
+ *  - calculate the Real, Imag and Magnitude of all bins
+ ******************************************************************************/
+static void goertzelBankCalc_Float(goertzel_bank_float_t * inputStruct)
+{
+    uint_fast16_t k;
+    float scale = 2.0f / inputStruct->size_array;
+
+    for (k = 0; k < inputStruct->bins; k++)
+    {
+        float real_float = (inputStruct->sprev_float[k] - inputStruct->sprev_float2[k] * inputStruct->cr_float[k]);
+        float imag_float = (inputStruct->sprev_float2[k] * inputStruct->ci_float[k]);
+        inputStruct->real_float[k] = real_float;
+        inputStruct->imag_float[k] = imag_float;
+        inputStruct->result[k] = sqrtf((real_float*real_float)+(imag_float*imag_float)) * scale;
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank Version - Do the Math (FLOAT INPUT)
+ *  - Calculate the amplitude of all bins reading the input array only once
+ *  - SSE (4 bins), AVX (8 bins) or AVX-512 (16 bins) lanes selected at runtime
+ *
+ *  - INPUT:    goertzel_bank_float_t * inputStruct     (pointer to struct with parameters)
+ *              const float * arrayInput                (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (results returned inside the struct - one per bin)
+ ******************************************************************************/
+void goertzelBankFloat_Float(goertzel_bank_float_t * inputStruct, const float * arrayInput)
+{
+    dspSimd_Kernels()->goertzelBankFloat_Float(inputStruct, arrayInput);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank Version - Do the Math (INT16 INPUT)
+ *  - Calculate the amplitude of all bins reading the input array only once
+ *  - SSE (4 bins), AVX (8 bins) or AVX-512 (16 bins) lanes selected at runtime
+ *
+ *  - INPUT:    goertzel_bank_float_t * inputStruct     (pointer to struct with parameters)
+ *              const int16_t * arrayInput              (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (results returned inside the struct - one per bin)
+ ******************************************************************************/
+void goertzelBankInt16_Float(goertzel_bank_float_t * inputStruct, const int16_t * arrayInput)
+{
+    dspSimd_Kernels()->goertzelBankInt16_Float(inputStruct, arrayInput);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Sample-by-sample Version - Initialize Structure Parameters
+ *
+ *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
+ *              float bin                               (desired bin - what harmonic)
+ *              uint_fast16_t size_array                (array size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSampleInit_Float(goertzel_sample_float_t * inputStruct, float bin, uint_fast16_t size_array)
+{
+    float w = (2 * PI * bin)/size_array;
+    inputStruct->cr_float = cosf(w);
+    inputStruct->ci_float = sinf(w);
+
+    inputStruct->coeff_float = 2 * inputStruct->cr_float;
+    inputStruct->size_array = size_array;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Sample-by-sample Version - Finalize math
+ *  - calculate the Real, Imag and Magnitude
+ *
+ *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSampleCalc_Float(goertzel_sample_float_t * inputStruct)
+{
+    float real_float = (inputStruct->sprev_float - inputStruct->sprev_float2 * inputStruct->cr_float);
+    float imag_float = (inputStruct->sprev_float2 * inputStruct->ci_float);
+    inputStruct->real_float = real_float;
+    inputStruct->imag_float = imag_float;
+
+    float result = (sqrtf((real_float*real_float)+(imag_float*imag_float)))/(inputStruct->size_array/2);
+    inputStruct->result = result;
+
+    inputStruct->s_float = 0;
+    inputStruct->sprev_float = 0;
+    inputStruct->sprev_float2 = 0;
+    inputStruct->counter = 0;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Fixed 64 Math Sample-by-sample Version - Initialize Structure Parameters
+ *
+ *  - INPUT:    goertzel_sample_fixed64_t* inputStruct  (pointer to struct with parameters)
+ *              float bin                               (desired bin - what harmonic)
+ *              uint_fast16_t size_array                (array size - number of samples)
+ *              uint_fast8_t shift                      (shift size used in fixed math)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSampleInit_Fixed64(goertzel_sample_fixed64_t* inputStruct, float bin, uint_fast16_t size_array, uint_fast8_t shift)
+{
+    float w = (2 * PI * bin)/size_array;
+    float cr_float = cosf(w);
+    float ci_float = sinf(w);
+
+    inputStruct->cr_fix = (int64_t)(cr_float * (1LL << shift));     // try rounding
+    inputStruct->ci_fix = (int64_t)(ci_float * (1LL << shift));     // try rounding
+
+    float coeff_float = 2 * cr_float;
+    inputStruct->coeff_fix = (int64_t)(coeff_float * (1LL << shift));
+
+    inputStruct->size_array = size_array;
+    inputStruct->shift = shift;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Fixed 64 Math Sample-by-sample Version - Finalize math
+ *  - calculate the Real, Imag and Magnitude - use float math in final step
+ *
+ *  - INPUT:    goertzel_sample_fixed64_t * inputStruct  (pointer to struct with parameters)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSampleCalc_Fixed64(goertzel_sample_fixed64_t * inputStruct)
+{
+    int_fast16_t shift = inputStruct->shift;
+
+    int64_t real_fix = (inputStruct->sprev_fix - ((inputStruct->sprev_fix2 * inputStruct->cr_fix) >> shift));
+    int64_t imag_fix = (inputStruct->sprev_fix2 * inputStruct->ci_fix) >> shift;
+    inputStruct->real_fix = real_fix;
+    inputStruct->imag_fix = imag_fix;
+
+//    float result = sqrtf((float)((real_fix*real_fix)>>shift) + ((imag_fix*imag_fix)>>shift) );   // two shift
+    float result = sqrtf((float)((((real_fix*real_fix) + (imag_fix*imag_fix)) >> shift)));      // one shift
+    result = result / inputStruct->size_array;
+    result = result * 2;
+
+    float result_float = (float)result / (1LL << (shift >> 1)); // sivide by sqrt(Shift). ex.: shift = 10 (2^10), divide by 2^5
+    inputStruct->result = result_float;
+
+    inputStruct->s_fix = 0;
+    inputStruct->sprev_fix = 0;
+    inputStruct->sprev_fix2 = 0;
+    inputStruct->counter = 0;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Sliding DFT Float Version - Initialize Structure Parameters
+ *  - keep the last N samples in a ring buffer provided by the user
+ *  - the bin is updated in O(1) for each new sample (no need to wait N samples)
+ *  - a Goertzel recursion runs in parallel and resynchronize the bin every N
+ *    samples, removing the accumulated rounding error (no drift)
+ *
+ *  - INPUT:    goertzel_sliding_float_t * inputStruct  (pointer to struct with parameters)
+ *              float * buffer                          (ring buffer - array with size_array elements)
+ *              float bin                               (desired bin - what harmonic)
+ *              uint_fast16_t size_array                (window size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSlidingInit_Float(goertzel_sliding_float_t * inputStruct, float * buffer, float bin, uint_fast16_t size_array)
+{
+    uint_fast16_t i;
+    float w = (2 * PI * bin)/size_array;
+
+    inputStruct->size_array = size_array;
+    inputStruct->index = 0;
+    inputStruct->buffer = buffer;
+    for (i = 0; i < size_array; i++)
+    {
+        buffer[i] = 0;
+    }
+
+    inputStruct->cr_float = cosf(w);
+    inputStruct->ci_float = sinf(w);
+    inputStruct->coeff_float = 2 * inputStruct->cr_float;
+    inputStruct->sprev_float = 0;
+    inputStruct->sprev_float2 = 0;
+
+    inputStruct->real_float = 0;
+    inputStruct->imag_float = 0;
+    inputStruct->result = 0;
+    inputStruct->phase_rad = 0;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Sliding DFT Float Version - Add sample (FLOAT)
+ *  - X = e^(jw) * (X + sample - oldest_sample)
+ *  - after this call "real_float" and "imag_float" contain the DFT bin of the
+ *    last N samples (see "goertzelSlidingCalc_Float()" to magnitude/phase)
+ *
+ *  - INPUT:    goertzel_sliding_float_t * inputStruct  (pointer to struct with parameters)
+ *              float sample                            (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSlidingAddFloat_Float(goertzel_sliding_float_t * inputStruct, float sample)
+{
+    uint_fast16_t index = inputStruct->index;
+    float comb = sample - inputStruct->buffer[index];
+    float real_float = inputStruct->real_float + comb;
+    float imag_float = inputStruct->imag_float;
+
+    inputStruct->buffer[index] = sample;
+    if (++index >= inputStruct->size_array)
+    {
+        index = 0;
+    }
+    inputStruct->index = index;
+
+    inputStruct->real_float = (real_float * inputStruct->cr_float) - (imag_float * inputStruct->ci_float);
+    inputStruct->imag_float = (real_float * inputStruct->ci_float) + (imag_float * inputStruct->cr_float);
+
+    /* goertzel over the current window - used to resynchronize the bin */
+    float s_float = sample + (inputStruct->coeff_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
+    inputStruct->sprev_float2 = inputStruct->sprev_float;
+    inputStruct->sprev_float = s_float;
+
+    /* window complete - replace the bin by the exact value: X = e^(jw)*s1 - s2 */
+    if (index == 0)
+    {
+        inputStruct->real_float = (inputStruct->cr_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
+        inputStruct->imag_float = (inputStruct->ci_float * inputStruct->sprev_float);
+        inputStruct->sprev_float = 0;
+        inputStruct->sprev_float2 = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Sliding DFT Float Version - Calculate magnitude and phase
+ *  - can be called after any sample - the state is not changed
+ *  - phase is referenced to the oldest sample of the window (integer bins)
+ *
+ *  - INPUT:    goertzel_sliding_float_t * inputStruct  (pointer to struct with parameters)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSlidingCalc_Float(goertzel_sliding_float_t * inputStruct)
+{
+    float real_float = inputStruct->real_float;
+    float imag_float = inputStruct->imag_float;
+
+    inputStruct->result = (sqrtf((real_float*real_float)+(imag_float*imag_float)) * 2.0f) / inputStruct->size_array;
+    inputStruct->phase_rad = atan2f(imag_float, real_float);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Sliding DFT Int16 Version - Initialize Structure Parameters
+ *  - same of float version, but the ring buffer store int16_t samples
+ *
+ *  - INPUT:    goertzel_sliding_int16_t * inputStruct  (pointer to struct with parameters)
+ *              int16_t * buffer                        (ring buffer - array with size_array elements)
+ *              float bin                               (desired bin - what harmonic)
+ *              uint_fast16_t size_array                (window size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSlidingInit_Int16(goertzel_sliding_int16_t * inputStruct, int16_t * buffer, float bin, uint_fast16_t size_array)
+{
+    uint_fast16_t i;
+    float w = (2 * PI * bin)/size_array;
+
+    inputStruct->size_array = size_array;
+    inputStruct->index = 0;
+    inputStruct->buffer = buffer;
+    for (i = 0; i < size_array; i++)
+    {
+        buffer[i] = 0;
+    }
+
+    inputStruct->cr_float = cosf(w);
+    inputStruct->ci_float = sinf(w);
+    inputStruct->coeff_float = 2 * inputStruct->cr_float;
+    inputStruct->sprev_float = 0;
+    inputStruct->sprev_float2 = 0;
+
+    inputStruct->real_float = 0;
+    inputStruct->imag_float = 0;
+    inputStruct->result = 0;
+    inputStruct->phase_rad = 0;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Sliding DFT Int16 Version - Add sample (INT16)
+ *  - X = e^(jw) * (X + sample - oldest_sample)
+ *
+ *  - INPUT:    goertzel_sliding_int16_t * inputStruct  (pointer to struct with parameters)
+ *              int16_t sample                          (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSlidingAddInt16_Float(goertzel_sliding_int16_t * inputStruct, int16_t sample)
+{
+    uint_fast16_t index = inputStruct->index;
+    float comb = (float)sample - (float)inputStruct->buffer[index];
+    float real_float = inputStruct->real_float + comb;
+    float imag_float = inputStruct->imag_float;
+
+    inputStruct->buffer[index] = sample;
+    if (++index >= inputStruct->size_array)
+    {
+        index = 0;
+    }
+    inputStruct->index = index;
+
+    inputStruct->real_float = (real_float * inputStruct->cr_float) - (imag_float * inputStruct->ci_float);
+    inputStruct->imag_float = (real_float * inputStruct->ci_float) + (imag_float * inputStruct->cr_float);
+
+    /* goertzel over the current window - used to resynchronize the bin */
+    float s_float = (float)sample + (inputStruct->coeff_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
+    inputStruct->sprev_float2 = inputStruct->sprev_float;
+    inputStruct->sprev_float = s_float;
+
+    /* window complete - replace the bin by the exact value: X = e^(jw)*s1 - s2 */
+    if (index == 0)
+    {
+        inputStruct->real_float = (inputStruct->cr_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
+        inputStruct->imag_float = (inputStruct->ci_float * inputStruct->sprev_float);
+        inputStruct->sprev_float = 0;
+        inputStruct->sprev_float2 = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Sliding DFT Int16 Version - Calculate magnitude and phase
+ *  - can be called after any sample - the state is not changed
+ *  - phase is referenced to the oldest sample of the window (integer bins)
+ *
+ *  - INPUT:    goertzel_sliding_int16_t * inputStruct  (pointer to struct with parameters)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void goertzelSlidingCalcInt16_Float(goertzel_sliding_int16_t * inputStruct)
+{
+    float real_float = inputStruct->real_float;
+    float imag_float = inputStruct->imag_float;
+
+    inputStruct->result = (sqrtf((real_float*real_float)+(imag_float*imag_float)) * 2.0f) / inputStruct->size_array;
+    inputStruct->phase_rad = atan2f(imag_float, real_float);
+}
+
+
+
+
+/******************************************************************************
+ *  FFT - Calculate the tables of a complex transform (internal)
+ *  - twiddles W_m^k = e^(-j*2*pi*k/m), k < m/2, of each span m = 2..size,
+ *    table of span m starts at twiddle[m - 2] (size - 1 complex values)
+ *  - calculated in double, rounded once to float
+ *
+ *  - RETURN:   log2(size) or 0 if size is not a power of two (size >= 2)
+ ******************************************************************************/
+static uint_fast8_t fftPlanTables_Float(float * twiddle, uint32_t * bitrev, uint32_t size)
+{
+    uint_fast8_t log2size = 0;
+    uint32_t i, k, m;
+
+    if ((size < 2) || ((size & (size - 1)) != 0))
+    {
+        return 0;
+    }
+    while ((1UL << log2size) < size)
+    {
+        log2size++;
+    }
+
+    for (i = 0; i < size; i++)
+    {
+        uint32_t rev = 0;
+        uint32_t x = i;
+        for (k = 0; k < log2size; k++)
+        {
+            rev = (rev << 1) | (x & 1);
+            x >>= 1;
+        }
+        bitrev[i] = rev;
+    }
+
+    for (m = 2; m <= size; m <<= 1)
+    {
+        float * w = &twiddle[m - 2];
+        for (k = 0; k < m / 2; k++)
+        {
+            double angle = (2.0 * 3.14159265358979323846 * k) / m;
+            w[2 * k] = (float)cos(angle);
+            w[2 * k + 1] = (float)(-sin(angle));
+        }
+    }
+    return log2size;
+}
+
+
+/******************************************************************************
+ *  FFT - Complex Plan - Initialize Structure Parameters
+ *  - twiddles and bit reversal calculated once, reused by every transform
+ *  - "twiddle" is provided by the user: FFT_TWIDDLE_SIZE(size) floats
+ *  - "bitrev" is provided by the user: FFT_BITREV_SIZE(size) uint32_t
+ *
+ *  - INPUT:    fft_plan_float_t * plan                 (pointer to struct with parameters)
+ *              float * twiddle                         (memory used to store the twiddles)
+ *              uint32_t * bitrev                       (memory used to store the bit reversal)
+ *              uint32_t size                           (number of complex points - power of two >= 2)
+ *
+ *  - RETURN:   1 if ok, 0 if size is not valid
+ ******************************************************************************/
+uint_fast8_t fftPlanInit_Float(fft_plan_float_t * plan, float * twiddle, uint32_t * bitrev, uint32_t size)
+{
+    uint_fast8_t log2size = fftPlanTables_Float(twiddle, bitrev, size);
+
+    if (log2size == 0)
+    {
+        return 0;
+    }
+    plan->size = size;
+    plan->size_complex = size;
+    plan->log2size = log2size;
+    plan->twiddle = twiddle;
+    plan->twiddle_real = NULL;
+    plan->bitrev = bitrev;
+    return 1;
+}
+
+
+/******************************************************************************
+ *  FFT - Real Input Plan - Initialize Structure Parameters
+ *  - "size" real samples are transformed as size/2 complex points, plus the
+ *    twiddles W_size^k (k = 0..size/4) used to split the spectrum
+ *  - same buffers of the complex plan: FFT_TWIDDLE_SIZE(size) floats and
+ *    FFT_BITREV_SIZE(size) uint32_t
+ *
+ *  - INPUT:    fft_plan_float_t * plan                 (pointer to struct with parameters)
+ *              float * twiddle                         (memory used to store the twiddles)
+ *              uint32_t * bitrev                       (memory used to store the bit reversal)
+ *              uint32_t size                           (number of real samples - power of two >= 4)
+ *
+ *  - RETURN:   1 if ok, 0 if size is not valid
+ ******************************************************************************/
+uint_fast8_t fftRealPlanInit_Float(fft_plan_float_t * plan, float * twiddle, uint32_t * bitrev, uint32_t size)
+{
+    uint32_t half = size / 2;
+    uint32_t k;
+    float * w = &twiddle[2 * half];
+    uint_fast8_t log2size = fftPlanTables_Float(twiddle, bitrev, half);
+
+    if ((log2size == 0) || (size != 2 * half))
+    {
+        return 0;
+    }
+    for (k = 0; k <= half / 2; k++)
+    {
+        double angle = (2.0 * 3.14159265358979323846 * k) / size;
+        w[2 * k] = (float)cos(angle);
+        w[2 * k + 1] = (float)(-sin(angle));
+    }
+
+    plan->size = size;
+    plan->size_complex = half;
+    plan->log2size = log2size;
+    plan->twiddle = twiddle;
+    plan->twiddle_real = w;
+    plan->bitrev = bitrev;
+    return 1;
+}
+
+
+/******************************************************************************
+ *  FFT - Complex Forward Transform (in place)
+ *  - X[k] = sum x[n]*e^(-j*2*pi*k*n/N), no scaling
+ *  - radix-4 butterflies (radix-2 first stage if log2(N) is odd)
+ *  - SSE (2 points), AVX (4 points) or AVX-512 (8 points) selected at runtime
+ *
+ *  - INPUT:    const fft_plan_float_t * plan           (pointer to the plan - complex or real)
+ *              float * data                            (N complex points - re, im interleaved)
+ *
+ *  - RETURN:   N/A (spectrum returned in "data")
+ ******************************************************************************/
+void fftComplex_Float(const fft_plan_float_t * plan, float * data)
+{
+    dspSimd_Kernels()->fftComplex_Float(plan, data);
+}
+
+
+/******************************************************************************
+ *  FFT - Complex Inverse Transform (in place)
+ *  - x[n] = (1/N) * sum X[k]*e^(j*2*pi*k*n/N) - conj(FFT(conj(X))) / N
+ *
+ *  - INPUT:    const fft_plan_float_t * plan           (pointer to the plan - complex or real)
+ *              float * data                            (N complex points - re, im interleaved)
+ *
+ *  - RETURN:   N/A (signal returned in "data")
+ ******************************************************************************/
+void fftComplexInverse_Float(const fft_plan_float_t * plan, float * data)
+{
+    uint32_t i;
+    uint32_t size = plan->size_complex;
+    float scale = 1.0f / size;
+
+    for (i = 0; i < size; i++)
+    {
+        data[2 * i + 1] = -data[2 * i + 1];
+    }
+    dspSimd_Kernels()->fftComplex_Float(plan, data);
+    for (i = 0; i < size; i++)
+    {
+        data[2 * i] = data[2 * i] * scale;
+        data[2 * i + 1] = -data[2 * i + 1] * scale;
+    }
+}
+
+
+/******************************************************************************
+ *  FFT - Real Input Forward Transform (in place)
+ *  - N real samples packed as N/2 complex points (z[n] = x[2n] + j*x[2n+1]),
+ *    complex FFT of N/2 points and split of the even/odd spectra
+ *  - output packed: data[0] = X[0], data[1] = X[N/2] (both real), then
+ *    re, im of X[k] for k = 1..N/2-1 (X[N-k] = conj(X[k]))
+ *
+ *  - INPUT:    const fft_plan_float_t * plan           (pointer to a real input plan)
+ *              float * data                            (N real samples)
+ *
+ *  - RETURN:   N/A (spectrum returned in "data")
+ ******************************************************************************/
+void fftReal_Float(const fft_plan_float_t * plan, float * data)
+{
+    uint32_t half = plan->size_complex;
+    const float * w = plan->twiddle_real;
+    uint32_t k;
+
+    dspSimd_Kernels()->fftComplex_Float(plan, data);
+
+    float z_re = data[0];
+    float z_im = data[1];
+    data[0] = z_re + z_im;
+    data[1] = z_re - z_im;
+
+    for (k = 1; k <= half / 2; k++)
+    {
+        uint32_t m = half - k;
+        float zk_re = data[2 * k], zk_im = data[2 * k + 1];
+        float zm_re = data[2 * m], zm_im = data[2 * m + 1];
+
+        /* even samples: (Z[k] + conj(Z[N/2-k])) / 2, odd samples: (Z[k] - conj(Z[N/2-k])) / 2j */
+        float e_re = 0.5f * (zk_re + zm_re);
+        float e_im = 0.5f * (zk_im - zm_im);
+        float o_re = 0.5f * (zk_im + zm_im);
+        float o_im = -0.5f * (zk_re - zm_re);
+
+        /* t = W_N^k * odd */
+        float t_re = (o_re * w[2 * k]) - (o_im * w[2 * k + 1]);
+        float t_im = (o_im * w[2 * k]) + (o_re * w[2 * k + 1]);
+
+        data[2 * k] = e_re + t_re;
+        data[2 * k + 1] = e_im + t_im;
+        data[2 * m] = e_re - t_re;                  // X[N/2-k] = conj(even - t)
+        data[2 * m + 1] = t_im - e_im;
+    }
+}
+
+
+/******************************************************************************
+ *  FFT - Real Input Inverse Transform (in place)
+ *  - input packed as the output of "fftReal_Float()", output N real samples
+ *  - x[n] = (1/N) * sum X[k]*e^(j*2*pi*k*n/N)
+ *
+ *  - INPUT:    const fft_plan_float_t * plan           (pointer to a real input plan)
+ *              float * data                            (packed spectrum)
+ *
+ *  - RETURN:   N/A (signal returned in "data")
+ ******************************************************************************/
+void fftRealInverse_Float(const fft_plan_float_t * plan, float * data)
+{
+    uint32_t half = plan->size_complex;
+    const float * w = plan->twiddle_real;
+    uint32_t k;
+
+    float x0 = data[0];
+    float xn = data[1];
+    data[0] = 0.5f * (x0 + xn);
+    data[1] = 0.5f * (x0 - xn);
+
+    for (k = 1; k <= half / 2; k++)
+    {
+        uint32_t m = half - k;
+        float xk_re = data[2 * k], xk_im = data[2 * k + 1];
+        float xm_re = data[2 * m], xm_im = data[2 * m + 1];
+
+        /* even = (X[k] + conj(X[N/2-k])) / 2, odd = conj(W_N^k) * (X[k] - conj(X[N/2-k])) / 2 */
+        float e_re = 0.5f * (xk_re + xm_re);
+        float e_im = 0.5f * (xk_im - xm_im);
+        float d_re = 0.5f * (xk_re - xm_re);
+        float d_im = 0.5f * (xk_im + xm_im);
+        float o_re = (d_re * w[2 * k]) + (d_im * w[2 * k + 1]);
+        float o_im = (d_im * w[2 * k]) - (d_re * w[2 * k + 1]);
+
+        /* Z[k] = even + j*odd, Z[N/2-k] = conj(even) + j*conj(odd) */
+        data[2 * k] = e_re - o_im;
+        data[2 * k + 1] = e_im + o_re;
+        data[2 * m] = e_re + o_im;
+        data[2 * m + 1] = o_re - e_im;
+    }
+
+    fftComplexInverse_Float(plan, data);
+}
+
+
+/******************************************************************************
+ *  FFT - Complex Magnitude
+ *  - same scale of the Goertzel "result": 2*|X[k]|/N
+ *
+ *  - INPUT:    const fft_plan_float_t * plan           (pointer to a complex plan)
+ *              const float * spectrum                  (output of "fftComplex_Float()")
+ *              float * magnitude                       (N magnitudes)
+ *
+ *  - RETURN:   N/A (magnitudes returned in "magnitude")
+ ******************************************************************************/
+void fftComplexMagnitude_Float(const fft_plan_float_t * plan, const float * spectrum, float * magnitude)
+{
+    uint32_t k;
+    float scale = 2.0f / plan->size;
+
+    for (k = 0; k < plan->size; k++)
+    {
+        float re = spectrum[2 * k];
+        float im = spectrum[2 * k + 1];
+        magnitude[k] = sqrtf((re*re)+(im*im)) * scale;
+    }
+}
+
+
+/******************************************************************************
+ *  FFT - Real Input Magnitude
+ *  - same scale of the Goertzel "result": 2*|X[k]|/N, bins 0..N/2
+ *
+ *  - INPUT:    const fft_plan_float_t * plan           (pointer to a real input plan)
+ *              const float * spectrum                  (output of "fftReal_Float()")
+ *              float * magnitude                       (N/2 + 1 magnitudes)
+ *
+ *  - RETURN:   N/A (magnitudes returned in "magnitude")
+ ******************************************************************************/
+void fftRealMagnitude_Float(const fft_plan_float_t * plan, const float * spectrum, float * magnitude)
+{
+    uint32_t k;
+    uint32_t half = plan->size_complex;
+    float scale = 2.0f / plan->size;
+
+    magnitude[0] = fabsf(spectrum[0]) * scale;
+    magnitude[half] = fabsf(spectrum[1]) * scale;
+    for (k = 1; k < half; k++)
+    {
+        float re = spectrum[2 * k];
+        float im = spectrum[2 * k + 1];
+        magnitude[k] = sqrtf((re*re)+(im*im)) * scale;
+    }
+}
+
+
+
+
+/******************************************************************************
+ *  FFT Fixed - quarter wave sine tables (FFT_FIXED_MAX_SIZE/4 + 1 points)
+ *  - generated off-line: round(sin(2*pi*i/1024) * 32767) and * (2^31 - 1)
+ *  - W_N^k of any size N <= FFT_FIXED_MAX_SIZE read with stride MAX/N
+ ******************************************************************************/
+#define     FFT_FIXED_QUARTER   (FFT_FIXED_MAX_SIZE / 4)
+
+#if (FFT_FIXED_MAX_SIZE != 1024)
+#error "FFT_FIXED_MAX_SIZE: sine tables generated for 1024 points"
+#endif
+
+static const int16_t fftSineTable_Q15[FFT_FIXED_QUARTER + 1] =
+{
+         0,    201,    402,    603,    804,   1005,   1206,   1407,   1608,   1809,   2009,   2210,
+      2410,   2611,   2811,   3012,   3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,
+      4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,   6393,   6590,   6786,   6983,
+      7179,   7375,   7571,   7767,   7962,   8157,   8351,   8545,   8739,   8933,   9126,   9319,
+      9512,   9704,   9896,  10087,  10278,  10469,  10659,  10849,  11039,  11228,  11417,  11605,
+     11793,  11980,  12167,  12353,  12539,  12725,  12910,  13094,  13279,  13462,  13645,  13828,
+     14010,  14191,  14372,  14553,  14732,  14912,  15090,  15269,  15446,  15623,  15800,  15976,
+     16151,  16325,  16499,  16673,  16846,  17018,  17189,  17360,  17530,  17700,  17869,  18037,
+     18204,  18371,  18537,  18703,  18868,  19032,  19195,  19357,  19519,  19680,  19841,  20000,
+     20159,  20317,  20475,  20631,  20787,  20942,  21096,  21250,  21403,  21554,  21705,  21856,
+     22005,  22154,  22301,  22448,  22594,  22739,  22884,  23027,  23170,  23311,  23452,  23592,
+     23731,  23870,  24007,  24143,  24279,  24413,  24547,  24680,  24811,  24942,  25072,  25201,
+     25329,  25456,  25582,  25708,  25832,  25955,  26077,  26198,  26319,  26438,  26556,  26674,
+     26790,  26905,  27019,  27133,  27245,  27356,  27466,  27575,  27683,  27790,  27896,  28001,
+     28105,  28208,  28310,  28411,  28510,  28609,  28706,  28803,  28898,  28992,  29085,  29177,
+     29268,  29358,  29447,  29534,  29621,  29706,  29791,  29874,  29956,  30037,  30117,  30195,
+     30273,  30349,  30424,  30498,  30571,  30643,  30714,  30783,  30852,  30919,  30985,  31050,
+     31113,  31176,  31237,  31297,  31356,  31414,  31470,  31526,  31580,  31633,  31685,  31736,
+     31785,  31833,  31880,  31926,  31971,  32014,  32057,  32098,  32137,  32176,  32213,  32250,
+     32285,  32318,  32351,  32382,  32412,  32441,  32469,  32495,  32521,  32545,  32567,  32589,
+     32609,  32628,  32646,  32663,  32678,  32692,  32705,  32717,  32728,  32737,  32745,  32752,
+     32757,  32761,  32765,  32766,  32767
+};
+
+static const int32_t fftSineTable_Q31[FFT_FIXED_QUARTER + 1] =
+{
+              0,    13176712,    26352928,    39528151,    52701887,    65873638,
+       79042909,    92209205,   105372028,   118530885,   131685278,   144834714,
+      157978697,   171116732,   184248325,   197372981,   210490206,   223599506,
+      236700388,   249792358,   262874923,   275947592,   289009871,   302061269,
+      315101294,   328129457,   341145265,   354148229,   367137860,   380113669,
+      393075166,   406021864,   418953276,   431868915,   444768293,   457650927,
+      470516330,   483364019,   496193509,   509004318,   521795963,   534567963,
+      547319836,   560051103,   572761285,   585449903,   598116478,   610760535,
+      623381597,   635979190,   648552837,   661102068,   673626408,   686125386,
+      698598533,   711045377,   723465451,   735858287,   748223418,   760560379,
+      772868706,   785147934,   797397602,   809617248,   821806413,   833964637,
+      846091463,   858186434,   870249095,   882278991,   894275670,   906238681,
+      918167571,   930061894,   941921200,   953745043,   965532978,   977284561,
+      988999351,  1000676905,  1012316784,  1023918549,  1035481765,  1047005996,
+     1058490807,  1069935767,  1081340445,  1092704410,  1104027236,  1115308496,
+     1126547765,  1137744620,  1148898640,  1160009404,  1171076495,  1182099495,
+     1193077990,  1204011566,  1214899812,  1225742318,  1236538675,  1247288477,
+     1257991319,  1268646799,  1279254515,  1289814068,  1300325059,  1310787095,
+     1321199780,  1331562722,  1341875532,  1352137822,  1362349204,  1372509294,
+     1382617710,  1392674071,  1402677999,  1412629117,  1422527050,  1432371426,
+     1442161874,  1451898025,  1461579513,  1471205973,  1480777044,  1490292364,
+     1499751575,  1509154322,  1518500249,  1527789006,  1537020243,  1546193612,
+     1555308767,  1564365366,  1573363067,  1582301533,  1591180425,  1599999410,
+     1608758157,  1617456334,  1626093615,  1634669675,  1643184190,  1651636840,
+     1660027308,  1668355276,  1676620431,  1684822463,  1692961061,  1701035921,
+     1709046738,  1716993211,  1724875039,  1732691927,  1740443580,  1748129706,
+     1755750016,  1763304223,  1770792043,  1778213194,  1785567395,  1792854372,
+     1800073848,  1807225552,  1814309215,  1821324571,  1828271355,  1835149305,
+     1841958164,  1848697673,  1855367580,  1861967633,  1868497585,  1874957188,
+     1881346201,  1887664382,  1893911493,  1900087300,  1906191569,  1912224072,
+     1918184580,  1924072870,  1929888719,  1935631909,  1941302224,  1946899450,
+     1952423376,  1957873795,  1963250500,  1968553291,  1973781966,  1978936330,
+     1984016188,  1989021349,  1993951624,  1998806828,  2003586778,  2008291295,
+     2012920200,  2017473320,  2021950483,  2026351521,  2030676268,  2034924561,
+     2039096240,  2043191149,  2047209132,  2051150040,  2055013722,  2058800035,
+     2062508835,  2066139982,  2069693341,  2073168776,  2076566159,  2079885359,
+     2083126253,  2086288719,  2089372637,  2092377891,  2095304369,  2098151959,
+     2100920555,  2103610053,  2106220351,  2108751351,  2111202958,  2113575079,
+     2115867625,  2118080510,  2120213650,  2122266966,  2124240379,  2126133816,
+     2127947205,  2129680479,  2131333571,  2132906419,  2134398965,  2135811152,
+     2137142926,  2138394239,  2139565042,  2140655292,  2141664947,  2142593970,
+     2143442325,  2144209981,  2144896909,  2145503082,  2146028479,  2146473079,
+     2146836865,  2147119824,  2147321945,  2147443221,  2147483647
+};
+
+
+/******************************************************************************
+ *  FFT Fixed - log2 of the size (internal)
+ *
+ *  - RETURN:   log2(size) or 0 if size is not a power of two from 2 to FFT_FIXED_MAX_SIZE
+ ******************************************************************************/
+static uint_fast8_t fftFixedLog2(uint_fast16_t size)
+{
+    uint_fast8_t log2size = 0;
+
+    if ((size < 2) || (size > FFT_FIXED_MAX_SIZE) || ((size & (size - 1)) != 0))
+    {
+        return 0;
+    }
+    while (((uint_fast16_t)1 << log2size) < size)
+    {
+        log2size++;
+    }
+    return log2size;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - block floating point shift of one stage (internal)
+ *  - a radix-2 butterfly (or the real split) grows up to (1 + sqrt(2)) times
+ *    the largest |re| or |im| of its input: shift 0, 1 or 2 keeps the output
+ *    below 0.61 of the full scale
+ *  - "bits" = 15 (Q15) or 31 (Q31)
+ ******************************************************************************/
+static inline uint_fast8_t fftFixedStageShift(uint32_t maxValue, uint_fast8_t bits)
+{
+    if (maxValue >= ((uint32_t)1 << (bits - 1)))
+    {
+        return 2;
+    }
+    if (maxValue >= ((uint32_t)1 << (bits - 2)))
+    {
+        return 1;
+    }
+    return 0;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - twiddle W = e^(-j*2*pi*idx/FFT_FIXED_MAX_SIZE) (internal)
+ *  - idx from 0 to FFT_FIXED_MAX_SIZE/2 (angle from 0 to pi)
+ ******************************************************************************/
+static inline void fftTwiddle_Q15(uint_fast16_t idx, int16_t * wr, int16_t * wi)
+{
+    if (idx <= FFT_FIXED_QUARTER)
+    {
+        *wr = fftSineTable_Q15[FFT_FIXED_QUARTER - idx];
+        *wi = (int16_t)-fftSineTable_Q15[idx];
+    }
+    else
+    {
+        *wr = (int16_t)-fftSineTable_Q15[idx - FFT_FIXED_QUARTER];
+        *wi = (int16_t)-fftSineTable_Q15[(2 * FFT_FIXED_QUARTER) - idx];
+    }
+}
+
+static inline void fftTwiddle_Q31(uint_fast16_t idx, int32_t * wr, int32_t * wi)
+{
+    if (idx <= FFT_FIXED_QUARTER)
+    {
+        *wr = fftSineTable_Q31[FFT_FIXED_QUARTER - idx];
+        *wi = -fftSineTable_Q31[idx];
+    }
+    else
+    {
+        *wr = -fftSineTable_Q31[idx - FFT_FIXED_QUARTER];
+        *wi = -fftSineTable_Q31[(2 * FFT_FIXED_QUARTER) - idx];
+    }
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - OR of |re| and |im| of all points (internal)
+ *  - same most significant bit of the largest value (enough to select the shift)
+ ******************************************************************************/
+static uint32_t fftMaxBits_Q15(const int16_t * data, uint_fast16_t size)
+{
+    uint32_t maxBits = 0;
+    uint_fast16_t i;
+
+    for (i = 0; i < 2 * size; i++)
+    {
+        int32_t x = data[i];
+        maxBits |= (uint32_t)((x < 0) ? -x : x);
+    }
+    return maxBits;
+}
+
+static uint32_t fftMaxBits_Q31(const int32_t * data, uint_fast16_t size)
+{
+    uint32_t maxBits = 0;
+    uint_fast16_t i;
+
+    for (i = 0; i < 2 * size; i++)
+    {
+        int32_t x = data[i];
+        maxBits |= (x < 0) ? (0u - (uint32_t)x) : (uint32_t)x;
+    }
+    return maxBits;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - bit reversal permutation in place (internal, no table)
+ ******************************************************************************/
+static void fftBitReverse_Q15(int16_t * data, uint_fast16_t size)
+{
+    uint_fast16_t i, bit, j = 0;
+
+    for (i = 0; i < size; i++)
+    {
+        if (i < j)
+        {
+            int16_t re = data[2 * i];
+            int16_t im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+        for (bit = size >> 1; (j & bit) != 0; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j |= bit;
+    }
+}
+
+static void fftBitReverse_Q31(int32_t * data, uint_fast16_t size)
+{
+    uint_fast16_t i, bit, j = 0;
+
+    for (i = 0; i < size; i++)
+    {
+        if (i < j)
+        {
+            int32_t re = data[2 * i];
+            int32_t im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+        for (bit = size >> 1; (j & bit) != 0; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j |= bit;
+    }
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - radix-2 stages with block floating point (internal)
+ *  - b*W rounded to the data format, outputs of a stage shifted right by
+ *    0, 1 or 2 bits (selected by the largest input of the stage)
+ *  - "maxBits" returns the OR of the outputs (used by the real split)
+ *
+ *  - RETURN:   block exponent (sum of the shifts)
+ ******************************************************************************/
+static uint_fast8_t fftStages_Q15(int16_t * data, uint_fast16_t size, uint32_t * maxBits)
+{
+    uint32_t maxIn = fftMaxBits_Q15(data, size);
+    uint_fast8_t exponent = 0;
+    uint_fast16_t half, i, k;
+
+    fftBitReverse_Q15(data, size);
+
+    for (half = 1; half < size; half <<= 1)
+    {
+        uint_fast8_t shift = fftFixedStageShift(maxIn, 15);
+        int32_t round = (1 << shift) >> 1;
+        uint_fast16_t stride = (FFT_FIXED_MAX_SIZE / 2) / half;     // W_2half^k = W_max^(k*stride)
+        uint32_t maxOut = 0;
+
+        exponent += shift;
+        for (k = 0; k < half; k++)
+        {
+            int16_t wr, wi;
+            fftTwiddle_Q15(k * stride, &wr, &wi);
+
+            for (i = k; i < size; i += 2 * half)
+            {
+                int16_t * a = &data[2 * i];
+                int16_t * b = &data[2 * (i + half)];
+                int32_t tr = (((int32_t)b[0] * wr) - ((int32_t)b[1] * wi) + (1 << 14)) >> 15;
+                int32_t ti = (((int32_t)b[1] * wr) + ((int32_t)b[0] * wi) + (1 << 14)) >> 15;
+                int32_t x0 = (a[0] + tr + round) >> shift;
+                int32_t x1 = (a[1] + ti + round) >> shift;
+                int32_t x2 = (a[0] - tr + round) >> shift;
+                int32_t x3 = (a[1] - ti + round) >> shift;
+
+                a[0] = (int16_t)x0;
+                a[1] = (int16_t)x1;
+                b[0] = (int16_t)x2;
+                b[1] = (int16_t)x3;
+                maxOut |= (uint32_t)(((x0 < 0) ? -x0 : x0) | ((x1 < 0) ? -x1 : x1) | ((x2 < 0) ? -x2 : x2) | ((x3 < 0) ? -x3 : x3));
+            }
+        }
+        maxIn = maxOut;
+    }
+    *maxBits = maxIn;
+    return exponent;
+}
+
+static uint_fast8_t fftStages_Q31(int32_t * data, uint_fast16_t size, uint32_t * maxBits)
+{
+    uint32_t maxIn = fftMaxBits_Q31(data, size);
+    uint_fast8_t exponent = 0;
+    uint_fast16_t half, i, k;
+
+    fftBitReverse_Q31(data, size);
+
+    for (half = 1; half < size; half <<= 1)
+    {
+        uint_fast8_t shift = fftFixedStageShift(maxIn, 31);
+        int64_t round = (1 << shift) >> 1;
+        uint_fast16_t stride = (FFT_FIXED_MAX_SIZE / 2) / half;     // W_2half^k = W_max^(k*stride)
+        uint32_t maxOut = 0;
+
+        exponent += shift;
+        for (k = 0; k < half; k++)
+        {
+            int32_t wr, wi;
+            fftTwiddle_Q31(k * stride, &wr, &wi);
+
+            for (i = k; i < size; i += 2 * half)
+            {
+                int32_t * a = &data[2 * i];
+                int32_t * b = &data[2 * (i + half)];
+                int64_t tr = (((int64_t)b[0] * wr) - ((int64_t)b[1] * wi) + (1LL << 30)) >> 31;
+                int64_t ti = (((int64_t)b[1] * wr) + ((int64_t)b[0] * wi) + (1LL << 30)) >> 31;
+                int32_t x0 = (int32_t)((a[0] + tr + round) >> shift);
+                int32_t x1 = (int32_t)((a[1] + ti + round) >> shift);
+                int32_t x2 = (int32_t)((a[0] - tr + round) >> shift);
+                int32_t x3 = (int32_t)((a[1] - ti + round) >> shift);
+
+                a[0] = x0;
+                a[1] = x1;
+                b[0] = x2;
+                b[1] = x3;
+                maxOut |= ((x0 < 0) ? (0u - (uint32_t)x0) : (uint32_t)x0) | ((x1 < 0) ? (0u - (uint32_t)x1) : (uint32_t)x1)
+                        | ((x2 < 0) ? (0u - (uint32_t)x2) : (uint32_t)x2) | ((x3 < 0) ? (0u - (uint32_t)x3) : (uint32_t)x3);
+            }
+        }
+        maxIn = maxOut;
+    }
+    *maxBits = maxIn;
+    return exponent;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - Complex Forward Transform Q15 (in place)
+ *  - radix-2 with block floating point: X[k] = data[k] * 2^exponent
+ *  - no multiply wider than 16x16 -> 32 bits (MSP430 hardware multiplier)
+ *  - twiddles from a constant table (flash), no plan or buffer needed
+ *
+ *  - INPUT:    int16_t * data                          (N complex points - re, im interleaved)
+ *              uint_fast16_t size                      (N - power of two from 2 to FFT_FIXED_MAX_SIZE)
+ *
+ *  - RETURN:   block exponent (0 if size is not valid - data not changed)
+ ******************************************************************************/
+uint_fast8_t fftComplex_Q15(int16_t * data, uint_fast16_t size)
+{
+    uint32_t maxBits;
+
+    if (fftFixedLog2(size) == 0)
+    {
+        return 0;
+    }
+    return fftStages_Q15(data, size, &maxBits);
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - Complex Forward Transform Q31 (in place)
+ *  - radix-2 with block floating point: X[k] = data[k] * 2^exponent
+ *
+ *  - INPUT:    int32_t * data                          (N complex points - re, im interleaved)
+ *              uint_fast16_t size                      (N - power of two from 2 to FFT_FIXED_MAX_SIZE)
+ *
+ *  - RETURN:   block exponent (0 if size is not valid - data not changed)
+ ******************************************************************************/
+uint_fast8_t fftComplex_Q31(int32_t * data, uint_fast16_t size)
+{
+    uint32_t maxBits;
+
+    if (fftFixedLog2(size) == 0)
+    {
+        return 0;
+    }
+    return fftStages_Q31(data, size, &maxBits);
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - Real Input Forward Transform Q15 (in place)
+ *  - N int16_t samples (e.g. ADC values) transformed directly: complex FFT
+ *    of N/2 points and split, same packing of "fftReal_Float()":
+ *    data[0] = X[0], data[1] = X[N/2], then re, im of X[k], k = 1..N/2-1
+ *  - X[k] = data * 2^exponent (same units of the input samples)
+ *
+ *  - INPUT:    int16_t * data                          (N real samples)
+ *              uint_fast16_t size                      (N - power of two from 4 to FFT_FIXED_MAX_SIZE)
+ *
+ *  - RETURN:   block exponent (0 if size is not valid - data not changed)
+ ******************************************************************************/
+uint_fast8_t fftReal_Q15(int16_t * data, uint_fast16_t size)
+{
+    uint_fast16_t half = size / 2;
+    uint_fast16_t k;
+    uint32_t maxBits;
+    uint_fast8_t exponent, shift;
+    int32_t round;
+
+    if ((size < 4) || (fftFixedLog2(size) == 0))
+    {
+        return 0;
+    }
+    exponent = fftStages_Q15(data, half, &maxBits);
+    shift = fftFixedStageShift(maxBits, 15);
+    round = (1 << shift) >> 1;
+
+    int32_t z_re = data[0];
+    int32_t z_im = data[1];
+    data[0] = (int16_t)((z_re + z_im + round) >> shift);
+    data[1] = (int16_t)((z_re - z_im + round) >> shift);
+
+    for (k = 1; k <= half / 2; k++)
+    {
+        uint_fast16_t m = half - k;
+        int32_t zk_re = data[2 * k], zk_im = data[2 * k + 1];
+        int32_t zm_re = data[2 * m], zm_im = data[2 * m + 1];
+        int16_t wr, wi;
+
+        /* even samples: (Z[k] + conj(Z[N/2-k])) / 2, odd samples: (Z[k] - conj(Z[N/2-k])) / 2j */
+        int32_t e_re = (zk_re + zm_re + 1) >> 1;
+        int32_t e_im = (zk_im - zm_im + 1) >> 1;
+        int32_t o_re = (zk_im + zm_im + 1) >> 1;
+        int32_t o_im = (zm_re - zk_re + 1) >> 1;
+
+        /* t = W_N^k * odd */
+        fftTwiddle_Q15(k * (FFT_FIXED_MAX_SIZE / size), &wr, &wi);
+        int32_t t_re = ((o_re * wr) - (o_im * wi) + (1 << 14)) >> 15;
+        int32_t t_im = ((o_im * wr) + (o_re * wi) + (1 << 14)) >> 15;
+
+        data[2 * k] = (int16_t)((e_re + t_re + round) >> shift);
+        data[2 * k + 1] = (int16_t)((e_im + t_im + round) >> shift);
+        data[2 * m] = (int16_t)((e_re - t_re + round) >> shift);        // X[N/2-k] = conj(even - t)
+        data[2 * m + 1] = (int16_t)((t_im - e_im + round) >> shift);
+    }
+    return exponent + shift;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - Real Input Forward Transform Q31 (in place)
+ *  - same of Q15 version with int32_t samples (more resolution, 64 bit products)
+ *
+ *  - INPUT:    int32_t * data                          (N real samples)
+ *              uint_fast16_t size                      (N - power of two from 4 to FFT_FIXED_MAX_SIZE)
+ *
+ *  - RETURN:   block exponent (0 if size is not valid - data not changed)
+ ******************************************************************************/
+uint_fast8_t fftReal_Q31(int32_t * data, uint_fast16_t size)
+{
+    uint_fast16_t half = size / 2;
+    uint_fast16_t k;
+    uint32_t maxBits;
+    uint_fast8_t exponent, shift;
+    int64_t round;
+
+    if ((size < 4) || (fftFixedLog2(size) == 0))
+    {
+        return 0;
+    }
+    exponent = fftStages_Q31(data, half, &maxBits);
+    shift = fftFixedStageShift(maxBits, 31);
+    round = (1 << shift) >> 1;
+
+    int64_t z_re = data[0];
+    int64_t z_im = data[1];
+    data[0] = (int32_t)((z_re + z_im + round) >> shift);
+    data[1] = (int32_t)((z_re - z_im + round) >> shift);
+
+    for (k = 1; k <= half / 2; k++)
+    {
+        uint_fast16_t m = half - k;
+        int64_t zk_re = data[2 * k], zk_im = data[2 * k + 1];
+        int64_t zm_re = data[2 * m], zm_im = data[2 * m + 1];
+        int32_t wr, wi;
+
+        /* even samples: (Z[k] + conj(Z[N/2-k])) / 2, odd samples: (Z[k] - conj(Z[N/2-k])) / 2j */
+        int64_t e_re = (zk_re + zm_re + 1) >> 1;
+        int64_t e_im = (zk_im - zm_im + 1) >> 1;
+        int64_t o_re = (zk_im + zm_im + 1) >> 1;
+        int64_t o_im = (zm_re - zk_re + 1) >> 1;
+
+        /* t = W_N^k * odd */
+        fftTwiddle_Q31(k * (FFT_FIXED_MAX_SIZE / size), &wr, &wi);
+        int64_t t_re = ((o_re * wr) - (o_im * wi) + (1LL << 30)) >> 31;
+        int64_t t_im = ((o_im * wr) + (o_re * wi) + (1LL << 30)) >> 31;
+
+        data[2 * k] = (int32_t)((e_re + t_re + round) >> shift);
+        data[2 * k + 1] = (int32_t)((e_im + t_im + round) >> shift);
+        data[2 * m] = (int32_t)((e_re - t_re + round) >> shift);        // X[N/2-k] = conj(even - t)
+        data[2 * m + 1] = (int32_t)((t_im - e_im + round) >> shift);
+    }
+    return exponent + shift;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - scale a root by 2^shift with rounding and saturation (internal)
+ ******************************************************************************/
+static inline uint32_t fftScaleMagnitude(uint64_t root, int_fast8_t shift)
+{
+    if (shift >= 0)
+    {
+        root = root << shift;
+    }
+    else
+    {
+        root = (root + ((uint64_t)1 << (-shift - 1))) >> (-shift);
+    }
+    return (root > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)root;
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - Real Input Magnitude Q15
+ *  - same scale of the Goertzel "result": 2*|X[k]|/N, bins 0..N/2
+ *  - integer square root, result in the units of the input samples
+ *
+ *  - INPUT:    const int16_t * spectrum                (output of "fftReal_Q15()")
+ *              uint32_t * magnitude                    (N/2 + 1 magnitudes)
+ *              uint_fast16_t size                      (N - number of real samples)
+ *              uint_fast8_t exponent                   (returned by "fftReal_Q15()")
+ *
+ *  - RETURN:   N/A (magnitudes returned in "magnitude")
+ ******************************************************************************/
+void fftRealMagnitude_Q15(const int16_t * spectrum, uint32_t * magnitude, uint_fast16_t size, uint_fast8_t exponent)
+{
+    uint_fast16_t half = size / 2;
+    uint_fast16_t k;
+    int_fast8_t shift = (int_fast8_t)exponent + 1 - (int_fast8_t)fftFixedLog2(size) - 8;    // root has 8 fractional bits
+
+    for (k = 0; k <= half; k++)
+    {
+        int32_t re = (k == 0) ? spectrum[0] : ((k == half) ? spectrum[1] : spectrum[2 * k]);
+        int32_t im = ((k == 0) || (k == half)) ? 0 : spectrum[2 * k + 1];
+        uint32_t sum = (uint32_t)(re * re) + (uint32_t)(im * im);
+        magnitude[k] = fftScaleMagnitude(isqrt64((uint64_t)sum << 16), shift);
+    }
+}
+
+
+/******************************************************************************
+ *  FFT Fixed - Real Input Magnitude Q31
+ *  - same scale of the Goertzel "result": 2*|X[k]|/N, bins 0..N/2
+ *
+ *  - INPUT:    const int32_t * spectrum                (output of "fftReal_Q31()")
+ *              uint32_t * magnitude                    (N/2 + 1 magnitudes - saturated)
+ *              uint_fast16_t size                      (N - number of real samples)
+ *              uint_fast8_t exponent                   (returned by "fftReal_Q31()")
+ *
+ *  - RETURN:   N/A (magnitudes returned in "magnitude")
+ ******************************************************************************/
+void fftRealMagnitude_Q31(const int32_t * spectrum, uint32_t * magnitude, uint_fast16_t size, uint_fast8_t exponent)
+{
+    uint_fast16_t half = size / 2;
+    uint_fast16_t k;
+    int_fast8_t shift = (int_fast8_t)exponent + 1 - (int_fast8_t)fftFixedLog2(size);
+
+    for (k = 0; k <= half; k++)
+    {
+        int64_t re = (k == 0) ? spectrum[0] : ((k == half) ? spectrum[1] : spectrum[2 * k]);
+        int64_t im = ((k == 0) || (k == half)) ? 0 : spectrum[2 * k + 1];
+        uint64_t sum = (uint64_t)(re * re) + (uint64_t)(im * im);
+        magnitude[k] = fftScaleMagnitude(isqrt64(sum), shift);
+    }
+}
+
+
+
+
+/******************************************************************************
+ *  Harmonic Analyzer - Initialize Structure Parameters (FLOAT)
+ *  - K harmonics of the fundamental bin (e.g. 1 mains cycle per array:
+ *    fundamental = 1, 50 harmonics)
+ *  - real FFT when HARMONIC_USE_FFT(K, N) and the fundamental is an integer
+ *    bin, otherwise Goertzel bank (any bin, any size)
+ *  - harmonics above N/2 are removed (K reduced)
+ *  - "buffer" is provided by the user: HARMONIC_BUFFER_SIZE(harmonics, size_array) floats
+ *  - "bitrev" is provided by the user: HARMONIC_BITREV_SIZE(harmonics, size_array) uint32_t
+ *
+ *  - INPUT:    harmonic_analyzer_float_t * inputStruct (pointer to struct with parameters)
+ *              float * buffer                          (memory used by the analyzer)
+ *              uint32_t * bitrev                       (memory used by the FFT bit reversal)
+ *              float fundamental                       (bin of the fundamental)
+ *              uint_fast16_t harmonics                 (number of harmonics K, fundamental included)
+ *              uint_fast16_t size_array                (array size - number of samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void harmonicAnalyzerInit_Float(harmonic_analyzer_float_t * inputStruct, float * buffer, uint32_t * bitrev,
+                                float fundamental, uint_fast16_t harmonics, uint_fast16_t size_array)
+{
+    uint_fast16_t h;
+    uint_fast8_t use_fft = HARMONIC_USE_FFT(harmonics, size_array) && (fundamental == (float)(uint32_t)fundamental);
+
+    while ((harmonics > 1) && ((harmonics * fundamental) > (size_array / 2)))
+    {
+        harmonics--;
+    }
+
+    inputStruct->size_array = size_array;
+    inputStruct->harmonics = harmonics;
+    inputStruct->fundamental = fundamental;
+    inputStruct->magnitude = &buffer[0];
+    inputStruct->phase_rad = &buffer[harmonics];
+    inputStruct->thd_f = 0;
+    inputStruct->thd_r = 0;
+    inputStruct->harmonic_rms = 0;
+
+    if (use_fft)
+    {
+        inputStruct->work = &buffer[2 * harmonics];
+        use_fft = fftRealPlanInit_Float(&inputStruct->plan, &buffer[(2 * harmonics) + size_array], bitrev, size_array);
+    }
+    inputStruct->use_fft = use_fft;
+
+    if (!use_fft)
+    {
+        for (h = 0; h < harmonics; h++)
+        {
+            inputStruct->magnitude[h] = fundamental * (h + 1);          // list of bins - used only by the Init
+        }
+        inputStruct->work = NULL;
+        goertzelBankInit_Float(&inputStruct->bank, &buffer[2 * harmonics], inputStruct->magnitude, harmonics, size_array);
+    }
+
+    for (h = 0; h < harmonics; h++)
+    {
+        inputStruct->magnitude[h] = 0;
+        inputStruct->phase_rad[h] = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  Harmonic Analyzer - Finalize math (internal)
+ *  - magnitude and phase of each harmonic, THD and rms of the harmonics
+ *  - Goertzel bins rotated by e^(jw) - same phase reference of the FFT
+ ******************************************************************************/
+static void harmonicAnalyzerCalc_Float(harmonic_analyzer_float_t * inputStruct)
+{
+    uint_fast16_t h;
+    uint_fast16_t harmonics = inputStruct->harmonics;
+    float sum_harmonics = 0;
+
+    if (inputStruct->use_fft)
+    {
+        const float * spectrum = inputStruct->work;
+        uint_fast16_t half = inputStruct->size_array / 2;
+        float scale = 2.0f / inputStruct->size_array;
+
+        for (h = 0; h < harmonics; h++)
+        {
+            uint_fast16_t k = (uint_fast16_t)inputStruct->fundamental * (h + 1);
+            float re = (k == half) ? spectrum[1] : spectrum[2 * k];
+            float im = (k == half) ? 0 : spectrum[(2 * k) + 1];
+            inputStruct->magnitude[h] = sqrtf((re*re)+(im*im)) * scale;
+            inputStruct->phase_rad[h] = atan2f(im, re);
+        }
+    }
+    else
+    {
+        goertzel_bank_float_t * bank = &inputStruct->bank;
+
+        for (h = 0; h < harmonics; h++)
+        {
+            float re = (bank->real_float[h] * bank->cr_float[h]) - (bank->imag_float[h] * bank->ci_float[h]);
+            float im = (bank->real_float[h] * bank->ci_float[h]) + (bank->imag_float[h] * bank->cr_float[h]);
+            inputStruct->magnitude[h] = bank->result[h];
+            inputStruct->phase_rad[h] = atan2f(im, re);
+        }
+    }
+
+    for (h = 1; h < harmonics; h++)
+    {
+        sum_harmonics += inputStruct->magnitude[h] * inputStruct->magnitude[h];
+    }
+
+    float fundamental = inputStruct->magnitude[0];
+    float sum_total = sum_harmonics + (fundamental * fundamental);
+
+    inputStruct->harmonic_rms = sqrtf(sum_harmonics * 0.5f);                    // amplitude to rms
+    inputStruct->thd_f = (fundamental > 0) ? (sqrtf(sum_harmonics) / fundamental) : 0;
+    inputStruct->thd_r = (sum_total > 0) ? sqrtf(sum_harmonics / sum_total) : 0;
+}
+
+
+/******************************************************************************
+ *  Harmonic Analyzer - Do the Math (FLOAT INPUT)
+ *  - all harmonics with a single pass (Goertzel bank) or a single real FFT
+ *
+ *  - INPUT:    harmonic_analyzer_float_t * inputStruct (pointer to struct with parameters)
+ *              const float * arrayInput                (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (results returned inside the struct)
+ ******************************************************************************/
+void harmonicAnalyzerFloat_Float(harmonic_analyzer_float_t * inputStruct, const float * arrayInput)
+{
+    if (inputStruct->use_fft)
+    {
+        uint_fast16_t i;
+        for (i = 0; i < inputStruct->size_array; i++)
+        {
+            inputStruct->work[i] = arrayInput[i];
+        }
+        fftReal_Float(&inputStruct->plan, inputStruct->work);
+    }
+    else
+    {
+        goertzelBankFloat_Float(&inputStruct->bank, arrayInput);
+    }
+    harmonicAnalyzerCalc_Float(inputStruct);
+}
+
+
+/******************************************************************************
+ *  Harmonic Analyzer - Do the Math (INT16 INPUT)
+ *  - all harmonics with a single pass (Goertzel bank) or a single real FFT
+ *
+ *  - INPUT:    harmonic_analyzer_float_t * inputStruct (pointer to struct with parameters)
+ *              const int16_t * arrayInput              (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (results returned inside the struct)
+ ******************************************************************************/
+void harmonicAnalyzerInt16_Float(harmonic_analyzer_float_t * inputStruct, const int16_t * arrayInput)
+{
+    if (inputStruct->use_fft)
+    {
+        uint_fast16_t i;
+        for (i = 0; i < inputStruct->size_array; i++)
+        {
+            inputStruct->work[i] = (float)arrayInput[i];
+        }
+        fftReal_Float(&inputStruct->plan, inputStruct->work);
+    }
+    else
+    {
+        goertzelBankInt16_Float(&inputStruct->bank, arrayInput);
+    }
+    harmonicAnalyzerCalc_Float(inputStruct);
+}
+
+
+
+
+/******************************************************************************
+ *  CIC Decimator - Initialize Structure Parameters (INT16)
+ *  - N integrators at the input rate, decimation by R, N combs (delay 1)
+ *    at the output rate - only additions, no multiplications (MCUs)
+ *  - registers of 32 bits (modulo 2^32): 16 + log2(R^N) <= 32, so
+ *    R^N <= 65536 (e.g. N = 4 and R = 16, N = 3 and R = 40)
+ *  - output normalized by 2^shift (smallest power of two >= R^N) - gain 1
+ *    if R is a power of two, otherwise R^N / 2^shift
+ *  - frequency response sinc^N: use a FIR stage after it (droop and
+ *    final decimation)
+ *
+ *  - INPUT:    cic_decimator_int16_t * inputStruct     (pointer to struct with parameters)
+ *              uint_fast8_t stages                     (N - 1 to CIC_DECIMATOR_MAX_STAGES)
+ *              uint_fast16_t ratio                     (R - input samples per output)
+ *
+ *  - RETURN:   1 if ok, 0 if the parameters are not valid
+ ******************************************************************************/
+uint_fast8_t cicDecimatorInit_Int16(cic_decimator_int16_t * inputStruct, uint_fast8_t stages, uint_fast16_t ratio)
+{
+    uint32_t gain = 1;
+    uint_fast8_t shift = 0;
+    uint_fast8_t k;
+
+    if ((stages == 0) || (stages > CIC_DECIMATOR_MAX_STAGES) || (ratio == 0))
+    {
+        return 0;
+    }
+    for (k = 0; k < stages; k++)
+    {
+        gain *= (uint32_t)ratio;
+        if (gain > 65536UL)
+        {
+            return 0;                                   // more than 32 bits
+        }
+    }
+    while (((uint32_t)1 << shift) < gain)
+    {
+        shift++;
+    }
+
+    inputStruct->stages = stages;
+    inputStruct->ratio = ratio;
+    inputStruct->shift = shift;
+    inputStruct->phase = 0;
+    for (k = 0; k < CIC_DECIMATOR_MAX_STAGES; k++)
+    {
+        inputStruct->integrator[k] = 0;
+        inputStruct->comb[k] = 0;
+    }
+    return 1;
+}
+
+
+/******************************************************************************
+ *  CIC Decimator - Decimate with N stages (internal)
+ *  - "stages" is a constant in each call of "cicDecimate_Int16()": loops
+ *    over the stages unrolled, integrators in registers
+ ******************************************************************************/
+static inline size_t cicDecimate_Stages(cic_decimator_int16_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut,
+                                        size_t size, const uint_fast8_t stages)
+{
+    uint32_t integrator[CIC_DECIMATOR_MAX_STAGES];
+    uint_fast16_t ratio = inputStruct->ratio;
+    uint_fast16_t phase = inputStruct->phase;
+    uint_fast8_t shift = inputStruct->shift;
+    size_t count = 0;
+    size_t counter;
+    uint_fast8_t k;
+
+    for (k = 0; k < stages; k++)
+    {
+        integrator[k] = inputStruct->integrator[k];
+    }
+
+    for (counter = 0; counter < size; counter++)
+    {
+        uint32_t value = (uint32_t)(int32_t)arrayIn[counter];      // read before write - allow in-place
+
+        for (k = 0; k < stages; k++)
+        {
+            integrator[k] += value;
+            value = integrator[k];
+        }
+
+        if (++phase == ratio)
+        {
+            phase = 0;
+            for (k = 0; k < stages; k++)
+            {
+                uint32_t previous = inputStruct->comb[k];
+                inputStruct->comb[k] = value;
+                value -= previous;
+            }
+            arrayOut[count++] = (int16_t)((int32_t)value >> shift);
+        }
+    }
+
+    for (k = 0; k < stages; k++)
+    {
+        inputStruct->integrator[k] = integrator[k];
+    }
+    inputStruct->phase = phase;
+    return count;
+}
+
+
+/******************************************************************************
+ *  CIC Decimator - Decimate a block (INT16 INPUT)
+ *  - any block size: the phase is kept between calls (one output every
+ *    "ratio" input samples, also across blocks)
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    cic_decimator_int16_t * inputStruct     (pointer to struct with parameters)
+ *              const int16_t * arrayIn                 (pointer to array with input samples)
+ *              int16_t * arrayOut                      (pointer to array to store the outputs - size / ratio + 1)
+ *              size_t size                             (number of input samples)
+ *
+ *  - RETURN:   number of outputs
+ ******************************************************************************/
+size_t cicDecimate_Int16(cic_decimator_int16_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size)
+{
+    switch (inputStruct->stages)
+    {
+        case 1:     return cicDecimate_Stages(inputStruct, arrayIn, arrayOut, size, 1);
+        case 2:     return cicDecimate_Stages(inputStruct, arrayIn, arrayOut, size, 2);
+        case 3:     return cicDecimate_Stages(inputStruct, arrayIn, arrayOut, size, 3);
+        case 4:     return cicDecimate_Stages(inputStruct, arrayIn, arrayOut, size, 4);
+        case 5:     return cicDecimate_Stages(inputStruct, arrayIn, arrayOut, size, 5);
+        default:    return cicDecimate_Stages(inputStruct, arrayIn, arrayOut, size, CIC_DECIMATOR_MAX_STAGES);
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Design - Low Pass - Q15
+ *  - windowed sinc (Blackman), DC gain 1 (sum of the taps = 32768)
+ *  - anti-alias filter of a decimator: cutoff ~ 0.8 / ratio
+ *
+ *  - INPUT:    int16_t * coeffs        (pointer to array to store the taps)
+ *              uint_fast16_t taps      (number of taps)
+ *              float cutoff            (fraction of the Nyquist frequency - 0 to 1)
+ *
+ *  - RETURN:   N/A (taps in coeffs)
+ ******************************************************************************/
+void firDesignLowPass_Q15(int16_t * coeffs, uint_fast16_t taps, float cutoff)
+{
+    double center = (taps - 1) / 2.0;
+    double sum = 0.0;
+    int32_t sum_q15 = 0;
+    int32_t value;
+    uint_fast16_t k;
+
+    if (taps == 0)
+    {
+        return;
+    }
+
+    /* sum of the taps (normalization) */
+    for (k = 0; k < taps; k++)
+    {
+        double n = k - center;
+        double window = 1.0;
+        double sinc = (n == 0.0) ? cutoff : (sin(3.14159265358979323846 * cutoff * n) / (3.14159265358979323846 * n));
+        if (taps > 1)
+        {
+            double angle = (2.0 * 3.14159265358979323846 * k) / (taps - 1);
+            window = 0.42 - (0.5 * cos(angle)) + (0.08 * cos(2.0 * angle));
+        }
+        sum += sinc * window;
+    }
+
+    for (k = 0; k < taps; k++)
+    {
+        double n = k - center;
+        double window = 1.0;
+        double sinc = (n == 0.0) ? cutoff : (sin(3.14159265358979323846 * cutoff * n) / (3.14159265358979323846 * n));
+        if (taps > 1)
+        {
+            double angle = (2.0 * 3.14159265358979323846 * k) / (taps - 1);
+            window = 0.42 - (0.5 * cos(angle)) + (0.08 * cos(2.0 * angle));
+        }
+        value = (int32_t)floor(((sinc * window * 32768.0) / sum) + 0.5);
+        value = (value > INT16_MAX) ? INT16_MAX : value;
+        coeffs[k] = (int16_t)value;
+        sum_q15 += value;
+    }
+
+    /* rounding error in the center tap - DC gain exactly 1 */
+    value = coeffs[taps / 2] + (32768 - sum_q15);
+    coeffs[taps / 2] = (int16_t)((value > INT16_MAX) ? INT16_MAX : value);
+}
+
+
+/******************************************************************************
+ *  FIR Decimator - Initialize Structure Parameters (Q15)
+ *  - FIR filter followed by decimation by D: only one of each D outputs is
+ *    calculated (polyphase decimation, D times less work)
+ *  - "buffer" is provided by the user: FIR_DECIMATOR_BUFFER_SIZE(taps)
+ *    int16_t (taps in reverse order + history of the input)
+ *  - sum of |taps| must be < 2 (65536 in Q15 - int32 accumulator), true
+ *    for low pass filters (see "firDesignLowPass_Q15()")
+ *
+ *  - INPUT:    fir_decimator_q15_t * inputStruct   (pointer to struct with parameters)
+ *              int16_t * buffer                    (memory used to store the taps and history)
+ *              const int16_t * coeffs              (taps in Q15 - h[0] ... h[taps - 1])
+ *              uint_fast16_t taps                  (number of taps)
+ *              uint_fast16_t ratio                 (D - input samples per output, 1 = no decimation)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void firDecimatorInit_Q15(fir_decimator_q15_t * inputStruct, int16_t * buffer, const int16_t * coeffs, uint_fast16_t taps, uint_fast16_t ratio)
+{
+    uint_fast16_t k;
+
+    inputStruct->taps = taps;
+    inputStruct->ratio = (ratio == 0) ? 1 : ratio;
+    inputStruct->phase = 0;
+    inputStruct->coeffs = &buffer[0];
+    inputStruct->history = &buffer[taps];
+
+    for (k = 0; k < taps; k++)
+    {
+        inputStruct->coeffs[k] = coeffs[taps - 1 - k];
+    }
+    for (k = 0; (k + 1) < taps; k++)
+    {
+        inputStruct->history[k] = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Decimator - Decimate a block (INT16 INPUT)
+ *  - input copied to the history in chunks of FIR_DECIMATOR_CHUNK samples,
+ *    outputs calculated directly from the history (SIMD multiply-add)
+ *  - D = 1 (FIR filter): consecutive outputs in parallel lanes
+ *  - any block size: the phase is kept between calls
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    fir_decimator_q15_t * inputStruct   (pointer to struct with parameters)
+ *              const int16_t * arrayIn             (pointer to array with input samples)
+ *              int16_t * arrayOut                  (pointer to array to store the outputs - size / ratio + 1)
+ *              size_t size                         (number of input samples)
+ *
+ *  - RETURN:   number of outputs
+ ******************************************************************************/
+size_t firDecimate_Q15(fir_decimator_q15_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size)
+{
+    size_t keep = (inputStruct->taps > 0) ? (inputStruct->taps - 1) : 0;
+    size_t ratio = inputStruct->ratio;
+    size_t phase = inputStruct->phase;
+    int16_t * history = inputStruct->history;
+    size_t count = 0;
+
+    while (size > 0)
+    {
+        size_t length = (size < FIR_DECIMATOR_CHUNK) ? size : FIR_DECIMATOR_CHUNK;
+        size_t first = ratio - 1 - phase;               // first sample of the chunk with an output
+
+        memcpy(&history[keep], arrayIn, length * sizeof(int16_t));
+        if (ratio == 1)
+        {
+            dspSimd_Kernels()->firFilter_Q15(inputStruct->coeffs, inputStruct->taps, history, length, &arrayOut[count]);
+            count += length;
+        }
+        else if (first < length)
+        {
+            size_t outputs = ((length - 1 - first) / ratio) + 1;
+            dspSimd_Kernels()->firDecimator_Q15(inputStruct->coeffs, inputStruct->taps, &history[first], ratio, outputs, &arrayOut[count]);
+            count += outputs;
+        }
+        phase = (phase + length) % ratio;
+        memmove(history, &history[length], keep * sizeof(int16_t));
+
+        arrayIn += length;
+        size -= length;
+    }
+
+    inputStruct->phase = (uint_fast16_t)phase;
+    return count;
+}
+
+
+/******************************************************************************
+ *  Decimator - Initialize Structure Parameters (INT16)
+ *  - multi-stage decimation: CIC (optional, large ratio with additions
+ *    only) followed by FIR stages (anti-alias, CIC droop, small ratios)
+ *  - e.g. 102.4 kS/s -> CIC R = 8 -> FIR D = 4 -> 3.2 kS/s, then Goertzel
+ *    and rms on 32x less samples
+ *
+ *  - INPUT:    decimator_int16_t * inputStruct     (pointer to struct with parameters)
+ *              cic_decimator_int16_t * cic         (first stage - cicDecimatorInit_Int16, NULL = none)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void decimatorInit_Int16(decimator_int16_t * inputStruct, cic_decimator_int16_t * cic)
+{
+    inputStruct->cic = cic;
+    inputStruct->fir_count = 0;
+    inputStruct->ratio = (cic != NULL) ? cic->ratio : 1;
+}
+
+
+/******************************************************************************
+ *  Decimator - Add a FIR stage (Q15)
+ *  - stages run in the order they are added
+ *
+ *  - INPUT:    decimator_int16_t * inputStruct     (pointer to struct with parameters)
+ *              fir_decimator_q15_t * fir           (firDecimatorInit_Q15)
+ *
+ *  - RETURN:   1 if ok, 0 if there is no space (DECIMATOR_MAX_FIR_STAGES)
+ ******************************************************************************/
+uint_fast8_t decimatorAddFir_Q15(decimator_int16_t * inputStruct, fir_decimator_q15_t * fir)
+{
+    if (inputStruct->fir_count >= DECIMATOR_MAX_FIR_STAGES)
+    {
+        return 0;
+    }
+    inputStruct->fir[inputStruct->fir_count++] = fir;
+    inputStruct->ratio *= fir->ratio;
+    return 1;
+}
+
+
+/******************************************************************************
+ *  Decimator - Process a block (INT16 INPUT)
+ *  - all stages in place on arrayOut (no intermediate buffers)
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    decimator_int16_t * inputStruct     (pointer to struct with parameters)
+ *              const int16_t * arrayIn             (pointer to array with input samples)
+ *              int16_t * arrayOut                  (pointer to array to store the outputs - at least "size" samples)
+ *              size_t size                         (number of input samples)
+ *
+ *  - RETURN:   number of outputs
+ ******************************************************************************/
+size_t decimatorProcess_Int16(decimator_int16_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size)
+{
+    const int16_t * input = arrayIn;
+    uint_fast8_t k;
+
+    if (inputStruct->cic != NULL)
+    {
+        size = cicDecimate_Int16(inputStruct->cic, input, arrayOut, size);
+        input = arrayOut;
+    }
+    for (k = 0; k < inputStruct->fir_count; k++)
+    {
+        size = firDecimate_Q15(inputStruct->fir[k], input, arrayOut, size);
+        input = arrayOut;
+    }
+    if (input != arrayOut)
+    {
+        memmove(arrayOut, input, size * sizeof(int16_t));
+    }
+    return size;
+}
+
+
+
+
+/******************************************************************************
+ *  FIR Filter - Initialize Structure Parameters (FLOAT)
+ *  - up to FIR_DIRECT_MAX_TAPS taps: direct form, taps in reverse order and
+ *    history of the input (SIMD - outputs in parallel)
+ *  - longer filters: overlap-save FFT convolution, FFT size N = power of
+ *    two >= 4 * taps, N - taps + 1 new samples per segment (spectrum of the
+ *    taps calculated once) - the taps are also stored in reverse order for
+ *    the outputs of short blocks (direct form)
+ *  - "buffer" is provided by the user: FIR_FLOAT_BUFFER_SIZE(taps) floats
+ *  - "bitrev" is provided by the user: FIR_FLOAT_BITREV_SIZE(taps) uint32_t
+ *    (not used by the direct form)
+ *
+ *  - INPUT:    fir_float_t * inputStruct       (pointer to struct with parameters)
+ *              float * buffer                  (memory used to store the taps, history and FFT tables)
+ *              uint32_t * bitrev               (memory used to store the FFT bit reversal)
+ *              const float * coeffs            (taps - h[0] ... h[taps - 1])
+ *              uint32_t taps                   (number of taps)
+ *
+ *  - RETURN:   1 if ok, 0 if taps is not valid
+ ******************************************************************************/
+uint_fast8_t firFilterInit_Float(fir_float_t * inputStruct, float * buffer, uint32_t * bitrev, const float * coeffs, uint32_t taps)
+{
+    uint32_t size = 4;
+    uint32_t log2_size = 2;
+    uint32_t k;
+
+    if (taps == 0)
+    {
+        return 0;
+    }
+
+    inputStruct->taps = taps;
+    inputStruct->use_fft = FIR_USE_FFT(taps);
+    inputStruct->fill = 0;
+    inputStruct->fft_min = 0;
+
+    if (!inputStruct->use_fft)
+    {
+        inputStruct->coeffs = &buffer[0];
+        inputStruct->reversed = inputStruct->coeffs;
+        inputStruct->history = &buffer[taps];
+        inputStruct->work = NULL;
+        inputStruct->segment = FIR_DECIMATOR_CHUNK;
+        for (k = 0; k < taps; k++)
+        {
+            inputStruct->coeffs[k] = coeffs[taps - 1 - k];
+        }
+        for (k = 0; (k + 1) < taps; k++)
+        {
+            inputStruct->history[k] = 0.0f;
+        }
+        return 1;
+    }
+
+    while (size < (4 * taps))
+    {
+        size <<= 1;
+        log2_size++;
+    }
+    if (!fftRealPlanInit_Float(&inputStruct->plan, buffer, bitrev, size))
+    {
+        return 0;
+    }
+
+    /* buffer: twiddles (2N), spectrum of the taps (N), segment (N), work (N), reversed taps */
+    inputStruct->coeffs = &buffer[FFT_TWIDDLE_SIZE(size)];
+    inputStruct->history = &inputStruct->coeffs[size];
+    inputStruct->work = &inputStruct->history[size];
+    inputStruct->reversed = &inputStruct->work[size];
+    inputStruct->segment = size - taps + 1;
+
+    /* transform only when cheaper than the direct form of the new samples */
+    inputStruct->fft_min = (uint32_t)(((uint64_t)size * log2_size * FIR_FFT_COST_RATIO) / taps);
+
+    for (k = 0; k < taps; k++)
+    {
+        inputStruct->reversed[k] = coeffs[taps - 1 - k];
+    }
+    for (k = 0; k < size; k++)
+    {
+        inputStruct->coeffs[k] = (k < taps) ? coeffs[k] : 0.0f;
+    }
+    fftReal_Float(&inputStruct->plan, inputStruct->coeffs);
+    for (k = 0; (k + 1) < taps; k++)
+    {
+        inputStruct->history[k] = 0.0f;
+    }
+    return 1;
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Overlap-save of the current segment (internal)
+ *  - segment (last "taps - 1" samples + "fill" new samples, zeros after)
+ *    transformed, multiplied by the spectrum of the taps and transformed
+ *    back in "work" - outputs of the new samples from work[taps - 1]
+ ******************************************************************************/
+static void firFilter_FftSegment(fir_float_t * inputStruct)
+{
+    uint32_t size = inputStruct->plan.size;
+    uint32_t used = inputStruct->taps - 1 + inputStruct->fill;
+    const float * h = inputStruct->coeffs;
+    float * work = inputStruct->work;
+    uint32_t k;
+
+    memcpy(work, inputStruct->history, used * sizeof(float));
+    memset(&work[used], 0, (size - used) * sizeof(float));
+    fftReal_Float(&inputStruct->plan, work);
+
+    /* packed spectrum: X[0] and X[N/2] real, then re, im of X[k] */
+    work[0] = work[0] * h[0];
+    work[1] = work[1] * h[1];
+    for (k = 2; k < size; k += 2)
+    {
+        float re = (work[k] * h[k]) - (work[k + 1] * h[k + 1]);
+        float im = (work[k] * h[k + 1]) + (work[k + 1] * h[k]);
+        work[k] = re;
+        work[k + 1] = im;
+    }
+    fftRealInverse_Float(&inputStruct->plan, work);
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Filter a block (FLOAT)
+ *  - one output per input sample, history kept between calls (any block
+ *    size, blocks filtered continuously)
+ *  - overlap-save: one FFT per segment of new samples - new samples of
+ *    the block in a segment shorter than "fft_min" (short blocks, end of
+ *    the block, remainder of a segment) are filtered in direct form (one
+ *    FFT costs more than their outputs) - no added latency
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    fir_float_t * inputStruct       (pointer to struct with parameters)
+ *              const float * arrayIn           (pointer to array with input samples)
+ *              float * arrayOut                (pointer to array to store the outputs)
+ *              size_t size                     (number of samples)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void firFilter_Float(fir_float_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size)
+{
+    size_t keep = inputStruct->taps - 1;
+    float * history = inputStruct->history;
+
+    while (size > 0)
+    {
+        size_t length = inputStruct->segment - inputStruct->fill;
+        length = (size < length) ? size : length;
+
+        if (!inputStruct->use_fft)
+        {
+            memcpy(&history[keep], arrayIn, length * sizeof(float));
+            dspSimd_Kernels()->firFilter_Float(inputStruct->coeffs, inputStruct->taps, history, length, arrayOut);
+            memmove(history, &history[length], keep * sizeof(float));
+        }
+        else
+        {
+            size_t start = inputStruct->fill;
+
+            memcpy(&history[keep + start], arrayIn, length * sizeof(float));
+            inputStruct->fill += (uint32_t)length;
+            if (length >= inputStruct->fft_min)
+            {
+                firFilter_FftSegment(inputStruct);
+                memcpy(arrayOut, &inputStruct->work[keep + start], length * sizeof(float));
+            }
+            else
+            {
+                dspSimd_Kernels()->firFilter_Float(inputStruct->reversed, inputStruct->taps, &history[start], length, arrayOut);
+            }
+            if (inputStruct->fill == inputStruct->segment)
+            {
+                memmove(history, &history[inputStruct->segment], keep * sizeof(float));
+                inputStruct->fill = 0;
+            }
+        }
+
+        arrayIn += length;
+        arrayOut += length;
+        size -= length;
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Initialize Structure Parameters (Q15)
+ *  - FIR decimator with D = 1 (see "firDecimatorInit_Q15()"): SIMD
+ *    multiply-add, int32 accumulation - sum of |taps| must be < 2
+ *  - "buffer" is provided by the user: FIR_Q15_BUFFER_SIZE(taps) int16_t
+ *
+ *  - INPUT:    fir_q15_t * inputStruct         (pointer to struct with parameters)
+ *              int16_t * buffer                (memory used to store the taps and history)
+ *              const int16_t * coeffs          (taps in Q15 - h[0] ... h[taps - 1])
+ *              uint_fast16_t taps              (number of taps)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void firFilterInit_Q15(fir_q15_t * inputStruct, int16_t * buffer, const int16_t * coeffs, uint_fast16_t taps)
+{
+    firDecimatorInit_Q15(inputStruct, buffer, coeffs, taps, 1);
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Filter a block (Q15)
+ *  - one output per input sample, history kept between calls
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    fir_q15_t * inputStruct         (pointer to struct with parameters)
+ *              const int16_t * arrayIn         (pointer to array with input samples)
+ *              int16_t * arrayOut              (pointer to array to store the outputs)
+ *              size_t size                     (number of samples)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void firFilter_Q15(fir_q15_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size)
+{
+    firDecimate_Q15(inputStruct, arrayIn, arrayOut, size);
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Initialize Structure Parameters (Q31)
+ *  - direct form, 32x32 bit products and 64 bit accumulation (SIMD), output
+ *    rounded and saturated
+ *  - "buffer" is provided by the user: FIR_Q31_BUFFER_SIZE(taps) int32_t
+ *
+ *  - INPUT:    fir_q31_t * inputStruct         (pointer to struct with parameters)
+ *              int32_t * buffer                (memory used to store the taps and history)
+ *              const int32_t * coeffs          (taps in Q31 - h[0] ... h[taps - 1])
+ *              uint_fast16_t taps              (number of taps)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void firFilterInit_Q31(fir_q31_t * inputStruct, int32_t * buffer, const int32_t * coeffs, uint_fast16_t taps)
+{
+    uint_fast16_t k;
+
+    inputStruct->taps = taps;
+    inputStruct->coeffs = &buffer[0];
+    inputStruct->history = &buffer[taps];
+
+    for (k = 0; k < taps; k++)
+    {
+        inputStruct->coeffs[k] = coeffs[taps - 1 - k];
+    }
+    for (k = 0; (k + 1) < taps; k++)
+    {
+        inputStruct->history[k] = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Filter a block (Q31)
+ *  - one output per input sample, history kept between calls
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *
+ *  - INPUT:    fir_q31_t * inputStruct         (pointer to struct with parameters)
+ *              const int32_t * arrayIn         (pointer to array with input samples)
+ *              int32_t * arrayOut              (pointer to array to store the outputs)
+ *              size_t size                     (number of samples)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void firFilter_Q31(fir_q31_t * inputStruct, const int32_t * arrayIn, int32_t * arrayOut, size_t size)
+{
+    size_t keep = (inputStruct->taps > 0) ? (inputStruct->taps - 1) : 0;
+    int32_t * history = inputStruct->history;
+
+    while (size > 0)
+    {
+        size_t length = (size < FIR_DECIMATOR_CHUNK) ? size : FIR_DECIMATOR_CHUNK;
+
+        memcpy(&history[keep], arrayIn, length * sizeof(int32_t));
+        dspSimd_Kernels()->firFilter_Q31(inputStruct->coeffs, inputStruct->taps, history, length, arrayOut);
+        memmove(history, &history[length], keep * sizeof(int32_t));
+
+        arrayIn += length;
+        arrayOut += length;
+        size -= length;
+    }
+}
+
+
+
+
+/******************************************************************************
+ *  Pipeline - stages of the library primitives (internal)
+ *  - each stage filters the block in place or only reads it (rms, Goertzel)
+ ******************************************************************************/
+static void dspStage_HighPass_Float(void * context, float * block, size_t size)
+{
+    iir_SinglePoleHighPass_Float_Block((iirHighPassFloat_t *)context, block, block, size);
+}
+
+static void dspStage_LowPass_Float(void * context, float * block, size_t size)
+{
+    iir_SinglePoleLowPass_Float_Block((iirLowPassFloat_t *)context, block, block, size);
+}
+
+static void dspStage_Biquad_Float(void * context, float * block, size_t size)
+{
+    iir_Biquad_Float_Block((iirBiquadFloat_t *)context, block, block, size);
+}
+
+static void dspStage_Rms_Float(void * context, float * block, size_t size)
+{
+    rms_float_t * rms = (rms_float_t *)context;
+    float acc = rms->acc;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        acc += (block[i] * block[i]);
+    }
+    rms->acc = acc;
+    rms->size_counter += (uint_fast16_t)size;
+}
+
+static void dspStage_RmsSliding_Float(void * context, float * block, size_t size)
+{
+    rms_sliding_float_t * rms = (rms_sliding_float_t *)context;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        rmsSlidingAddSample_Float(rms, block[i]);
+    }
+}
+
+static void dspStage_Goertzel_Float(void * context, float * block, size_t size)
+{
+    goertzel_sample_float_t * goertzel = (goertzel_sample_float_t *)context;
+    size_t i = 0;
+
+    if (goertzel->size_array == 0)
+    {
+        return;
+    }
+    while (i < size)
+    {
+        /* samples until the end of the window - same math of "goertzelSampleAddFloat_Float()" */
+        size_t len = goertzel->size_array - goertzel->counter;
+        float coeff = goertzel->coeff_float;
+        float sprev = goertzel->sprev_float;
+        float sprev2 = goertzel->sprev_float2;
+        size_t j;
+
+        if (len > (size - i))
+        {
+            len = size - i;
+        }
+        for (j = 0; j < len; j++)
+        {
+            float s = block[i + j] + (coeff * sprev) - sprev2;
+            sprev2 = sprev;
+            sprev = s;
+        }
+        goertzel->sprev_float = sprev;
+        goertzel->sprev_float2 = sprev2;
+        goertzel->s_float = sprev;
+        goertzel->counter += (uint_fast16_t)len;
+        i += len;
+
+        if (goertzel->counter >= goertzel->size_array)
+        {
+            goertzelSampleCalc_Float(goertzel);                 // window complete - result ready, restart
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  Pipeline - Float Version - Initialize Structure Parameters
+ *  - chain of stages run block by block: every stage processes the same
+ *    block (in place) while it is in the cache, then the next block
+ *  - "stages" and "block" are provided by the user (no copies of the data
+ *    between stages, no malloc)
+ *  - "block" is used only by the int16_t input (conversion to float), can be
+ *    NULL if only "dspPipelineProcess_Float()" is used
+ *
+ *  - INPUT:    dsp_pipeline_float_t * pipeline         (pointer to struct with parameters)
+ *              dsp_stage_float_t * stages              (array to store the stages)
+ *              uint_fast8_t maxStages                  (number of elements of "stages")
+ *              float * block                           (work block - blockSize floats)
+ *              size_t blockSize                        (samples per block - e.g. 256, fits L1 cache)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void dspPipelineInit_Float(dsp_pipeline_float_t * pipeline, dsp_stage_float_t * stages, uint_fast8_t maxStages,
+                           float * block, size_t blockSize)
+{
+    pipeline->stages = stages;
+    pipeline->max_stages = maxStages;
+    pipeline->count = 0;
+    pipeline->block = block;
+    pipeline->block_size = (blockSize == 0) ? 1 : blockSize;
+}
+
+
+/******************************************************************************
+ *  Pipeline - Float Version - Add a stage
+ *  - stages run in the order they are added
+ *  - "process" filters "size" samples of "block" in place (or only reads them)
+ *
+ *  - INPUT:    dsp_pipeline_float_t * pipeline         (pointer to struct with parameters)
+ *              dsp_stage_float_fn process              (stage function)
+ *              void * context                          (first parameter of "process" - e.g. filter struct)
+ *
+ *  - RETURN:   1 if ok, 0 if the pipeline is full
+ ******************************************************************************/
+uint_fast8_t dspPipelineAddStage_Float(dsp_pipeline_float_t * pipeline, dsp_stage_float_fn process, void * context)
+{
+    if (pipeline->count >= pipeline->max_stages)
+    {
+        return 0;
+    }
+    pipeline->stages[pipeline->count].process = process;
+    pipeline->stages[pipeline->count].context = context;
+    pipeline->count++;
+    return 1;
+}
+
+
+/******************************************************************************
+ *  Pipeline - Float Version - Add a stage of the library
+ *  - high pass, low pass and biquad filter the block in place
+ *  - rms accumulates the block (call "rmsValueCalcRmsStdMath_Float()" when
+ *    the value is needed), rms sliding updates the window
+ *  - Goertzel calculates the result every "size_array" samples (windows
+ *    can cross blocks)
+ *
+ *  - INPUT:    dsp_pipeline_float_t * pipeline         (pointer to struct with parameters)
+ *              (struct of the primitive, initialized by its "_Init()")
+ *
+ *  - RETURN:   1 if ok, 0 if the pipeline is full
+ ******************************************************************************/
+uint_fast8_t dspPipelineAddHighPass_Float(dsp_pipeline_float_t * pipeline, iirHighPassFloat_t * filter)
+{
+    return dspPipelineAddStage_Float(pipeline, dspStage_HighPass_Float, filter);
+}
+
+uint_fast8_t dspPipelineAddLowPass_Float(dsp_pipeline_float_t * pipeline, iirLowPassFloat_t * filter)
+{
+    return dspPipelineAddStage_Float(pipeline, dspStage_LowPass_Float, filter);
+}
+
+uint_fast8_t dspPipelineAddBiquad_Float(dsp_pipeline_float_t * pipeline, iirBiquadFloat_t * filter)
+{
+    return dspPipelineAddStage_Float(pipeline, dspStage_Biquad_Float, filter);
+}
+
+uint_fast8_t dspPipelineAddRms_Float(dsp_pipeline_float_t * pipeline, rms_float_t * rms)
+{
+    return dspPipelineAddStage_Float(pipeline, dspStage_Rms_Float, rms);
+}
+
+uint_fast8_t dspPipelineAddRmsSliding_Float(dsp_pipeline_float_t * pipeline, rms_sliding_float_t * rms)
+{
+    return dspPipelineAddStage_Float(pipeline, dspStage_RmsSliding_Float, rms);
+}
+
+uint_fast8_t dspPipelineAddGoertzel_Float(dsp_pipeline_float_t * pipeline, goertzel_sample_float_t * goertzel)
+{
+    return dspPipelineAddStage_Float(pipeline, dspStage_Goertzel_Float, goertzel);
+}
+
+
+/******************************************************************************
+ *  Pipeline - Float Version - Run all stages on one block (internal)
+ ******************************************************************************/
+static void dspPipelineRun_Float(dsp_pipeline_float_t * pipeline, float * block, size_t size)
+{
+    uint_fast8_t stage;
+
+    for (stage = 0; stage < pipeline->count; stage++)
+    {
+        pipeline->stages[stage].process(pipeline->stages[stage].context, block, size);
+    }
+}
+
+
+/******************************************************************************
+ *  Pipeline - Float Version - Process an array (FLOAT INPUT, in place)
+ *  - array split in blocks of "block_size" samples, all stages run on each
+ *    block before the next one - no copies
+ *  - "data" returns the output of the last filter stage
+ *
+ *  - INPUT:    dsp_pipeline_float_t * pipeline         (pointer to struct with parameters)
+ *              float * data                            (input samples - filtered in place)
+ *              size_t size                             (number of samples - any value)
+ *
+ *  - RETURN:   N/A (results in "data" and inside the stage structs)
+ ******************************************************************************/
+void dspPipelineProcess_Float(dsp_pipeline_float_t * pipeline, float * data, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i += pipeline->block_size)
+    {
+        size_t len = size - i;
+        if (len > pipeline->block_size)
+        {
+            len = pipeline->block_size;
+        }
+        dspPipelineRun_Float(pipeline, &data[i], len);
+    }
+}
+
+
+/******************************************************************************
+ *  Pipeline - Float Version - Process an array (INT16 INPUT)
+ *  - each block converted to float in the work block, then all stages run
+ *    on it (single conversion, input array not changed)
+ *
+ *  - INPUT:    dsp_pipeline_float_t * pipeline         (pointer to struct with parameters)
+ *              const int16_t * arrayInput              (input samples - e.g. ADC values)
+ *              size_t size                             (number of samples - any value)
+ *
+ *  - RETURN:   N/A (results inside the stage structs, last block in "block")
+ ******************************************************************************/
+void dspPipelineProcessInt16_Float(dsp_pipeline_float_t * pipeline, const int16_t * arrayInput, size_t size)
+{
+    float * block = pipeline->block;
+    size_t i, j;
+
+    for (i = 0; i < size; i += pipeline->block_size)
+    {
+        size_t len = size - i;
+        if (len > pipeline->block_size)
+        {
+            len = pipeline->block_size;
+        }
+        for (j = 0; j < len; j++)
+        {
+            block[j] = (float)arrayInput[i + j];
+        }
+        dspPipelineRun_Float(pipeline, block, len);
+    }
+}
+
+
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - index synchronization (internal)
+ *  - producer writes the samples and then publishes "head" (release), the
+ *    consumer reads "head" (acquire) before the samples - and the same for
+ *    "tail" in the opposite direction. No locks, no interrupts disabled.
+ *  - GCC/clang: __atomic builtins. C11: fences. Other compilers: volatile
+ *    only (single core MCU - ISR and main loop)
+ *  - 8 bit cores (size_t not read in a single instruction) must read the
+ *    indices of the ISR side with interrupts disabled
+ ******************************************************************************/
+#if defined(__GNUC__) || defined(__clang__)
+#define     DSP_RING_LOAD_ACQUIRE(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define     DSP_RING_STORE_RELEASE(ptr, value)  __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include    <stdatomic.h>
+static inline size_t dspRing_LoadAcquire(const volatile size_t * ptr)
+{
+    size_t value = *ptr;
+    atomic_thread_fence(memory_order_acquire);
+    return value;
+}
+static inline void dspRing_StoreRelease(volatile size_t * ptr, size_t value)
+{
+    atomic_thread_fence(memory_order_release);
+    *ptr = value;
+}
+#define     DSP_RING_LOAD_ACQUIRE(ptr)          dspRing_LoadAcquire(ptr)
+#define     DSP_RING_STORE_RELEASE(ptr, value)  dspRing_StoreRelease((ptr), (value))
+#else
+#define     DSP_RING_LOAD_ACQUIRE(ptr)          (*(ptr))
+#define     DSP_RING_STORE_RELEASE(ptr, value)  (*(ptr) = (value))
+#endif
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Initialize Structure Parameters (internal)
+ ******************************************************************************/
+static uint_fast8_t dspRing_Init(dsp_ring_t * ring, void * buffer, size_t capacity, uint_fast8_t elementSize)
+{
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0))
+    {
+        return 0;
+    }
+    ring->buffer = buffer;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->element_size = elementSize;
+    ring->head = 0;
+    ring->tail_cache = 0;
+    ring->overrun_count = 0;
+    ring->overrun_samples = 0;
+    ring->tail = 0;
+    ring->head_cache = 0;
+    return 1;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Initialize Structure Parameters
+ *  - single producer (e.g. ADC ISR, capture thread) and single consumer
+ *    (e.g. main loop, DSP thread) exchange samples without locks
+ *  - free running indices: all "capacity" samples can be used
+ *  - producer and consumer indices in different cache lines (no false
+ *    sharing), each side keeps a copy of the other index and only reads
+ *    the shared one when the copy says full/empty
+ *  - initialize before starting the producer and the consumer
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              int16_t/int32_t/float * buffer      (array to store the samples)
+ *              size_t capacity                     (number of samples - power of two)
+ *
+ *  - RETURN:   1 if ok, 0 if capacity is not a power of two
+ ******************************************************************************/
+uint_fast8_t dspRingInit_Int16(dsp_ring_t * ring, int16_t * buffer, size_t capacity)
+{
+    return dspRing_Init(ring, buffer, capacity, sizeof(int16_t));
+}
+
+uint_fast8_t dspRingInit_Int32(dsp_ring_t * ring, int32_t * buffer, size_t capacity)
+{
+    return dspRing_Init(ring, buffer, capacity, sizeof(int32_t));
+}
+
+uint_fast8_t dspRingInit_Float(dsp_ring_t * ring, float * buffer, size_t capacity)
+{
+    return dspRing_Init(ring, buffer, capacity, sizeof(float));
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Samples available to read / free space to write
+ *  - exact when called by the consumer (available) or the producer (space),
+ *    otherwise only a snapshot
+ *
+ *  - INPUT:    const dsp_ring_t * ring             (pointer to struct with parameters)
+ *
+ *  - RETURN:   number of samples
+ ******************************************************************************/
+size_t dspRingAvailable(const dsp_ring_t * ring)
+{
+    size_t tail = DSP_RING_LOAD_ACQUIRE(&ring->tail);
+    return (DSP_RING_LOAD_ACQUIRE(&ring->head) - tail);
+}
 
-    inputStruct->s_fix = 0;
-    inputStruct->sprev_fix = 0;
-    inputStruct->sprev_fix2 = 0;
-    inputStruct->counter = 0;
+size_t dspRingSpace(const dsp_ring_t * ring)
+{
+    size_t head = DSP_RING_LOAD_ACQUIRE(&ring->head);
+    return (ring->capacity - (head - DSP_RING_LOAD_ACQUIRE(&ring->tail)));
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Free space for the producer (internal)
+ *  - shared "tail" read only when the copy does not have "needed" samples
+ ******************************************************************************/
+static inline size_t dspRing_Space(dsp_ring_t * ring, size_t head, size_t needed)
+{
+    size_t space = ring->capacity - (head - ring->tail_cache);
+
+    if (space < needed)
+    {
+        ring->tail_cache = DSP_RING_LOAD_ACQUIRE(&ring->tail);
+        space = ring->capacity - (head - ring->tail_cache);
+    }
+    return space;
+}
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Samples for the consumer (internal)
+ *  - shared "head" read only when the copy does not have "needed" samples
+ ******************************************************************************/
+static inline size_t dspRing_Available(dsp_ring_t * ring, size_t tail, size_t needed)
+{
+    size_t available = ring->head_cache - tail;
+
+    if (available < needed)
+    {
+        ring->head_cache = DSP_RING_LOAD_ACQUIRE(&ring->head);
+        available = ring->head_cache - tail;
+    }
+    return available;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Write a single sample (PRODUCER)
+ *  - e.g. called by the ADC ISR, the sample is dropped if the ring is full
+ *    (overrun counters incremented)
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              int16_t/int32_t/float sample        (sample to write)
+ *
+ *  - RETURN:   1 if written, 0 if the ring is full
+ ******************************************************************************/
+uint_fast8_t dspRingPushSample_Int16(dsp_ring_t * ring, int16_t sample)
+{
+    size_t head = ring->head;
+
+    if (dspRing_Space(ring, head, 1) == 0)
+    {
+        ring->overrun_count++;
+        ring->overrun_samples++;
+        return 0;
+    }
+    ((int16_t *)ring->buffer)[head & ring->mask] = sample;
+    DSP_RING_STORE_RELEASE(&ring->head, head + 1);
+    return 1;
+}
+
+uint_fast8_t dspRingPushSample_Int32(dsp_ring_t * ring, int32_t sample)
+{
+    size_t head = ring->head;
+
+    if (dspRing_Space(ring, head, 1) == 0)
+    {
+        ring->overrun_count++;
+        ring->overrun_samples++;
+        return 0;
+    }
+    ((int32_t *)ring->buffer)[head & ring->mask] = sample;
+    DSP_RING_STORE_RELEASE(&ring->head, head + 1);
+    return 1;
+}
+
+uint_fast8_t dspRingPushSample_Float(dsp_ring_t * ring, float sample)
+{
+    size_t head = ring->head;
+
+    if (dspRing_Space(ring, head, 1) == 0)
+    {
+        ring->overrun_count++;
+        ring->overrun_samples++;
+        return 0;
+    }
+    ((float *)ring->buffer)[head & ring->mask] = sample;
+    DSP_RING_STORE_RELEASE(&ring->head, head + 1);
+    return 1;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Write an array (internal)
+ ******************************************************************************/
+static size_t dspRing_Push(dsp_ring_t * ring, const void * arrayInput, size_t size)
+{
+    uint8_t * buffer = (uint8_t *)ring->buffer;
+    size_t elementSize = ring->element_size;
+    size_t head = ring->head;
+    size_t count = dspRing_Space(ring, head, size);
+    size_t index = head & ring->mask;
+    size_t first;
+
+    if (count < size)
+    {
+        ring->overrun_count++;
+        ring->overrun_samples += (uint32_t)(size - count);
+    }
+    else
+    {
+        count = size;
+    }
+
+    /* two copies at most - until the end of the buffer and from the start */
+    first = ring->capacity - index;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(&buffer[index * elementSize], arrayInput, first * elementSize);
+    memcpy(buffer, (const uint8_t *)arrayInput + (first * elementSize), (count - first) * elementSize);
+
+    DSP_RING_STORE_RELEASE(&ring->head, head + count);
+    return count;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Write an array (PRODUCER)
+ *  - samples that do not fit are dropped (overrun counters incremented)
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              const int16_t/int32_t/float * arrayInput (samples to write)
+ *              size_t size                         (number of samples)
+ *
+ *  - RETURN:   number of samples written
+ ******************************************************************************/
+size_t dspRingPush_Int16(dsp_ring_t * ring, const int16_t * arrayInput, size_t size)
+{
+    return dspRing_Push(ring, arrayInput, size);
+}
+
+size_t dspRingPush_Int32(dsp_ring_t * ring, const int32_t * arrayInput, size_t size)
+{
+    return dspRing_Push(ring, arrayInput, size);
+}
+
+size_t dspRingPush_Float(dsp_ring_t * ring, const float * arrayInput, size_t size)
+{
+    return dspRing_Push(ring, arrayInput, size);
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Contiguous free space (internal)
+ ******************************************************************************/
+static size_t dspRing_WriteSpan(dsp_ring_t * ring, void ** span)
+{
+    size_t head = ring->head;
+    size_t index = head & ring->mask;
+    size_t count = ring->capacity - index;                  // until the end of the buffer
+    size_t space = dspRing_Space(ring, head, count);
+
+    if (count > space)
+    {
+        count = space;
+    }
+    *span = (uint8_t *)ring->buffer + (index * ring->element_size);
+    return count;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Get a contiguous span to write (PRODUCER)
+ *  - zero copy: samples written directly in the ring (e.g. DMA destination,
+ *    ADC driver), then published by "dspRingWriteCommit()"
+ *  - the free space can be split in two spans (end and start of the
+ *    buffer), call again after the commit to get the second one
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              int16_t/int32_t/float ** span       (returns the first free sample)
+ *
+ *  - RETURN:   number of samples of the span (0 if the ring is full)
+ ******************************************************************************/
+size_t dspRingWriteSpan_Int16(dsp_ring_t * ring, int16_t ** span)
+{
+    void * ptr;
+    size_t count = dspRing_WriteSpan(ring, &ptr);
+    *span = (int16_t *)ptr;
+    return count;
+}
+
+size_t dspRingWriteSpan_Int32(dsp_ring_t * ring, int32_t ** span)
+{
+    void * ptr;
+    size_t count = dspRing_WriteSpan(ring, &ptr);
+    *span = (int32_t *)ptr;
+    return count;
+}
+
+size_t dspRingWriteSpan_Float(dsp_ring_t * ring, float ** span)
+{
+    void * ptr;
+    size_t count = dspRing_WriteSpan(ring, &ptr);
+    *span = (float *)ptr;
+    return count;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Publish samples written in the span (PRODUCER)
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              size_t count                        (samples written - up to the span size)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void dspRingWriteCommit(dsp_ring_t * ring, size_t count)
+{
+    DSP_RING_STORE_RELEASE(&ring->head, ring->head + count);
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Read an array (internal)
+ ******************************************************************************/
+static size_t dspRing_Pop(dsp_ring_t * ring, void * arrayOutput, size_t size)
+{
+    const uint8_t * buffer = (const uint8_t *)ring->buffer;
+    size_t elementSize = ring->element_size;
+    size_t tail = ring->tail;
+    size_t count = dspRing_Available(ring, tail, size);
+    size_t index = tail & ring->mask;
+    size_t first;
+
+    if (count > size)
+    {
+        count = size;
+    }
+
+    first = ring->capacity - index;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(arrayOutput, &buffer[index * elementSize], first * elementSize);
+    memcpy((uint8_t *)arrayOutput + (first * elementSize), buffer, (count - first) * elementSize);
+
+    DSP_RING_STORE_RELEASE(&ring->tail, tail + count);
+    return count;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Read an array (CONSUMER)
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              int16_t/int32_t/float * arrayOutput (array to store the samples)
+ *              size_t size                         (maximum number of samples)
+ *
+ *  - RETURN:   number of samples read
+ ******************************************************************************/
+size_t dspRingPop_Int16(dsp_ring_t * ring, int16_t * arrayOutput, size_t size)
+{
+    return dspRing_Pop(ring, arrayOutput, size);
+}
+
+size_t dspRingPop_Int32(dsp_ring_t * ring, int32_t * arrayOutput, size_t size)
+{
+    return dspRing_Pop(ring, arrayOutput, size);
+}
+
+size_t dspRingPop_Float(dsp_ring_t * ring, float * arrayOutput, size_t size)
+{
+    return dspRing_Pop(ring, arrayOutput, size);
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Contiguous samples (internal)
+ ******************************************************************************/
+static size_t dspRing_ReadSpan(dsp_ring_t * ring, const void ** span)
+{
+    size_t tail = ring->tail;
+    size_t index = tail & ring->mask;
+    size_t count = ring->capacity - index;                  // until the end of the buffer
+    size_t available = dspRing_Available(ring, tail, count);
+
+    if (count > available)
+    {
+        count = available;
+    }
+    *span = (const uint8_t *)ring->buffer + (index * ring->element_size);
+    return count;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Get a contiguous span to read (CONSUMER)
+ *  - zero copy: the span can be passed directly to the array functions
+ *    (rms, Goertzel, filters, pipeline...), then released by
+ *    "dspRingReadRelease()"
+ *  - the samples can be split in two spans (end and start of the buffer),
+ *    call again after the release to get the second one
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              const int16_t/int32_t/float ** span (returns the first sample)
+ *
+ *  - RETURN:   number of samples of the span (0 if the ring is empty)
+ ******************************************************************************/
+size_t dspRingReadSpan_Int16(dsp_ring_t * ring, const int16_t ** span)
+{
+    const void * ptr;
+    size_t count = dspRing_ReadSpan(ring, &ptr);
+    *span = (const int16_t *)ptr;
+    return count;
+}
+
+size_t dspRingReadSpan_Int32(dsp_ring_t * ring, const int32_t ** span)
+{
+    const void * ptr;
+    size_t count = dspRing_ReadSpan(ring, &ptr);
+    *span = (const int32_t *)ptr;
+    return count;
+}
+
+size_t dspRingReadSpan_Float(dsp_ring_t * ring, const float ** span)
+{
+    const void * ptr;
+    size_t count = dspRing_ReadSpan(ring, &ptr);
+    *span = (const float *)ptr;
+    return count;
+}
+
+
+/******************************************************************************
+ *  SPSC Ring Buffer - Release samples read from the span (CONSUMER)
+ *  - space returned to the producer
+ *
+ *  - INPUT:    dsp_ring_t * ring                   (pointer to struct with parameters)
+ *              size_t count                        (samples used - up to the span size)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void dspRingReadRelease(dsp_ring_t * ring, size_t count)
+{
+    DSP_RING_STORE_RELEASE(&ring->tail, ring->tail + count);
+}
+
+
+
+
+/******************************************************************************
+ *                          RUNTIME DISPATCH
+ ******************************************************************************/
+
+#if defined(DSP_MATH_DISPATCH)
+
+/* compile the following functions for one instruction set (GCC and clang) */
+#define     DSP_SIMD_STR(x)                 #x
+#if defined(__clang__)
+#define     DSP_SIMD_TARGET_BEGIN(isa)      _Pragma(DSP_SIMD_STR(clang attribute push (__attribute__((target(isa))), apply_to = function)))
+#define     DSP_SIMD_TARGET_END()           _Pragma("clang attribute pop")
+#else
+#define     DSP_SIMD_TARGET_BEGIN(isa)      _Pragma("GCC push_options") _Pragma(DSP_SIMD_STR(GCC target(isa)))
+#define     DSP_SIMD_TARGET_END()           _Pragma("GCC pop_options")
+#endif
+
+/* scalar - plain C (GCC: without auto-vectorization - reference of the benchmark) */
+#if !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize ("no-tree-vectorize")
+#endif
+#define     DSP_SIMD_LEVEL          DSP_SIMD_SCALAR
+#define     DSP_SIMD_NAME(name)     name##_scalar
+#include    "DSP_and_Math_simd.h"
+#if !defined(__clang__)
+#pragma GCC pop_options
+#endif
+
+DSP_SIMD_TARGET_BEGIN("sse2")
+#define     DSP_SIMD_LEVEL          DSP_SIMD_SSE2
+#define     DSP_SIMD_NAME(name)     name##_sse2
+#include    "DSP_and_Math_simd.h"
+DSP_SIMD_TARGET_END()
+
+DSP_SIMD_TARGET_BEGIN("sse4.1")
+#define     DSP_SIMD_LEVEL          DSP_SIMD_SSE4_1
+#define     DSP_SIMD_NAME(name)     name##_sse4_1
+#include    "DSP_and_Math_simd.h"
+DSP_SIMD_TARGET_END()
+
+DSP_SIMD_TARGET_BEGIN("avx2")
+#define     DSP_SIMD_LEVEL          DSP_SIMD_AVX2
+#define     DSP_SIMD_NAME(name)     name##_avx2
+#include    "DSP_and_Math_simd.h"
+DSP_SIMD_TARGET_END()
+
+DSP_SIMD_TARGET_BEGIN("avx512f,avx512bw")
+#define     DSP_SIMD_LEVEL          DSP_SIMD_AVX512
+#define     DSP_SIMD_NAME(name)     name##_avx512
+#include    "DSP_and_Math_simd.h"
+DSP_SIMD_TARGET_END()
+
+static const struct dsp_simd_kernels_ * const dspSimd_KernelTables[] =
+{
+    &dspSimd_KernelTable_scalar,
+    &dspSimd_KernelTable_sse2,
+    &dspSimd_KernelTable_sse4_1,
+    &dspSimd_KernelTable_avx2,
+    &dspSimd_KernelTable_avx512,
+};
+
+
+/******************************************************************************
+ *  Detect the best SIMD level supported by the CPU and OS (internal)
+ *  - CPUID feature bits and XGETBV (registers saved by the OS)
+ ******************************************************************************/
+static uint_fast8_t dspSimd_Detect(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int xcr0, xcr0_high;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(edx & bit_SSE2))
+    {
+        return DSP_SIMD_SCALAR;
+    }
+    if (!(ecx & bit_SSE4_1))
+    {
+        return DSP_SIMD_SSE2;
+    }
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX))
+    {
+        return DSP_SIMD_SSE4_1;
+    }
+
+    __asm__ __volatile__ ("xgetbv" : "=a"(xcr0), "=d"(xcr0_high) : "c"(0));
+    if (((xcr0 & 0x06) != 0x06) || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(ebx & bit_AVX2))
+    {
+        return DSP_SIMD_SSE4_1;                         // XMM/YMM state not enabled or no AVX2
+    }
+    if ((ebx & bit_AVX512F) && (ebx & bit_AVX512BW) && ((xcr0 & 0xE6) == 0xE6))
+    {
+        return DSP_SIMD_AVX512;                         // opmask and ZMM state enabled
+    }
+    return DSP_SIMD_AVX2;
+}
+
+
+/* select the tables at startup - before main() */
+__attribute__((constructor)) static void dspSimd_Startup(void)
+{
+    dspSimd_Init();
+}
+
+#else
+
+/* without dispatch - only the instruction set enabled in the compiler flags */
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define     DSP_SIMD_LEVEL          DSP_SIMD_AVX512
+#elif defined(__AVX2__)
+#define     DSP_SIMD_LEVEL          DSP_SIMD_AVX2
+#elif defined(__SSE4_1__)
+#define     DSP_SIMD_LEVEL          DSP_SIMD_SSE4_1
+#elif defined(__SSE2__)
+#define     DSP_SIMD_LEVEL          DSP_SIMD_SSE2
+#else
+#define     DSP_SIMD_LEVEL          DSP_SIMD_SCALAR
+#endif
+#define     DSP_SIMD_NAME(name)     name##_native
+#include    "DSP_and_Math_simd.h"
+
+#endif
+
+
+/******************************************************************************
+ *  Runtime dispatch - Initialize
+ *  - select the best SIMD level supported by the CPU (called automatically)
+ *  - environment variable "DSP_MATH_SIMD" (scalar, sse2, sse4.1, avx2, avx512)
+ *    forces a level - limited to the levels supported by the CPU
+ *
+ *  - INPUT:    N/A
+ *
+ *  - RETURN:   selected level (DSP_SIMD_SCALAR ... DSP_SIMD_AVX512)
+ ******************************************************************************/
+uint_fast8_t dspSimd_Init(void)
+{
+#if defined(DSP_MATH_DISPATCH)
+    uint_fast8_t level = dspSimd_Detect();
+    const char * env = getenv("DSP_MATH_SIMD");
+    uint_fast8_t i;
+
+    if (env != NULL)
+    {
+        for (i = DSP_SIMD_SCALAR; i <= DSP_SIMD_AVX512; i++)
+        {
+            if (strcmp(env, dspSimd_LevelName(i)) == 0)
+            {
+                level = (i < level) ? i : level;
+                break;
+            }
+        }
+    }
+    dspSimd_kernels = dspSimd_KernelTables[level];
+#else
+    dspSimd_kernels = &dspSimd_KernelTable_native;
+#endif
+    return dspSimd_kernels->level;
+}
+
+
+/******************************************************************************
+ *  Runtime dispatch - Get the level in use
+ *
+ *  - RETURN:   DSP_SIMD_SCALAR ... DSP_SIMD_AVX512
+ ******************************************************************************/
+uint_fast8_t dspSimd_GetLevel(void)
+{
+    return dspSimd_Kernels()->level;
+}
+
+
+/******************************************************************************
+ *  Runtime dispatch - Select a level (e.g. compare levels in a benchmark)
+ *  - limited to the levels supported by the CPU - without dispatch only the
+ *    level of the compiler flags is available
+ *  - not thread safe: select before starting the processing threads
+ *
+ *  - INPUT:    uint_fast8_t level      (DSP_SIMD_SCALAR ... DSP_SIMD_AVX512)
+ *
+ *  - RETURN:   selected level
+ ******************************************************************************/
+uint_fast8_t dspSimd_SetLevel(uint_fast8_t level)
+{
+#if defined(DSP_MATH_DISPATCH)
+    uint_fast8_t supported = dspSimd_Detect();
+
+    if (level > supported)
+    {
+        level = supported;
+    }
+    dspSimd_kernels = dspSimd_KernelTables[level];
+#else
+    (void)level;
+    dspSimd_kernels = &dspSimd_KernelTable_native;
+#endif
+    return dspSimd_kernels->level;
+}
+
+
+/******************************************************************************
+ *  Runtime dispatch - Name of a level (same names of "DSP_MATH_SIMD")
+ *
+ *  - INPUT:    uint_fast8_t level      (DSP_SIMD_SCALAR ... DSP_SIMD_AVX512)
+ *
+ *  - RETURN:   "scalar", "sse2", "sse4.1", "avx2", "avx512" or "unknown"
+ ******************************************************************************/
+const char * dspSimd_LevelName(uint_fast8_t level)
+{
+    static const char * const names[] = {"scalar", "sse2", "sse4.1", "avx2", "avx512"};
+
+    return (level <= DSP_SIMD_AVX512) ? names[level] : "unknown";
 }
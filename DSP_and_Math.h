@@ -4,7 +4,7 @@
  *  - some functions using fixed notation to (optimized)
  *
  *  author: Haroldo Amaral - agaelema@gmail.com
- *  v0.4.3 - 2017/10/09
+ *  v0.5 - 2026/10/16
  ******************************************************************************
  *  log:
  *    v0.1      . Initial version
@@ -30,12 +30,40 @@
  *              - remove old remain functions
  *    v0.4.2    . fix "sineWaveGen_GetSample()" function - phase error
  *    v0.4.3    . organized defines
+ *    v0.5      + add block versions of iir high pass filters (array in/out)
+ *              + add multi-channel (SoA) banks of iir low pass filters - SSE/AVX lanes
+ *              + add Goertzel bank - K bins in a single pass over the array
+ *              + add sliding DFT (Goertzel sliding) - bin updated every sample
+ *              + add sine wave oscillator (rotating phasor) - no sinf per sample
+ *              + add DDS (NCO) sine generator - 32 bit phase and Q31 table
+ *              + add rms int16 array with 64 bit accumulation (SIMD pmaddwd)
+ *              + add rms sliding window (ring buffer, O(1) update)
+ *              + add power metering - Vrms, Irms, P, S, PF and energy in one pass
+ *              + add isqrt32, isqrt64 and isqrt32_Q16 (clz + table + Newton)
+ *              . sqrt_Int32 and rms int16 optimized versions use the new sqrt
+ *              + add cascaded biquad filters (TDF-II) float and Q31 - single and banks
+ *              + add DSP_and_Math.hpp - C++17 templates (compile time shift/coefficients)
+ *              + add inline build (DSP_MATH_INLINE) - per-sample functions in DSP_and_Math_inline.h
+ *              + add host benchmark (Examples/Linux) - ns/sample, cycles/sample, MS/s and JSON
+ *              + add runtime dispatch (CPUID) - scalar/SSE2/SSE4.1/AVX2/AVX-512 array kernels
+ *              + add radix-2/4 FFT (complex and real input) - plans with twiddle/bit reversal tables
+ *              + add Q15/Q31 FFT (radix-2, block floating point) - constant twiddle tables, int16 input
+ *              + add harmonic analyzer - magnitude/phase of K harmonics, THD-F, THD-R (Goertzel bank or FFT)
+ *              + add block pipeline - chain of stages (filters, rms, Goertzel) in place, block by block
+ *              + add block version of iir low pass filter float
+ *              + add SPSC ring buffer (lock free) - int16, int32 and float, batch push/pop with contiguous spans
+ *              + add worker pool and channel engine (DSP_and_Math_threads.c) - pinned workers, work stealing, per block barrier
+ *              + add segmented Goertzel - independent segments (SIMD lanes, threads) joined by rotation of their partial DFTs (double)
+ *              + add scan version of iir single pole low/high pass float (first order scan) - 16 samples lookahead (SIMD), segments on threads
+ *              + add decimation - CIC (integer only) and polyphase FIR Q15 (SIMD) stages, int16 input
+ *              + add FIR filter float (direct form SIMD, overlap-save FFT for long filters - short blocks in direct form), Q15 and Q31 (SIMD)
  ******************************************************************************/
 
 #ifndef _DSP_AND_MATH_H_
 #define _DSP_AND_MATH_H_
 
 #include    <stdint.h>
+#include    <stddef.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -56,11 +84,128 @@ extern "C"
 #define     RMS_SAMPLE_OPTIMIZED   // using integer square root algorithm - more efficient
 
 
+/*
+ * INLINE BUILD - per-sample functions (filters, rms and Goertzel "add sample")
+ * as "static inline" in every file that includes this header (see
+ * "DSP_and_Math_inline.h"). Define it here or in the compiler flags
+ * (-DDSP_MATH_INLINE) for all files, including "DSP_and_Math.c".
+ */
+//#define     DSP_MATH_INLINE
+
+#if defined(DSP_MATH_INLINE)
+#define     DSP_MATH_KERNEL     static inline
+#else
+#define     DSP_MATH_KERNEL
+#endif
+
+
+/*
+ * RUNTIME DISPATCH (x86 with GCC/clang) - array/block functions compiled for
+ * scalar, SSE2, SSE4.1, AVX2 and AVX-512 (see "DSP_and_Math_simd.h") and the
+ * best level supported by the CPU selected once at startup (CPUID).
+ * Environment variable "DSP_MATH_SIMD" (scalar, sse2, sse4.1, avx2, avx512)
+ * forces a lower level - e.g. benchmarks. Define DSP_MATH_NO_DISPATCH to use
+ * only the instruction set enabled in the compiler flags.
+ */
+//#define     DSP_MATH_NO_DISPATCH
+
+#if !defined(DSP_MATH_NO_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define     DSP_MATH_DISPATCH
+#endif
+
+/* SIMD levels - "dspSimd_GetLevel()" / "dspSimd_SetLevel()" */
+#define     DSP_SIMD_SCALAR     0
+#define     DSP_SIMD_SSE2       1
+#define     DSP_SIMD_SSE4_1     2
+#define     DSP_SIMD_AVX2       3
+#define     DSP_SIMD_AVX512     4
+
+
 #define     PI                  3.141592653589793f
 #define     TWO_PI              6.283185307179586f
 #define     SQRT_OF_2           1.414213562373095f
 #define     SQRT_OF_3           1.732050807568877f
 
+/* SINE WAVE OSCILLATOR - samples between phasor renormalization (multiple of 4) */
+#define     SINE_OSC_RENORM_PERIOD              64
+
+/* GOERTZEL BANK - number of floats in the buffer used by "goertzelBankInit_Float()" */
+#define     GOERTZEL_BANK_BUFFER_SIZE(bins)     (8 * (bins))
+
+/* GOERTZEL SEGMENTS - independent recursions (SIMD lanes), samples of each one and minimum of the last one */
+#define     GOERTZEL_SEGMENT_LANES              8
+#define     GOERTZEL_SEGMENT_LENGTH             512
+#define     GOERTZEL_SEGMENT_MIN_LANE           16
+
+/* IIR SCAN - samples solved together (lookahead - fixed) and floats of the coefficients of the kernel */
+#define     IIR_SCAN_LOOKAHEAD                  16
+#define     IIR_SCAN_POWERS_SIZE                (4 * IIR_SCAN_LOOKAHEAD)
+
+/* BIQUAD - number of coefficients (b0, b1, b2, a1, a2) and states (s1, s2) of a cascade */
+#define     IIR_BIQUAD_COEFFS_SIZE(stages)      (5 * (stages))
+#define     IIR_BIQUAD_STATE_SIZE(stages)       (2 * (stages))
+
+/* FFT - number of floats (twiddles) and uint32_t (bit reversal) of a plan of "size" points */
+#define     FFT_TWIDDLE_SIZE(size)              (2 * (size))
+#define     FFT_BITREV_SIZE(size)               (size)
+
+/* FFT FIXED - largest size of the Q15/Q31 versions (constant tables generated for 1024 points) */
+#define     FFT_FIXED_MAX_SIZE                  1024
+
+/* HARMONIC ANALYZER - FFT used when K > log2(N) (N power of two), otherwise Goertzel bank */
+#define     HARMONIC_USE_FFT(harmonics, size)       ((((size) & ((size) - 1)) == 0) && ((size) >= 4) && \
+                                                     (((harmonics) >= 31) || ((1UL << (harmonics)) > (size))))
+/* HARMONIC ANALYZER - floats of "buffer" and uint32_t of "bitrev" used by "harmonicAnalyzerInit_Float()" */
+#define     HARMONIC_BUFFER_SIZE(harmonics, size)   ((2 * (harmonics)) + \
+                                                     ((HARMONIC_USE_FFT(harmonics, size) && ((3 * (size)) > GOERTZEL_BANK_BUFFER_SIZE(harmonics))) ? \
+                                                      (FFT_TWIDDLE_SIZE(size) + (size)) : GOERTZEL_BANK_BUFFER_SIZE(harmonics)))
+#define     HARMONIC_BITREV_SIZE(harmonics, size)   (HARMONIC_USE_FFT(harmonics, size) ? FFT_BITREV_SIZE(size) : 1)
+
+/* CIC DECIMATOR - maximum number of integrator/comb stages */
+#define     CIC_DECIMATOR_MAX_STAGES            6
+
+/* FIR DECIMATOR / FIR FILTER - input samples copied to the history per step (small on MCUs) */
+#if !defined(FIR_DECIMATOR_CHUNK)
+#if defined(__MSP430__) || defined(__AVR__)
+#define     FIR_DECIMATOR_CHUNK                 32
+#else
+#define     FIR_DECIMATOR_CHUNK                 256
+#endif
+#endif
+
+/* FIR DECIMATOR - number of int16_t of "buffer" used by "firDecimatorInit_Q15()" (taps + history) */
+#define     FIR_DECIMATOR_BUFFER_SIZE(taps)     ((2 * (taps)) - 1 + FIR_DECIMATOR_CHUNK)
+
+/* DECIMATOR - maximum FIR stages after the CIC stage */
+#define     DECIMATOR_MAX_FIR_STAGES            4
+
+/* FIR FILTER - longer float filters use the overlap-save FFT convolution instead of the direct form (SIMD direct form is faster up to ~256-384 taps) */
+#if !defined(FIR_DIRECT_MAX_TAPS)
+#define     FIR_DIRECT_MAX_TAPS                 256
+#endif
+#define     FIR_USE_FFT(taps)                   ((taps) > FIR_DIRECT_MAX_TAPS)
+/* FIR FILTER - maximum FFT size of the overlap-save engine (power of two >= 4 * taps) */
+#define     FIR_FFT_MAX_SIZE(taps)              (8 * (taps))
+/* FIR FILTER - cost of one overlap-save segment (N * log2(N) * ratio) in direct form outputs of one tap - fewer new samples use the direct form (x86 SIMD: ~24) */
+#if !defined(FIR_FFT_COST_RATIO)
+#define     FIR_FFT_COST_RATIO                  24
+#endif
+/* FIR FILTER - floats of "buffer" and uint32_t of "bitrev" used by "firFilterInit_Float()" */
+#define     FIR_FLOAT_BUFFER_SIZE(taps)         (FIR_USE_FFT(taps) ? ((5 * FIR_FFT_MAX_SIZE(taps)) + (taps)) : ((2 * (taps)) - 1 + FIR_DECIMATOR_CHUNK))
+#define     FIR_FLOAT_BITREV_SIZE(taps)         (FIR_USE_FFT(taps) ? (FIR_FFT_MAX_SIZE(taps) / 2) : 1)
+/* FIR FILTER - int16_t / int32_t of "buffer" used by "firFilterInit_Q15()" / "firFilterInit_Q31()" */
+#define     FIR_Q15_BUFFER_SIZE(taps)           FIR_DECIMATOR_BUFFER_SIZE(taps)
+#define     FIR_Q31_BUFFER_SIZE(taps)           ((2 * (taps)) - 1 + FIR_DECIMATOR_CHUNK)
+
+/* SPSC RING BUFFER - bytes between producer and consumer indices (cache line, small on MCUs without cache) */
+#if !defined(DSP_RING_CACHE_LINE)
+#if defined(__MSP430__) || defined(__AVR__)
+#define     DSP_RING_CACHE_LINE                 2
+#else
+#define     DSP_RING_CACHE_LINE                 64
+#endif
+#endif
+
 
 
 
@@ -83,6 +228,13 @@ enum sineWaveGen
 };
 
 
+enum ddsInterpolation
+{
+    DDS_INTERP_LINEAR = 0,
+    DDS_INTERP_QUADRATIC
+};
+
+
 
 
 
@@ -115,6 +267,52 @@ struct rms_struct_int16_
 typedef struct rms_struct_int16_ rms_int16_t;
 
 
+/* used to store rms parameters - sliding window, float samples */
+struct rms_sliding_float_
+{
+    uint_fast16_t size;             // window size
+    uint_fast16_t size_counter;     // samples in the window (up to size)
+    uint_fast16_t index;            // position of oldest sample in the ring buffer
+    float * buffer;                 // ring buffer with last "size" samples
+    float acc;                      // running sum of squares
+    float acc_window;               // exact sum of current window - resync every "size" samples
+    float rmsValue;
+};
+/* used to store rms parameters - sliding window, float samples */
+typedef struct rms_sliding_float_ rms_sliding_float_t;
+
+
+/* used to store rms parameters - sliding window, int16_t samples */
+struct rms_sliding_int16_
+{
+    uint_fast16_t size;             // window size
+    uint_fast16_t size_counter;     // samples in the window (up to size)
+    uint_fast16_t index;            // position of oldest sample in the ring buffer
+    int16_t * buffer;               // ring buffer with last "size" samples
+    uint64_t acc;                   // running sum of squares (exact)
+    float rmsValue;
+};
+/* used to store rms parameters - sliding window, int16_t samples */
+typedef struct rms_sliding_int16_ rms_sliding_int16_t;
+
+
+/* used to store power meter parameters - int16_t voltage and current samples */
+struct power_meter_int16_
+{
+    int16_t dcLevel_V;              // dc level of voltage samples
+    int16_t dcLevel_I;              // dc level of current samples
+    float Vrms;
+    float Irms;
+    float activePower;              // mean(v * i)
+    float apparentPower;            // Vrms * Irms
+    float powerFactor;              // activePower / apparentPower
+    int64_t energy_acc;             // accumulated sum(v * i) of all blocks
+    uint64_t samples_acc;           // accumulated number of samples
+};
+/* used to store power meter parameters - int16_t voltage and current samples */
+typedef struct power_meter_int16_ power_meter_int16_t;
+
+
 
 /******************************************************************************
  *                  STRUCT - SINE WAVE PARAMETERS
@@ -134,6 +332,37 @@ struct sine_wave_parameters_
 typedef struct sine_wave_parameters_ sine_wave_parameters;
 
 
+/* used to store sine - generate wave sample by sample (oscillator - rotating phasor) */
+struct sine_wave_oscillator_
+{
+    float freq;
+    float phase_rad;
+    float amplitude;
+    float V_offset;
+    uint_fast16_t points;
+    uint_fast16_t counter;      // samples since last renormalization
+    float cos_step;             // cos(increment)
+    float sin_step;             // sin(increment)
+    float cos_value;            // phasor - cos(acc + phase)
+    float sin_value;            // phasor - sin(acc + phase)
+};
+/* used to store sine - generate wave sample by sample (oscillator - rotating phasor) */
+typedef struct sine_wave_oscillator_ sine_wave_oscillator;
+
+
+/* used to store DDS (NCO) parameters - 32 bit phase accumulator */
+struct dds_parameters_
+{
+    uint32_t phase_acc;         // current phase - 2^32 == 2*pi (wrap around)
+    uint32_t phase_inc;         // tuning word - phase increment per sample
+    uint_fast8_t interpolation; // DDS_INTERP_LINEAR or DDS_INTERP_QUADRATIC
+    float amplitude;            // used only in float output
+    float V_offset;             // used only in float output
+};
+/* used to store DDS (NCO) parameters - 32 bit phase accumulator */
+typedef struct dds_parameters_ dds_parameters;
+
+
 
 /******************************************************************************
  *                  STRUCT - HIGH PASS FILTERS PARAMETERS
@@ -239,6 +468,96 @@ struct struct_iir_lowpass_fixed_fast_
 typedef struct struct_iir_lowpass_fixed_fast_ iirLowPassFixedFast_t;
 
 
+/* used to store a bank of low pass filters float parameters - one entry per channel (SoA) */
+struct struct_iir_lowpass_float_bank_
+{
+    uint_fast16_t channels;     // number of channels
+    float * b0;                 // input coefficients - array with "channels" elements
+    float * a1;                 // output coefficients - array with "channels" elements
+    float * prev_y;             // last filtered samples - array with "channels" elements
+};
+/* used to store a bank of low pass filters float parameters - one entry per channel (SoA) */
+typedef struct struct_iir_lowpass_float_bank_ iirLowPassFloatBank_t;
+
+
+/* used to store a bank of low pass filters fixed parameters - one entry per channel (SoA) */
+struct struct_iir_lowpass_fixed_bank_
+{
+    uint_fast16_t channels;     // number of channels
+    uint_fast8_t shift_size;    // number of shift used in fixed math - shared by all channels
+    int32_t RoundNumber;        // shared by all channels
+    int32_t * A_param;          // array with "channels" elements
+    int32_t * SHIFTED_last_filtered;    // array with "channels" elements
+};
+/* used to store a bank of low pass filters fixed parameters - one entry per channel (SoA) */
+typedef struct struct_iir_lowpass_fixed_bank_ iirLowPassFixedBank_t;
+
+
+/* used to store a bank of low pass filters fixed fast parameters - one entry per channel (SoA) */
+struct struct_iir_lowpass_fixed_fast_bank_
+{
+    uint_fast16_t channels;     // number of channels
+    int32_t * attenuation;      // array with "channels" elements
+    int32_t * filter_acc;       // array with "channels" elements
+};
+/* used to store a bank of low pass filters fixed fast parameters - one entry per channel (SoA) */
+typedef struct struct_iir_lowpass_fixed_fast_bank_ iirLowPassFixedFastBank_t;
+
+
+
+/******************************************************************************
+ *                  STRUCT - BIQUAD FILTERS (CASCADE OF SECOND ORDER SECTIONS)
+ ******************************************************************************/
+/* used to store cascaded biquad filter float parameters (transposed direct form II) */
+struct struct_iir_biquad_float_
+{
+    uint_fast8_t stages;        // number of second order sections
+    const float * coeffs;       // 5 per stage: b0, b1, b2, a1, a2 - "IIR_BIQUAD_COEFFS_SIZE(stages)"
+    float * state;              // 2 per stage: s1, s2 - "IIR_BIQUAD_STATE_SIZE(stages)"
+    float y;                    // filtered output
+};
+/* used to store cascaded biquad filter float parameters (transposed direct form II) */
+typedef struct struct_iir_biquad_float_ iirBiquadFloat_t;
+
+
+/* used to store cascaded biquad filter fixed parameters (Q31 samples, 64 bit accumulation) */
+struct struct_iir_biquad_fixed_
+{
+    uint_fast8_t stages;        // number of second order sections
+    uint_fast8_t postShift;     // coefficients in Q(31 - postShift) - allow coefficients up to 2^postShift
+    const int32_t * coeffs;     // 5 per stage: b0, b1, b2, a1, a2 - "IIR_BIQUAD_COEFFS_SIZE(stages)"
+    int64_t * state;            // 2 per stage: s1, s2 - "IIR_BIQUAD_STATE_SIZE(stages)"
+    int32_t y;                  // filtered output
+};
+/* used to store cascaded biquad filter fixed parameters (Q31 samples, 64 bit accumulation) */
+typedef struct struct_iir_biquad_fixed_ iirBiquadFixed_t;
+
+
+/* used to store a bank of cascaded biquad filters float parameters - one entry per channel (SoA) */
+struct struct_iir_biquad_float_bank_
+{
+    uint_fast16_t channels;     // number of channels
+    uint_fast8_t stages;        // number of second order sections - shared by all channels
+    float * coeffs;             // coeffs[(stage * 5 + k) * channels + channel] - "channels * IIR_BIQUAD_COEFFS_SIZE(stages)"
+    float * state;              // state[(stage * 2 + k) * channels + channel] - "channels * IIR_BIQUAD_STATE_SIZE(stages)"
+};
+/* used to store a bank of cascaded biquad filters float parameters - one entry per channel (SoA) */
+typedef struct struct_iir_biquad_float_bank_ iirBiquadFloatBank_t;
+
+
+/* used to store a bank of cascaded biquad filters fixed parameters - one entry per channel (SoA) */
+struct struct_iir_biquad_fixed_bank_
+{
+    uint_fast16_t channels;     // number of channels
+    uint_fast8_t stages;        // number of second order sections - shared by all channels
+    uint_fast8_t postShift;     // coefficients in Q(31 - postShift) - shared by all channels
+    int32_t * coeffs;           // coeffs[(stage * 5 + k) * channels + channel] - "channels * IIR_BIQUAD_COEFFS_SIZE(stages)"
+    int64_t * state;            // state[(stage * 2 + k) * channels + channel] - "channels * IIR_BIQUAD_STATE_SIZE(stages)"
+};
+/* used to store a bank of cascaded biquad filters fixed parameters - one entry per channel (SoA) */
+typedef struct struct_iir_biquad_fixed_bank_ iirBiquadFixedBank_t;
+
+
 
 /******************************************************************************
  *                  STRUCT - GOERTZEL DFT PARAMETERS
@@ -258,6 +577,22 @@ struct goertzel_struct_array_float_
 typedef struct goertzel_struct_array_float_ goertzel_array_float_t;
 
 
+/* used to store goertzel parameters - segmented version (long arrays, coefficients in double) */
+struct goertzel_struct_segmented_float_
+{
+    size_t size_array;
+    double w;                       // 2*pi*bin / size_array
+    double cr;
+    double ci;
+    double coeff;
+    float real_float;
+    float imag_float;
+    float result;
+};
+/* used to store goertzel parameters - segmented version (long arrays, coefficients in double) */
+typedef struct goertzel_struct_segmented_float_ goertzel_segmented_float_t;
+
+
 /* used to store goertzel parameters - fixed64 array version */
 struct goertzel_struct_array_fixed64_
 {
@@ -274,6 +609,24 @@ struct goertzel_struct_array_fixed64_
 typedef struct goertzel_struct_array_fixed64_ goertzel_array_fixed64_t;
 
 
+/* used to store goertzel parameters - float bank version (K bins, SoA) */
+struct goertzel_struct_bank_float_
+{
+    uint_fast16_t size_array;
+    uint_fast16_t bins;         // number of bins
+    float * cr_float;           // each pointer is an array with "bins" elements
+    float * ci_float;
+    float * coeff_float;
+    float * sprev_float;
+    float * sprev_float2;
+    float * real_float;
+    float * imag_float;
+    float * result;
+};
+/* used to store goertzel parameters - float bank version (K bins, SoA) */
+typedef struct goertzel_struct_bank_float_ goertzel_bank_float_t;
+
+
 /* used to store goertzel parameters - float sample version */
 struct goertzel_struct_sample_float_
 {
@@ -313,6 +666,214 @@ struct goertzel_struct_sample_fixed64_
 typedef struct goertzel_struct_sample_fixed64_ goertzel_sample_fixed64_t;
 
 
+/* used to store goertzel parameters - sliding DFT float version */
+struct goertzel_struct_sliding_float_
+{
+    uint_fast16_t size_array;   // window size
+    uint_fast16_t index;        // position of oldest sample in the ring buffer
+    float * buffer;             // ring buffer with last "size_array" samples
+    float cr_float;
+    float ci_float;
+    float coeff_float;
+    float sprev_float;          // goertzel states - resynchronize every N samples
+    float sprev_float2;
+    float real_float;
+    float imag_float;
+    float result;
+    float phase_rad;
+};
+/* used to store goertzel parameters - sliding DFT float version */
+typedef struct goertzel_struct_sliding_float_ goertzel_sliding_float_t;
+
+
+/* used to store goertzel parameters - sliding DFT int16 version */
+struct goertzel_struct_sliding_int16_
+{
+    uint_fast16_t size_array;   // window size
+    uint_fast16_t index;        // position of oldest sample in the ring buffer
+    int16_t * buffer;           // ring buffer with last "size_array" samples
+    float cr_float;
+    float ci_float;
+    float coeff_float;
+    float sprev_float;          // goertzel states - resynchronize every N samples
+    float sprev_float2;
+    float real_float;
+    float imag_float;
+    float result;
+    float phase_rad;
+};
+/* used to store goertzel parameters - sliding DFT int16 version */
+typedef struct goertzel_struct_sliding_int16_ goertzel_sliding_int16_t;
+
+
+/******************************************************************************
+ *                  FFT STRUCTS
+ ******************************************************************************/
+/* FFT plan - twiddles and bit reversal calculated once (buffers from the user) */
+struct fft_plan_float_
+{
+    uint32_t size;                  // points (complex) or samples (real input)
+    uint32_t size_complex;          // size of the complex transform (size / 2 for real input)
+    uint_fast8_t log2size;          // log2(size_complex)
+    const float * twiddle;          // W_m^k (re, im) of each span m, table of span m at [m - 2]
+    const float * twiddle_real;     // W_size^k, k = 0..size/4 - real input only (NULL otherwise)
+    const uint32_t * bitrev;        // bit reversed index of each complex point
+};
+/* FFT plan - twiddles and bit reversal calculated once (buffers from the user) */
+typedef struct fft_plan_float_ fft_plan_float_t;
+
+
+/******************************************************************************
+ *                  HARMONIC ANALYZER STRUCTS
+ ******************************************************************************/
+/* harmonic analyzer - K harmonics of a fundamental (Goertzel bank or FFT) */
+struct harmonic_analyzer_float_
+{
+    uint_fast16_t size_array;
+    uint_fast16_t harmonics;        // number of harmonics (1 = fundamental only)
+    float fundamental;              // bin of the fundamental (cycles in the array)
+    uint_fast8_t use_fft;           // 1: real FFT, 0: Goertzel bank
+    goertzel_bank_float_t bank;
+    fft_plan_float_t plan;
+    float * work;                   // FFT input/spectrum (size_array floats)
+    float * magnitude;              // amplitude (2*|X|/N) of each harmonic - [0] = fundamental
+    float * phase_rad;              // phase of each harmonic (referenced to the first sample)
+    float thd_f;                    // THD referenced to the fundamental
+    float thd_r;                    // THD referenced to the rms of all harmonics
+    float harmonic_rms;             // rms of harmonics 2..K
+};
+/* harmonic analyzer - K harmonics of a fundamental (Goertzel bank or FFT) */
+typedef struct harmonic_analyzer_float_ harmonic_analyzer_float_t;
+
+
+/******************************************************************************
+ *                  DECIMATION STRUCTS
+ ******************************************************************************/
+/* CIC decimator - N integrators at the input rate, N combs at the output rate (integer only) */
+struct cic_decimator_int16_
+{
+    uint_fast8_t stages;                                // N (1 ... CIC_DECIMATOR_MAX_STAGES)
+    uint_fast16_t ratio;                                // R - input samples per output
+    uint_fast8_t shift;                                 // output = sum >> shift (gain R^N)
+    uint_fast16_t phase;                                // input samples since the last output
+    uint32_t integrator[CIC_DECIMATOR_MAX_STAGES];      // modulo 2^32 - wrap around removed by the combs
+    uint32_t comb[CIC_DECIMATOR_MAX_STAGES];            // previous input of each comb
+};
+/* CIC decimator - N integrators at the input rate, N combs at the output rate (integer only) */
+typedef struct cic_decimator_int16_ cic_decimator_int16_t;
+
+/* FIR decimator - only the kept outputs are calculated (polyphase), Q15 taps */
+struct fir_decimator_q15_
+{
+    uint_fast16_t taps;
+    uint_fast16_t ratio;                                // D - input samples per output
+    uint_fast16_t phase;                                // input samples since the last output
+    int16_t * coeffs;                                   // taps in reverse order (oldest sample first)
+    int16_t * history;                                  // last "taps - 1" samples + one chunk
+};
+/* FIR decimator - only the kept outputs are calculated (polyphase), Q15 taps */
+typedef struct fir_decimator_q15_ fir_decimator_q15_t;
+
+/* decimator - CIC stage (optional) followed by FIR stages, int16 samples */
+struct decimator_int16_
+{
+    cic_decimator_int16_t * cic;                        // NULL = no CIC stage
+    fir_decimator_q15_t * fir[DECIMATOR_MAX_FIR_STAGES];
+    uint_fast8_t fir_count;
+    uint32_t ratio;                                     // total decimation
+};
+/* decimator - CIC stage (optional) followed by FIR stages, int16 samples */
+typedef struct decimator_int16_ decimator_int16_t;
+
+
+/******************************************************************************
+ *                  FIR FILTER STRUCTS
+ ******************************************************************************/
+/* FIR filter float - direct form (short filters) or overlap-save FFT convolution (long filters) */
+struct fir_float_
+{
+    uint32_t taps;
+    uint_fast8_t use_fft;                               // 1: overlap-save FFT, 0: direct form
+    float * coeffs;                                     // direct: taps in reverse order, FFT: spectrum of the taps
+    float * reversed;                                   // taps in reverse order (FFT: outputs of short blocks in direct form)
+    float * history;                                    // last "taps - 1" samples + new samples (chunk or segment)
+    float * work;                                       // FFT only - transform of the segment
+    uint32_t segment;                                   // FFT only - new samples per segment (FFT size - taps + 1)
+    uint32_t fill;                                      // FFT only - new samples in the current segment
+    uint32_t fft_min;                                   // FFT only - minimum new samples to transform (fewer: direct form)
+    fft_plan_float_t plan;                              // FFT only - real input plan
+};
+/* FIR filter float - direct form (short filters) or overlap-save FFT convolution (long filters) */
+typedef struct fir_float_ fir_float_t;
+
+/* FIR filter Q15 - FIR decimator with D = 1 */
+typedef struct fir_decimator_q15_ fir_q15_t;
+
+/* FIR filter Q31 - direct form, 64 bit accumulation */
+struct fir_q31_
+{
+    uint_fast16_t taps;
+    int32_t * coeffs;                                   // taps in reverse order (oldest sample first)
+    int32_t * history;                                  // last "taps - 1" samples + one chunk
+};
+/* FIR filter Q31 - direct form, 64 bit accumulation */
+typedef struct fir_q31_ fir_q31_t;
+
+
+/******************************************************************************
+ *                  PIPELINE STRUCTS
+ ******************************************************************************/
+/* pipeline stage - process "size" samples of "block" in place (or only read them) */
+typedef void (*dsp_stage_float_fn)(void * context, float * block, size_t size);
+
+/* pipeline stage - function and its struct (filter, rms, Goertzel...) */
+struct dsp_stage_float_
+{
+    dsp_stage_float_fn process;
+    void * context;
+};
+/* pipeline stage - function and its struct (filter, rms, Goertzel...) */
+typedef struct dsp_stage_float_ dsp_stage_float_t;
+
+/* pipeline - chain of stages run block by block (arrays from the user) */
+struct dsp_pipeline_float_
+{
+    dsp_stage_float_t * stages;     // array of stages
+    uint_fast8_t max_stages;        // elements of "stages"
+    uint_fast8_t count;             // stages added
+    float * block;                  // work block (int16_t input)
+    size_t block_size;              // samples per block
+};
+/* pipeline - chain of stages run block by block (arrays from the user) */
+typedef struct dsp_pipeline_float_ dsp_pipeline_float_t;
+
+
+/******************************************************************************
+ *                  SPSC RING BUFFER STRUCTS
+ ******************************************************************************/
+/* single producer / single consumer ring buffer - int16_t, int32_t or float samples */
+struct dsp_ring_
+{
+    void * buffer;                          // samples (array from the user)
+    size_t capacity;                        // number of samples - power of two
+    size_t mask;                            // capacity - 1
+    uint_fast8_t element_size;              // bytes per sample
+    uint8_t pad_0[DSP_RING_CACHE_LINE];
+    /* producer (write side) */
+    volatile size_t head;                   // samples written (free running index)
+    size_t tail_cache;                      // last "tail" read by the producer
+    volatile uint32_t overrun_count;        // writes with samples dropped (ring full)
+    volatile uint32_t overrun_samples;      // samples dropped
+    uint8_t pad_1[DSP_RING_CACHE_LINE];
+    /* consumer (read side) */
+    volatile size_t tail;                   // samples read (free running index)
+    size_t head_cache;                      // last "head" read by the consumer
+    uint8_t pad_2[DSP_RING_CACHE_LINE];
+};
+/* single producer / single consumer ring buffer - int16_t, int32_t or float samples */
+typedef struct dsp_ring_ dsp_ring_t;
+
+
 
 
 
@@ -320,11 +881,22 @@ typedef struct goertzel_struct_sample_fixed64_ goertzel_sample_fixed64_t;
  *                  MATH FUNCTIONS - prototypes
  ******************************************************************************/
 
+/******************************************************************************
+ *                  RUNTIME DISPATCH (SIMD LEVEL)
+ ******************************************************************************/
+uint_fast8_t dspSimd_Init(void);
+uint_fast8_t dspSimd_GetLevel(void);
+uint_fast8_t dspSimd_SetLevel(uint_fast8_t level);
+const char * dspSimd_LevelName(uint_fast8_t level);
+
 /******************************************************************************
  *                  SQRT FUNCTION - INTEGER VERSION
  ******************************************************************************/
 /* SQRT using integer math */
 int32_t sqrt_Int32(int32_t x);
+uint32_t isqrt32(uint32_t x);
+uint32_t isqrt64(uint64_t x);
+uint32_t isqrt32_Q16(uint32_t x);
 
 /******************************************************************************
  *                  RMS VALUE - ARRAY VERSION
@@ -332,11 +904,14 @@ int32_t sqrt_Int32(int32_t x);
 float rmsValueArray_Float_StdMath(const float * arrayIn, uint_fast16_t size, float dcLevel);
 float rmsValueArray_Int16_StdMath(const int16_t * arrayIn, uint_fast16_t size, int16_t dcLevel);
 
+uint64_t rmsSumSquaresArray_Int16(const int16_t * arrayIn, size_t size, int16_t dcLevel);
+float rmsValueArray_Int16_Acc64(const int16_t * arrayIn, size_t size, int16_t dcLevel);
+
 /******************************************************************************
  *                  RMS VALUE - SAMPLE BY SAMPLE VERSION
  ******************************************************************************/
-void rmsValueAddSample_Float(rms_float_t * inputStruct, float sample);
-void rmsValueAddSample_Int16(rms_int16_t * inputStruct, int16_t sample);
+DSP_MATH_KERNEL void rmsValueAddSample_Float(rms_float_t * inputStruct, float sample);
+DSP_MATH_KERNEL void rmsValueAddSample_Int16(rms_int16_t * inputStruct, int16_t sample);
 
 void rmsClearStruct_Float(rms_float_t * inputStruct);
 void rmsClearStruct_Int16(rms_int16_t * inputStruct);
@@ -344,6 +919,24 @@ void rmsClearStruct_Int16(rms_int16_t * inputStruct);
 void rmsValueCalcRmsStdMath_Float(rms_float_t * inputStruct);
 void rmsValueCalcRmsStdMath_Int16(rms_int16_t * inputStruct);
 
+/******************************************************************************
+ *                  RMS VALUE - SLIDING WINDOW VERSION
+ ******************************************************************************/
+void rmsSlidingInit_Float(rms_sliding_float_t * inputStruct, float * buffer, uint_fast16_t size);
+DSP_MATH_KERNEL void rmsSlidingAddSample_Float(rms_sliding_float_t * inputStruct, float sample);
+void rmsSlidingCalcRms_Float(rms_sliding_float_t * inputStruct);
+
+void rmsSlidingInit_Int16(rms_sliding_int16_t * inputStruct, int16_t * buffer, uint_fast16_t size);
+DSP_MATH_KERNEL void rmsSlidingAddSample_Int16(rms_sliding_int16_t * inputStruct, int16_t sample);
+void rmsSlidingCalcRms_Int16(rms_sliding_int16_t * inputStruct);
+
+/******************************************************************************
+ *                  POWER METERING (VRMS, IRMS, POWER, PF)
+ ******************************************************************************/
+void powerMeterInit_Int16(power_meter_int16_t * meterStruct, int16_t dcLevel_V, int16_t dcLevel_I, uint_fast8_t doClean);
+void powerMeterCalc_Int16(power_meter_int16_t * meterStruct, const int16_t * arrayV, const int16_t * arrayI, size_t size);
+void powerMeterCalcInterleaved_Int16(power_meter_int16_t * meterStruct, const int16_t * arrayVI, size_t size);
+
 
 /******************************************************************************
  *                  SINE WAVE GENERATOR FUNCTIONS
@@ -353,6 +946,21 @@ void sineWaveGen_Array_Float(float * outputArray, float freq, float phase_rad, f
 void sineWaveGen_bySample_Init(sine_wave_parameters *inputParameters, float freq, float phase, float amp, float v_off, uint_fast16_t points, uint_fast8_t doClean);
 float sineWaveGen_GetSample(sine_wave_parameters *inputParameters);
 
+void sineWaveGenOsc_Array_Float(float * outputArray, float freq, float phase_rad, float amplitude, float V_offset, uint_fast16_t points, uint_fast8_t doClean);
+
+void sineWaveGenOsc_bySample_Init(sine_wave_oscillator *inputParameters, float freq, float phase, float amp, float v_off, uint_fast16_t points, uint_fast8_t doClean);
+float sineWaveGenOsc_GetSample(sine_wave_oscillator *inputParameters);
+
+void ddsGen_Init(dds_parameters *inputParameters, float freq, float phase, float amp, float v_off, uint_fast16_t points, uint_fast8_t interpolation, uint_fast8_t doClean);
+void ddsGen_SetFrequency(dds_parameters *inputParameters, float freq, uint_fast16_t points);
+void ddsGen_SetTuningWord(dds_parameters *inputParameters, uint32_t tuningWord);
+int32_t ddsGen_GetSample_Q31(dds_parameters *inputParameters);
+int16_t ddsGen_GetSample_Q15(dds_parameters *inputParameters);
+float ddsGen_GetSample_Float(dds_parameters *inputParameters);
+void ddsGen_Array_Float(dds_parameters *inputParameters, float * outputArray, size_t size);
+void ddsGen_Array_Q15(dds_parameters *inputParameters, int16_t * outputArray, size_t size);
+void ddsGen_Array_Q31(dds_parameters *inputParameters, int32_t * outputArray, size_t size);
+
 
 
 /******************************************************************************
@@ -362,44 +970,78 @@ float sineWaveGen_GetSample(sine_wave_parameters *inputParameters);
 /******************************************************************************
  *                  HIGH PASS FILTER FUNCTIONS
  ******************************************************************************/
-void iir_SinglePoleHighPass_Float_Init(iirHighPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean);
-//__inline void iir_SinglePoleHighPass_Float_Init(iirHighPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean);
-void iir_SinglePoleHighPass_Float(iirHighPassFloat_t * structInput, float xValueFloat);
-//__inline void iir_SinglePoleHighPass_Float(iirHighPassFloat_t * structInput, float xValueFloat);
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Float_Init(iirHighPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Float(iirHighPassFloat_t * structInput, float xValueFloat);
+void iir_SinglePoleHighPass_Float_Block(iirHighPassFloat_t * structInput, const float * arrayIn, float * arrayOut, size_t size);
+void iir_SinglePoleHighPass_Float_Scan(iirHighPassFloat_t * structInput, const float * arrayIn, float * arrayOut, size_t size);
 
-void iir_SinglePoleHighPass_Fixed_Init(iirHighPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-//__inline void iir_SinglePoleHighPass_Fixed_Init(iirHighPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-void iir_SinglePoleHighPass_Fixed(iirHighPassFixed_t * inputStuct, int32_t xValue);
-//__inline void iir_SinglePoleHighPass_Fixed(iirHighPassFixed_t * inputStuct, int32_t xValue);
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Fixed_Init(iirHighPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Fixed(iirHighPassFixed_t * inputStuct, int32_t xValue);
+void iir_SinglePoleHighPass_Fixed_Block(iirHighPassFixed_t * inputStuct, const int32_t * arrayIn, int32_t * arrayOut, size_t size);
 
-void iir_SinglePoleHighPass_FixedExtended_Init(iirHighPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-//__inline void iir_SinglePoleHighPass_FixedExtended_Init(iirHighPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-void iir_SinglePoleHighPass_FixedExtended(iirHighPassFixedExtended_t * inputStuct, int32_t xValue);
-//__inline void iir_SinglePoleHighPass_FixedExtended(iirHighPassFixedExtended_t * inputStuct, int32_t xValue);
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_FixedExtended_Init(iirHighPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_FixedExtended(iirHighPassFixedExtended_t * inputStuct, int32_t xValue);
+void iir_SinglePoleHighPass_FixedExtended_Block(iirHighPassFixedExtended_t * inputStuct, const int32_t * arrayIn, int32_t * arrayOut, size_t size);
 
 
 /******************************************************************************
  *                  LOW PASS FILTER FUNCTIONS
  ******************************************************************************/
-void iir_SinglePoleLowPass_Float_Init(iirLowPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean);
-//__inline void iir_SinglePoleLowPass_Float_Init(iirLowPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean);
-void iir_SinglePoleLowPass_Float(iirLowPassFloat_t * inputStruct, float xValueFloat);
-//__inline void iir_SinglePoleLowPass_Float(iirLowPassFloat_t * inputStruct, float xValueFloat);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Float_Init(iirLowPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Float(iirLowPassFloat_t * inputStruct, float xValueFloat);
+void iir_SinglePoleLowPass_Float_Block(iirLowPassFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size);
+void iir_SinglePoleLowPass_Float_Scan(iirLowPassFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size);
+float iir_FirstOrderScan_Float(float b0, float b1, float a1, const float * arrayIn, float * arrayOut, size_t size, float xInit, float yInit);
+
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed_Init(iirLowPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed(iirLowPassFixed_t * inputStruct, int32_t xValue);
 
-void iir_SinglePoleLowPass_Fixed_Init(iirLowPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-//__inline void iir_SinglePoleLowPass_Fixed_Init(iirLowPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-void iir_SinglePoleLowPass_Fixed(iirLowPassFixed_t * inputStruct, int32_t xValue);
-//__inline void iir_SinglePoleLowPass_Fixed(iirLowPassFixed_t * inputStruct, int32_t xValue);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_FixedExtended_Init(iirLowPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_FixedExtended(iirLowPassFixedExtended_t * inputStruct, int32_t xValue);
 
-void iir_SinglePoleLowPass_FixedExtended_Init(iirLowPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-//__inline void iir_SinglePoleLowPass_FixedExtended_Init(iirLowPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
-void iir_SinglePoleLowPass_FixedExtended(iirLowPassFixedExtended_t * inputStruct, int32_t xValue);
-//__inline void iir_SinglePoleLowPass_FixedExtended(iirLowPassFixedExtended_t * inputStruct, int32_t xValue);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed_Fast_Init(iirLowPassFixedFast_t * structInput, int_fast8_t attenuation, int_fast8_t doClean);
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed_Fast(iirLowPassFixedFast_t * inputStruct, int32_t xValue);
 
-void iir_SinglePoleLowPass_Fixed_Fast_Init(iirLowPassFixedFast_t * structInput, int_fast8_t attenuation, int_fast8_t doClean);
-//__inline void iir_SinglePoleLowPass_Fixed_Fast_Init(iirLowPassFixedFast_t * structInput, int_fast8_t attenuation, int_fast8_t doClean);
-void iir_SinglePoleLowPass_Fixed_Fast(iirLowPassFixedFast_t * inputStruct, int32_t xValue);
-//__inline void iir_SinglePoleLowPass_Fixed_Fast(iirLowPassFixedFast_t * inputStruct, int32_t xValue);
+void iir_SinglePoleLowPass_Float_Bank_Init(iirLowPassFloatBank_t * bankInput, float * b0, float * a1, float * prev_y, uint_fast16_t channels, float cutoffFreq, uint_fast8_t doClean);
+void iir_SinglePoleLowPass_Float_Bank_SetChannel(iirLowPassFloatBank_t * bankInput, uint_fast16_t channel, float cutoffFreq, uint_fast8_t doClean);
+void iir_SinglePoleLowPass_Float_Bank_Frame(iirLowPassFloatBank_t * bankInput, const float * frameIn, float * frameOut);
+void iir_SinglePoleLowPass_Float_Bank_Block(iirLowPassFloatBank_t * bankInput, const float * arrayIn, float * arrayOut, size_t frames);
+
+void iir_SinglePoleLowPass_Fixed_Bank_Init(iirLowPassFixedBank_t * bankInput, int32_t * A_param, int32_t * state, uint_fast16_t channels, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean);
+void iir_SinglePoleLowPass_Fixed_Bank_SetChannel(iirLowPassFixedBank_t * bankInput, uint_fast16_t channel, float cutoffFreq, uint_fast8_t doClean);
+void iir_SinglePoleLowPass_Fixed_Bank_Frame(iirLowPassFixedBank_t * bankInput, const int32_t * frameIn, int32_t * frameOut);
+void iir_SinglePoleLowPass_Fixed_Bank_Block(iirLowPassFixedBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames);
+
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_Init(iirLowPassFixedFastBank_t * bankInput, int32_t * attenuation, int32_t * filter_acc, uint_fast16_t channels, int_fast8_t attenuationValue, uint_fast8_t doClean);
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_SetChannel(iirLowPassFixedFastBank_t * bankInput, uint_fast16_t channel, int_fast8_t attenuationValue, uint_fast8_t doClean);
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_Frame(iirLowPassFixedFastBank_t * bankInput, const int32_t * frameIn, int32_t * frameOut);
+void iir_SinglePoleLowPass_Fixed_Fast_Bank_Block(iirLowPassFixedFastBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames);
+
+
+/******************************************************************************
+ *                  BIQUAD FILTER FUNCTIONS (CASCADE OF SECOND ORDER SECTIONS)
+ ******************************************************************************/
+void iir_Biquad_Design_LowPass(float * coeffs, float cutoffFreq, float q);
+void iir_Biquad_Design_HighPass(float * coeffs, float cutoffFreq, float q);
+void iir_Biquad_Coeffs_ToFixed(const float * coeffsIn, int32_t * coeffsOut, uint_fast8_t stages, uint_fast8_t postShift);
+
+void iir_Biquad_Float_Init(iirBiquadFloat_t * structInput, const float * coeffs, float * state, uint_fast8_t stages, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_Biquad_Float(iirBiquadFloat_t * inputStruct, float xValueFloat);
+void iir_Biquad_Float_Block(iirBiquadFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size);
+
+void iir_Biquad_Fixed_Init(iirBiquadFixed_t * structInput, const int32_t * coeffs, int64_t * state, uint_fast8_t stages, uint_fast8_t postShift, uint_fast8_t doClean);
+DSP_MATH_KERNEL void iir_Biquad_Fixed(iirBiquadFixed_t * inputStruct, int32_t xValue);
+void iir_Biquad_Fixed_Block(iirBiquadFixed_t * inputStruct, const int32_t * arrayIn, int32_t * arrayOut, size_t size);
+
+void iir_Biquad_Float_Bank_Init(iirBiquadFloatBank_t * bankInput, float * coeffs, float * state, uint_fast16_t channels, uint_fast8_t stages, const float * coeffsIn, uint_fast8_t doClean);
+void iir_Biquad_Float_Bank_SetChannel(iirBiquadFloatBank_t * bankInput, uint_fast16_t channel, const float * coeffsIn, uint_fast8_t doClean);
+void iir_Biquad_Float_Bank_Frame(iirBiquadFloatBank_t * bankInput, const float * frameIn, float * frameOut);
+void iir_Biquad_Float_Bank_Block(iirBiquadFloatBank_t * bankInput, const float * arrayIn, float * arrayOut, size_t frames);
+
+void iir_Biquad_Fixed_Bank_Init(iirBiquadFixedBank_t * bankInput, int32_t * coeffs, int64_t * state, uint_fast16_t channels, uint_fast8_t stages, uint_fast8_t postShift, const int32_t * coeffsIn, uint_fast8_t doClean);
+void iir_Biquad_Fixed_Bank_SetChannel(iirBiquadFixedBank_t * bankInput, uint_fast16_t channel, const int32_t * coeffsIn, uint_fast8_t doClean);
+void iir_Biquad_Fixed_Bank_Frame(iirBiquadFixedBank_t * bankInput, const int32_t * frameIn, int32_t * frameOut);
+void iir_Biquad_Fixed_Bank_Block(iirBiquadFixedBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames);
 
 
 /******************************************************************************
@@ -409,24 +1051,152 @@ void goertzelArrayInit_Float(goertzel_array_float_t * inputStruct, float bin, ui
 void goertzelArrayFloat_Float(goertzel_array_float_t * inputStruct, const float * arrayInput);
 void goertzelArrayInt16_Float(goertzel_array_float_t * inputStruct, const int16_t * arrayInput);
 
+void goertzelSegmentedInit_Float(goertzel_segmented_float_t * inputStruct, double bin, size_t size_array);
+void goertzelArraySegmentedInt16_Float(goertzel_segmented_float_t * inputStruct, const int16_t * arrayInput);
+void goertzelSegmentStateInt16_Float(const goertzel_segmented_float_t * inputStruct, const int16_t * arrayInput, size_t size, double * state);
+void goertzelSegmentCombine_Float(const goertzel_segmented_float_t * inputStruct, double * state, const double * partial, size_t size);
+void goertzelSegmentResult_Float(goertzel_segmented_float_t * inputStruct, const double * state);
+
 void goertzelArrayInit_Fixed64(goertzel_array_fixed64_t * inputStruct, float bin, uint_fast16_t size_array, uint_fast8_t shift);
 void goertzelArrayInt16_Fixed64(goertzel_array_fixed64_t * inputStruct, const int16_t * arrayInput);
 
+void goertzelBankInit_Float(goertzel_bank_float_t * inputStruct, float * buffer, const float * binList, uint_fast16_t bins, uint_fast16_t size_array);
+void goertzelBankFloat_Float(goertzel_bank_float_t * inputStruct, const float * arrayInput);
+void goertzelBankInt16_Float(goertzel_bank_float_t * inputStruct, const int16_t * arrayInput);
+
 void goertzelSampleInit_Float(goertzel_sample_float_t * inputStruct, float bin, uint_fast16_t size_array);
-void goertzelSampleAddFloat_Float(goertzel_sample_float_t * inputStruct, float sample);
-//__inline void goertzelSampleAddFloat_Float(goertzel_sample_float_t * inputStruct, float sample);
-void goertzelSampleAddInt16_Float(goertzel_sample_float_t * inputStruct, int16_t sample);
-//__inline void goertzelSampleAddInt16_Float(goertzel_sample_float_t * inputStruct, int16_t sample);
+DSP_MATH_KERNEL void goertzelSampleAddFloat_Float(goertzel_sample_float_t * inputStruct, float sample);
+DSP_MATH_KERNEL void goertzelSampleAddInt16_Float(goertzel_sample_float_t * inputStruct, int16_t sample);
 void goertzelSampleCalc_Float(goertzel_sample_float_t * inputStruct);
 
 void goertzelSampleInit_Fixed64(goertzel_sample_fixed64_t* inputStruct, float bin, uint_fast16_t size_array, uint_fast8_t shift);
-void goertzelSampleAddInt16_Fixed64(goertzel_sample_fixed64_t * inputStruct, int16_t sample);
-//__inline void goertzelSampleAddInt16_Fixed64(goertzel_sample_fixed64_t * inputStruct, int16_t sample);
+DSP_MATH_KERNEL void goertzelSampleAddInt16_Fixed64(goertzel_sample_fixed64_t * inputStruct, int16_t sample);
 void goertzelSampleCalc_Fixed64(goertzel_sample_fixed64_t * inputStruct);
 
+void goertzelSlidingInit_Float(goertzel_sliding_float_t * inputStruct, float * buffer, float bin, uint_fast16_t size_array);
+void goertzelSlidingAddFloat_Float(goertzel_sliding_float_t * inputStruct, float sample);
+void goertzelSlidingCalc_Float(goertzel_sliding_float_t * inputStruct);
+
+void goertzelSlidingInit_Int16(goertzel_sliding_int16_t * inputStruct, int16_t * buffer, float bin, uint_fast16_t size_array);
+void goertzelSlidingAddInt16_Float(goertzel_sliding_int16_t * inputStruct, int16_t sample);
+void goertzelSlidingCalcInt16_Float(goertzel_sliding_int16_t * inputStruct);
+
+
+/******************************************************************************
+ *                  FFT FUNCTIONS
+ ******************************************************************************/
+uint_fast8_t fftPlanInit_Float(fft_plan_float_t * plan, float * twiddle, uint32_t * bitrev, uint32_t size);
+uint_fast8_t fftRealPlanInit_Float(fft_plan_float_t * plan, float * twiddle, uint32_t * bitrev, uint32_t size);
+
+void fftComplex_Float(const fft_plan_float_t * plan, float * data);
+void fftComplexInverse_Float(const fft_plan_float_t * plan, float * data);
+void fftReal_Float(const fft_plan_float_t * plan, float * data);
+void fftRealInverse_Float(const fft_plan_float_t * plan, float * data);
+
+void fftComplexMagnitude_Float(const fft_plan_float_t * plan, const float * spectrum, float * magnitude);
+void fftRealMagnitude_Float(const fft_plan_float_t * plan, const float * spectrum, float * magnitude);
+
+uint_fast8_t fftComplex_Q15(int16_t * data, uint_fast16_t size);
+uint_fast8_t fftComplex_Q31(int32_t * data, uint_fast16_t size);
+uint_fast8_t fftReal_Q15(int16_t * data, uint_fast16_t size);
+uint_fast8_t fftReal_Q31(int32_t * data, uint_fast16_t size);
+
+void fftRealMagnitude_Q15(const int16_t * spectrum, uint32_t * magnitude, uint_fast16_t size, uint_fast8_t exponent);
+void fftRealMagnitude_Q31(const int32_t * spectrum, uint32_t * magnitude, uint_fast16_t size, uint_fast8_t exponent);
+
+
+/******************************************************************************
+ *                  HARMONIC ANALYZER FUNCTIONS
+ ******************************************************************************/
+void harmonicAnalyzerInit_Float(harmonic_analyzer_float_t * inputStruct, float * buffer, uint32_t * bitrev, float fundamental, uint_fast16_t harmonics, uint_fast16_t size_array);
+void harmonicAnalyzerFloat_Float(harmonic_analyzer_float_t * inputStruct, const float * arrayInput);
+void harmonicAnalyzerInt16_Float(harmonic_analyzer_float_t * inputStruct, const int16_t * arrayInput);
+
+
+/******************************************************************************
+ *                  DECIMATION FUNCTIONS
+ ******************************************************************************/
+uint_fast8_t cicDecimatorInit_Int16(cic_decimator_int16_t * inputStruct, uint_fast8_t stages, uint_fast16_t ratio);
+size_t cicDecimate_Int16(cic_decimator_int16_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size);
+
+void firDesignLowPass_Q15(int16_t * coeffs, uint_fast16_t taps, float cutoff);
+void firDecimatorInit_Q15(fir_decimator_q15_t * inputStruct, int16_t * buffer, const int16_t * coeffs, uint_fast16_t taps, uint_fast16_t ratio);
+size_t firDecimate_Q15(fir_decimator_q15_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size);
+
+void decimatorInit_Int16(decimator_int16_t * inputStruct, cic_decimator_int16_t * cic);
+uint_fast8_t decimatorAddFir_Q15(decimator_int16_t * inputStruct, fir_decimator_q15_t * fir);
+size_t decimatorProcess_Int16(decimator_int16_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size);
+
+
+/******************************************************************************
+ *                  FIR FILTER FUNCTIONS
+ ******************************************************************************/
+uint_fast8_t firFilterInit_Float(fir_float_t * inputStruct, float * buffer, uint32_t * bitrev, const float * coeffs, uint32_t taps);
+void firFilter_Float(fir_float_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size);
+
+void firFilterInit_Q15(fir_q15_t * inputStruct, int16_t * buffer, const int16_t * coeffs, uint_fast16_t taps);
+void firFilter_Q15(fir_q15_t * inputStruct, const int16_t * arrayIn, int16_t * arrayOut, size_t size);
+
+void firFilterInit_Q31(fir_q31_t * inputStruct, int32_t * buffer, const int32_t * coeffs, uint_fast16_t taps);
+void firFilter_Q31(fir_q31_t * inputStruct, const int32_t * arrayIn, int32_t * arrayOut, size_t size);
+
+
+/******************************************************************************
+ *                  PIPELINE FUNCTIONS
+ ******************************************************************************/
+void dspPipelineInit_Float(dsp_pipeline_float_t * pipeline, dsp_stage_float_t * stages, uint_fast8_t maxStages, float * block, size_t blockSize);
+uint_fast8_t dspPipelineAddStage_Float(dsp_pipeline_float_t * pipeline, dsp_stage_float_fn process, void * context);
+
+uint_fast8_t dspPipelineAddHighPass_Float(dsp_pipeline_float_t * pipeline, iirHighPassFloat_t * filter);
+uint_fast8_t dspPipelineAddLowPass_Float(dsp_pipeline_float_t * pipeline, iirLowPassFloat_t * filter);
+uint_fast8_t dspPipelineAddBiquad_Float(dsp_pipeline_float_t * pipeline, iirBiquadFloat_t * filter);
+uint_fast8_t dspPipelineAddRms_Float(dsp_pipeline_float_t * pipeline, rms_float_t * rms);
+uint_fast8_t dspPipelineAddRmsSliding_Float(dsp_pipeline_float_t * pipeline, rms_sliding_float_t * rms);
+uint_fast8_t dspPipelineAddGoertzel_Float(dsp_pipeline_float_t * pipeline, goertzel_sample_float_t * goertzel);
+
+void dspPipelineProcess_Float(dsp_pipeline_float_t * pipeline, float * data, size_t size);
+void dspPipelineProcessInt16_Float(dsp_pipeline_float_t * pipeline, const int16_t * arrayInput, size_t size);
+
+
+/******************************************************************************
+ *                  SPSC RING BUFFER FUNCTIONS
+ ******************************************************************************/
+uint_fast8_t dspRingInit_Int16(dsp_ring_t * ring, int16_t * buffer, size_t capacity);
+uint_fast8_t dspRingInit_Int32(dsp_ring_t * ring, int32_t * buffer, size_t capacity);
+uint_fast8_t dspRingInit_Float(dsp_ring_t * ring, float * buffer, size_t capacity);
+
+size_t dspRingAvailable(const dsp_ring_t * ring);
+size_t dspRingSpace(const dsp_ring_t * ring);
+
+/* producer */
+uint_fast8_t dspRingPushSample_Int16(dsp_ring_t * ring, int16_t sample);
+uint_fast8_t dspRingPushSample_Int32(dsp_ring_t * ring, int32_t sample);
+uint_fast8_t dspRingPushSample_Float(dsp_ring_t * ring, float sample);
+size_t dspRingPush_Int16(dsp_ring_t * ring, const int16_t * arrayInput, size_t size);
+size_t dspRingPush_Int32(dsp_ring_t * ring, const int32_t * arrayInput, size_t size);
+size_t dspRingPush_Float(dsp_ring_t * ring, const float * arrayInput, size_t size);
+size_t dspRingWriteSpan_Int16(dsp_ring_t * ring, int16_t ** span);
+size_t dspRingWriteSpan_Int32(dsp_ring_t * ring, int32_t ** span);
+size_t dspRingWriteSpan_Float(dsp_ring_t * ring, float ** span);
+void dspRingWriteCommit(dsp_ring_t * ring, size_t count);
+
+/* consumer */
+size_t dspRingPop_Int16(dsp_ring_t * ring, int16_t * arrayOutput, size_t size);
+size_t dspRingPop_Int32(dsp_ring_t * ring, int32_t * arrayOutput, size_t size);
+size_t dspRingPop_Float(dsp_ring_t * ring, float * arrayOutput, size_t size);
+size_t dspRingReadSpan_Int16(dsp_ring_t * ring, const int16_t ** span);
+size_t dspRingReadSpan_Int32(dsp_ring_t * ring, const int32_t ** span);
+size_t dspRingReadSpan_Float(dsp_ring_t * ring, const float ** span);
+void dspRingReadRelease(dsp_ring_t * ring, size_t count);
+
 
 #ifdef __cplusplus
 }
 #endif
 
+/* inline build - definitions of the per-sample functions */
+#if defined(DSP_MATH_INLINE)
+#include    "DSP_and_Math_inline.h"
+#endif
+
 #endif /* DSP_AND_MATH_H_ */
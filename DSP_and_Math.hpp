@@ -0,0 +1,458 @@
+/******************************************************************************
+ *  DSP_and_Math - Library with useful DSP and math functions - .hpp file
+ *  - C++17 header-only templates layered on "DSP_and_Math.h"
+ *  - shift, clamping and coefficient conversion resolved at compile time
+ *  - all member functions inline (no per-sample call through pointers)
+ *
+ *  author: Haroldo Amaral - agaelema@gmail.com
+ *  v0.5 - 2026/10/16
+ ******************************************************************************
+ *  log:
+ *    v0.5      + add SinglePoleLowPass, SinglePoleLowPassFast, HighPass and
+ *                Goertzel class templates
+ ******************************************************************************/
+
+#ifndef _DSP_AND_MATH_HPP_
+#define _DSP_AND_MATH_HPP_
+
+#include    "DSP_and_Math.h"
+
+#include    <cmath>
+#include    <cstddef>
+#include    <cstdint>
+#include    <type_traits>
+
+#if __cplusplus < 201703L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#error      "DSP_and_Math.hpp requires C++17"
+#endif
+
+
+namespace dsp
+{
+
+/******************************************************************************
+ *                  INTERNAL - compile time helpers
+ ******************************************************************************/
+namespace detail
+{
+    /* same limits used by the "_Init()" functions of the C version */
+    constexpr unsigned clampShift(unsigned shift, unsigned low, unsigned high)
+    {
+        return (shift > high) ? high : ((shift < low) ? low : shift);
+    }
+
+    /* float samples use float math, integer samples use 32 bit accumulator */
+    template <typename SampleT>
+    using DefaultAcc = std::conditional_t<std::is_floating_point_v<SampleT>, SampleT, int32_t>;
+
+    /* sin/cos evaluated by the compiler - Taylor series after range reduction to [-pi, pi] */
+    constexpr double pi_d = 3.14159265358979323846;
+
+    constexpr double reduceAngle(double x)
+    {
+        double turns = x / (2 * pi_d);
+        long long n = static_cast<long long>(turns + ((turns >= 0) ? 0.5 : -0.5));
+        return x - (static_cast<double>(n) * 2 * pi_d);
+    }
+
+    constexpr double sinConst(double x)
+    {
+        double r = reduceAngle(x);
+        double term = r;
+        double sum = r;
+        for (int k = 1; k < 30; k++)
+        {
+            term *= -(r * r) / static_cast<double>((2 * k) * (2 * k + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr double cosConst(double x)
+    {
+        double r = reduceAngle(x);
+        double term = 1.0;
+        double sum = 1.0;
+        for (int k = 1; k < 30; k++)
+        {
+            term *= -(r * r) / static_cast<double>((2 * k - 1) * (2 * k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr unsigned log2Ceil(std::size_t n)
+    {
+        unsigned bits = 0;
+        while ((static_cast<std::size_t>(1) << bits) < n)
+        {
+            bits++;
+        }
+        return bits;
+    }
+
+    constexpr long long roundConst(double x)
+    {
+        return static_cast<long long>(x + ((x >= 0) ? 0.5 : -0.5));
+    }
+
+    /* bits of the Goertzel recursion gain - |s| <= sum|x| * min(N, 1/|sin(w)|) */
+    constexpr unsigned goertzelGainBits(std::size_t n, double w)
+    {
+        double s = sinConst(w);
+        double gain = (s < 0) ? -s : s;
+        gain = (gain * static_cast<double>(n) > 1.0) ? (1.0 / gain) : static_cast<double>(n);
+        return log2Ceil(static_cast<std::size_t>(gain) + 1);
+    }
+} // namespace detail
+
+
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass
+ *  - SampleT float: same math of "iir_SinglePoleLowPass_Float()"
+ *  - AccT int32_t (default for integer samples): same math of
+ *    "iir_SinglePoleLowPass_Fixed()" - shift clamped from 8 to 12
+ *  - AccT int64_t: same math of "iir_SinglePoleLowPass_FixedExtended()" -
+ *    shift clamped from 8 to 28
+ *
+ *  - usage:    dsp::SinglePoleLowPass<int32_t, 10> lp(0.01f);
+ *              y = lp(x);
+ ******************************************************************************/
+template <typename SampleT, unsigned Shift = 10, typename AccT = detail::DefaultAcc<SampleT>>
+class SinglePoleLowPass
+{
+public:
+    static constexpr bool isFloat = std::is_floating_point_v<AccT>;
+    static constexpr unsigned shift = isFloat ? 0u :
+        detail::clampShift(Shift, 8, (sizeof(AccT) > 4) ? 28 : 12);
+
+    /* coefficient in fixed notation (or float) - folded when cutoff is a constant */
+    static constexpr AccT coefficient(float cutoffFreq)
+    {
+        if constexpr (isFloat)
+        {
+            return static_cast<AccT>(cutoffFreq);
+        }
+        else if constexpr (sizeof(AccT) > 4)
+        {
+            return static_cast<AccT>(static_cast<double>(cutoffFreq) * static_cast<double>(AccT(1) << shift));
+        }
+        else
+        {
+            return static_cast<AccT>(cutoffFreq * static_cast<float>(AccT(1) << shift));
+        }
+    }
+
+    constexpr explicit SinglePoleLowPass(float cutoffFreq) : A_param(coefficient(cutoffFreq)) {}
+
+    /* change the cutoff frequency - keep the state if doClean is false */
+    void setCutoff(float cutoffFreq, bool doClean = false)
+    {
+        A_param = coefficient(cutoffFreq);
+        if (doClean)
+        {
+            reset();
+        }
+    }
+
+    void reset()
+    {
+        state = 0;
+        y = 0;
+    }
+
+    /* filter one sample - return the filtered value (also in "output()") */
+    SampleT operator()(SampleT xValue)
+    {
+        if constexpr (isFloat)
+        {
+            /* y = b0*input + a1*y1 */
+            state = (A_param * static_cast<AccT>(xValue)) + ((AccT(1) - A_param) * state);
+            y = static_cast<SampleT>(state);
+        }
+        else
+        {
+            /* y = y1 + cutoffFreq * (input - y1) - RoundNumber added before the shift */
+            constexpr AccT roundNumber = AccT(1) << shift;
+            state = state + ((A_param * ((static_cast<AccT>(xValue) * (AccT(1) << shift)) - state + roundNumber)) >> shift);
+            y = static_cast<SampleT>(state >> shift);
+        }
+        return y;
+    }
+
+    /* filter an array - arrayIn and arrayOut can be the same array (in-place) */
+    void process(const SampleT * arrayIn, SampleT * arrayOut, std::size_t size)
+    {
+        for (std::size_t counter = 0; counter < size; counter++)
+        {
+            arrayOut[counter] = (*this)(arrayIn[counter]);
+        }
+    }
+
+    SampleT output() const { return y; }
+
+private:
+    AccT A_param;
+    AccT state = 0;             // shifted last filtered sample (fixed) or last output (float)
+    SampleT y = 0;
+};
+
+
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fast Version (leaky integrator)
+ *  - same math of "iir_SinglePoleLowPass_Fixed_Fast()" with attenuation
+ *    as a template parameter (constant shifts)
+ ******************************************************************************/
+template <typename SampleT, unsigned Attenuation>
+class SinglePoleLowPassFast
+{
+    static_assert(std::is_integral_v<SampleT>, "SinglePoleLowPassFast - integer samples only");
+    static_assert((Attenuation > 0) && (Attenuation < 31), "SinglePoleLowPassFast - attenuation from 1 to 30");
+
+public:
+    void reset()
+    {
+        filter_acc = 0;
+        y = 0;
+    }
+
+    SampleT operator()(SampleT xValue)
+    {
+        /* filt = filt - (filt >> attenuationFactor) + input */
+        filter_acc = filter_acc - (filter_acc >> Attenuation) + static_cast<int32_t>(xValue);
+        y = static_cast<SampleT>(filter_acc >> Attenuation);
+        return y;
+    }
+
+    void process(const SampleT * arrayIn, SampleT * arrayOut, std::size_t size)
+    {
+        for (std::size_t counter = 0; counter < size; counter++)
+        {
+            arrayOut[counter] = (*this)(arrayIn[counter]);
+        }
+    }
+
+    SampleT output() const { return y; }
+
+private:
+    int32_t filter_acc = 0;
+    SampleT y = 0;
+};
+
+
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass (DC blocker)
+ *  - SampleT float: same math of "iir_SinglePoleHighPass_Float()"
+ *  - AccT int32_t (default for integer samples): same math of
+ *    "iir_SinglePoleHighPass_Fixed()" - shift clamped from 8 to 15
+ *  - AccT int64_t: same math of "iir_SinglePoleHighPass_FixedExtended()" -
+ *    shift clamped from 8 to 30
+ *
+ *  - usage:    dsp::HighPass<int32_t, 12> hp(0.005f);
+ *              y = hp(x);
+ ******************************************************************************/
+template <typename SampleT, unsigned Shift = 12, typename AccT = detail::DefaultAcc<SampleT>>
+class HighPass
+{
+public:
+    static constexpr bool isFloat = std::is_floating_point_v<AccT>;
+    static constexpr unsigned shift = isFloat ? 0u :
+        detail::clampShift(Shift, 8, (sizeof(AccT) > 4) ? 30 : 15);
+
+    /* pole in fixed notation (or float) - folded when cutoff is a constant */
+    static constexpr AccT coefficient(float cutoffFreq)
+    {
+        if constexpr (isFloat)
+        {
+            return static_cast<AccT>(1.0f - cutoffFreq);
+        }
+        else if constexpr (sizeof(AccT) > 4)
+        {
+            return static_cast<AccT>(static_cast<int32_t>(static_cast<double>(AccT(1) << shift) * static_cast<double>(cutoffFreq)));
+        }
+        else
+        {
+            return static_cast<AccT>(static_cast<float>(AccT(1) << shift) * cutoffFreq);
+        }
+    }
+
+    constexpr explicit HighPass(float cutoffFreq) : A_param(coefficient(cutoffFreq)) {}
+
+    /* change the cutoff frequency - keep the state if doClean is false */
+    void setCutoff(float cutoffFreq, bool doClean = false)
+    {
+        A_param = coefficient(cutoffFreq);
+        if (doClean)
+        {
+            reset();
+        }
+    }
+
+    void reset()
+    {
+        acc = 0;
+        prev_x = 0;
+        prev_y = 0;
+    }
+
+    /* filter one sample - return the filtered value (also in "output()") */
+    SampleT operator()(SampleT xValue)
+    {
+        if constexpr (isFloat)
+        {
+            /* y = x - xm1 + (pole * ym1) */
+            AccT x = static_cast<AccT>(xValue);
+            prev_y = x - prev_x + (A_param * prev_y);
+            prev_x = x;
+        }
+        else
+        {
+            acc -= prev_x;
+            prev_x = static_cast<AccT>(xValue) * (AccT(1) << shift);
+            acc += prev_x;
+            acc -= (A_param * prev_y);
+            prev_y = acc >> shift;
+        }
+        return static_cast<SampleT>(prev_y);
+    }
+
+    /* filter an array - arrayIn and arrayOut can be the same array (in-place) */
+    void process(const SampleT * arrayIn, SampleT * arrayOut, std::size_t size)
+    {
+        for (std::size_t counter = 0; counter < size; counter++)
+        {
+            arrayOut[counter] = (*this)(arrayIn[counter]);
+        }
+    }
+
+    SampleT output() const { return static_cast<SampleT>(prev_y); }
+
+private:
+    AccT A_param;
+    AccT acc = 0;
+    AccT prev_x = 0;
+    AccT prev_y = 0;
+};
+
+
+
+
+/******************************************************************************
+ *  Goertzel DFT - one bin of a block with N samples
+ *  - Shift == 0: float math (same of "goertzelSample*_Float()")
+ *  - Shift > 0: 64 bit fixed math (same recursion of "goertzelSampleAddInt16_Fixed64()")
+ *  - coefficients calculated (and rounded) by the compiler, N and Bin are constants
+ *  - fixed version checks at compile time that the recursion fits in 64 bits
+ *    for full scale int16 samples
+ *
+ *  - usage:    dsp::Goertzel<256, 1, 14> g;
+ *              g.process(samples);         // N samples
+ *              amplitude = g.result();
+ ******************************************************************************/
+template <std::size_t N, unsigned Bin, unsigned Shift = 0, typename SampleT = int16_t>
+class Goertzel
+{
+    static_assert(N > 0, "Goertzel - N must be bigger than zero");
+    static_assert((Shift == 0) || (std::is_integral_v<SampleT> && (sizeof(SampleT) <= 2)),
+                  "Goertzel - fixed version (Shift > 0) accepts int16_t/int8_t samples");
+
+public:
+    static constexpr bool isFloat = (Shift == 0);
+    using StateT = std::conditional_t<isFloat, float, int64_t>;
+
+    /* same float rounding of the C "_Init()" functions */
+    static constexpr float w = (2 * static_cast<float>(detail::pi_d) * Bin) / N;
+    static constexpr float cr_float = static_cast<float>(detail::cosConst(w));
+    static constexpr float ci_float = static_cast<float>(detail::sinConst(w));
+    static constexpr StateT cr = isFloat ? StateT(cr_float) : static_cast<StateT>(detail::roundConst(detail::cosConst(w) * (1LL << Shift)));
+    static constexpr StateT ci = isFloat ? StateT(ci_float) : static_cast<StateT>(detail::roundConst(detail::sinConst(w) * (1LL << Shift)));
+    static constexpr StateT coeff = isFloat ? StateT(2 * cr_float) : (2 * cr);
+
+    /* 16 bit samples * N * recursion gain * 2^Shift, multiplied by coeff (2^(Shift + 1)) */
+    static_assert(isFloat || (((2 * Shift) + 16 + detail::log2Ceil(N) + detail::goertzelGainBits(N, w)) <= 63),
+                  "Goertzel - Shift too big for N and Bin (64 bit overflow)");
+
+    void reset()
+    {
+        sprev = 0;
+        sprev2 = 0;
+        counter = 0;
+    }
+
+    /* add one sample - ignored after N samples (call "calc()") */
+    void add(SampleT sample)
+    {
+        if (counter < N)
+        {
+            StateT s;
+            if constexpr (isFloat)
+            {
+                s = static_cast<StateT>(sample) + (coeff * sprev) - sprev2;
+            }
+            else
+            {
+                s = (static_cast<StateT>(sample) * (StateT(1) << Shift)) + ((coeff * sprev) >> Shift) - sprev2;
+            }
+            sprev2 = sprev;
+            sprev = s;
+            counter++;
+        }
+    }
+
+    /* finalize the math - real, imag and amplitude (2 * |X| / N) - restart the recursion */
+    void calc()
+    {
+        float real_temp;
+        float imag_temp;
+
+        if constexpr (isFloat)
+        {
+            real_temp = sprev - (sprev2 * cr);
+            imag_temp = sprev2 * ci;
+        }
+        else
+        {
+            constexpr float scale = 1.0f / static_cast<float>(1LL << Shift);
+            real_temp = static_cast<float>(sprev - ((sprev2 * cr) >> Shift)) * scale;
+            imag_temp = static_cast<float>((sprev2 * ci) >> Shift) * scale;
+        }
+
+        real_value = real_temp;
+        imag_value = imag_temp;
+        result_value = std::sqrt((real_temp * real_temp) + (imag_temp * imag_temp)) * (2.0f / N);
+        reset();
+    }
+
+    /* process a block with N samples and finalize */
+    void process(const SampleT * arrayInput)
+    {
+        reset();
+        for (std::size_t i = 0; i < N; i++)
+        {
+            add(arrayInput[i]);
+        }
+        calc();
+    }
+
+    float real() const { return real_value; }
+    float imag() const { return imag_value; }
+    float result() const { return result_value; }
+
+private:
+    StateT sprev = 0;
+    StateT sprev2 = 0;
+    std::size_t counter = 0;
+    float real_value = 0;
+    float imag_value = 0;
+    float result_value = 0;
+};
+
+} // namespace dsp
+
+#endif /* _DSP_AND_MATH_HPP_ */
@@ -0,0 +1,716 @@
+/******************************************************************************
+ *  DSP_and_Math - Library with useful DSP and math functions - inline kernels
+ *  - per-sample functions (filters, rms and Goertzel "add sample")
+ *  - normal build: compiled once inside "DSP_and_Math.c" (extern functions)
+ *  - inline build: define "DSP_MATH_INLINE" (compiler flags or before including
+ *    "DSP_and_Math.h") and these functions become "static inline" in every
+ *    file that includes "DSP_and_Math.h" - no call overhead, the caller loop
+ *    can be optimized/vectorized by the compiler
+ *  - do not include this file directly
+ *
+ *  author: Haroldo Amaral - agaelema@gmail.com
+ *  v0.5 - 2026/10/16
+ ******************************************************************************/
+
+#ifndef _DSP_AND_MATH_INLINE_H_
+#define _DSP_AND_MATH_INLINE_H_
+
+#include    "DSP_and_Math.h"
+
+#if !defined(DSP_MATH_INLINE) && !defined(_DSP_AND_MATH_C_)
+#error      "DSP_and_Math_inline.h - include DSP_and_Math.h (define DSP_MATH_INLINE for the inline build)"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/******************************************************************************
+ *  Add sample to accumulator - Allow to calculate RMS value sample by sample
+ *  - square input values and accumulate
+ *  - Finalizing calculations in a separate function
+ *
+ *  - INPUT:    rms_float_t * inputStruct       (pointer to struct with RMS parameters)
+ *              const float * sampleFloat       (pointer to float sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void rmsValueAddSample_Float(rms_float_t * inputStruct, float sample)
+{
+    /* square value and accumulate */
+    inputStruct->acc += (sample * sample);
+    /* increment counter - used in final step */
+    inputStruct->size_counter++;
+}
+
+
+/******************************************************************************
+ *  Add sample to accumulator - Allow to calculate RMS value sample by sample
+ *  - square input values and accumulate
+ *  - Finalizing calculations in a separate function
+ *
+ *  - INPUT:    rms_int16_t * inputStruct       (pointer to struct with RMS parameters)
+ *              const float * sampleFloat       (pointer to float sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void rmsValueAddSample_Int16(rms_int16_t * inputStruct, int16_t sample)
+{
+    int32_t sample_temp;
+    sample_temp = (int32_t)sample;                 // save the sample
+
+    /* square value and accumulate */
+    inputStruct->acc = inputStruct->acc + (uint32_t)(sample_temp * sample_temp);             // square and accumulate
+    /* increment counter - used in final step */
+    inputStruct->size_counter++;
+}
+
+
+/******************************************************************************
+ *  RMS sliding window - Float Version - Add sample
+ *  - add the square of new sample and subtract the square of the oldest one
+ *
+ *  - INPUT:    rms_sliding_float_t * inputStruct   (pointer to struct with RMS parameters)
+ *              float sample                        (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void rmsSlidingAddSample_Float(rms_sliding_float_t * inputStruct, float sample)
+{
+    uint_fast16_t index = inputStruct->index;
+    float oldest = inputStruct->buffer[index];
+    float square = sample * sample;
+
+    inputStruct->acc += square - (oldest * oldest);
+    inputStruct->acc_window += square;
+    inputStruct->buffer[index] = sample;
+
+    if (inputStruct->size_counter < inputStruct->size)
+    {
+        inputStruct->size_counter++;
+    }
+
+    if (++index >= inputStruct->size)
+    {
+        /* window complete - replace the running sum by the exact sum */
+        index = 0;
+        inputStruct->acc = inputStruct->acc_window;
+        inputStruct->acc_window = 0;
+    }
+    inputStruct->index = index;
+}
+
+
+/******************************************************************************
+ *  RMS sliding window - Int16 Version - Add sample
+ *  - add the square of new sample and subtract the square of the oldest one
+ *
+ *  - INPUT:    rms_sliding_int16_t * inputStruct   (pointer to struct with RMS parameters)
+ *              int16_t sample                      (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void rmsSlidingAddSample_Int16(rms_sliding_int16_t * inputStruct, int16_t sample)
+{
+    uint_fast16_t index = inputStruct->index;
+    int32_t oldest = (int32_t)inputStruct->buffer[index];
+    int32_t sample_temp = (int32_t)sample;
+
+    inputStruct->acc += (uint32_t)(sample_temp * sample_temp);
+    inputStruct->acc -= (uint32_t)(oldest * oldest);
+    inputStruct->buffer[index] = sample;
+
+    if (inputStruct->size_counter < inputStruct->size)
+    {
+        inputStruct->size_counter++;
+    }
+
+    if (++index >= inputStruct->size)
+    {
+        index = 0;
+    }
+    inputStruct->index = index;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Float Version - Initialization
+ *
+ * - INPUT:     iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Float_Init(iirHighPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean)
+{
+    structInput->cutoff_Freq = (1.0f - cutoffFreq);
+
+    if (doClean)
+    {
+        structInput->prev_x = 0;
+        structInput->prev_y = 0;
+        structInput->y = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Float Version
+ *  - use float math
+ *  - more efficient with FPU
+ *
+ * - INPUT:     iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
+ *              float xValueFloat                   (input/sample value)
+ *
+ * - RETURN:    N/A (result returned inside the struct)
+ *
+ * Reference: https://www.dsprelated.com/freebooks/filters/DC_Blocker.html
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Float(iirHighPassFloat_t * structInput, float xValueFloat)
+{
+    /********************************
+     * y = x - xm1 + (0.995 * ym1);
+     * xm1 = x;
+     * ym1 = y;
+     ********************************/
+    structInput->y = xValueFloat - structInput->prev_x + (structInput->cutoff_Freq * structInput->prev_y);
+    structInput->prev_x = xValueFloat;
+    structInput->prev_y = structInput->y;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Fixed Version Initialization
+ *
+ *  - INPUT:    iirHighPassFixed_t * structInput    (pointer to struct with filter parameters)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t shift                  (shift of fixed math - from 8 to 15)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Fixed_Init(iirHighPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+{
+    uint_fast8_t shift_temp = shift;
+
+    /*
+     * prevent shift bigger than 15 (filter stop to work)
+     */
+    if (shift_temp > 15)
+    {
+        structInput->shift_size = 15;
+    }
+    else if(shift_temp < 8)
+    {
+        structInput->shift_size = 8;
+    }
+    else
+    {
+        structInput->shift_size = shift_temp;
+    }
+
+    structInput->cutoff_Freq = cutoffFreq;
+    structInput->A_param = (int32_t)((1u << structInput->shift_size) * (structInput->cutoff_Freq));
+
+    if (doClean)
+    {
+        structInput->acc = 0;
+        structInput->prev_x = 0;
+        structInput->y = 0;
+        structInput->prev_y = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Fixed Version
+ *  - use fixed integer math with internal variables of 32 bit
+ *  - faster than float version without FPU
+ *
+ *  - INPUT:    iirHighPassFixed_t * inputStuct (pointer to struct with filter parameters)
+ *              int32_t xValue                  (input/sample value)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ *
+ ******************************************************************************
+ * - LIMITS:    SHIFTS      INPUT VALUE (Approximate value, influenced by cutoff value)
+ *                15          +/- 61.7k
+ *                14          +/-123.4k
+ *                13          +/-246.9k
+ *                12          +/-493.8k
+ *                11          +/-987.5k
+ *                10          +/-1.975M
+ *                 9          +/-3.950M
+ *                 8          +/-7.900M
+ *
+ * Reference: https://dspguru.com/dsp/tricks/fixed-point-dc-blocking-filter-with-noise-shaping/
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_Fixed(iirHighPassFixed_t * inputStuct, int32_t xValue)
+{
+    inputStuct->acc -= inputStuct->prev_x;
+    inputStuct->prev_x = (xValue << inputStuct->shift_size);
+    inputStuct->acc += inputStuct->prev_x;
+    inputStuct->acc -= (inputStuct->A_param * inputStuct->prev_y);
+    inputStuct->prev_y = inputStuct->acc >> inputStuct->shift_size;
+    inputStuct->y = inputStuct->prev_y;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Fixed Extended Version Initialization
+ *
+ *  - INPUT:    iirHighPassFixedExtended_t * structInput    (pointer to struct with filter parameters)
+ *              double cutoffFreq                           (pole value)
+ *              uint_fast8_t shift                          (shift of fixed math - from 8 to 15)
+ *              uint_fast8_t doClean                        (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_FixedExtended_Init(iirHighPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+{
+    uint_fast8_t shift_temp = shift;
+
+    /*
+     * prevent shift bigger than 30 (filter stop to work)
+     */
+    if (shift_temp > 30)
+    {
+        structInput->shift_size = 30;
+    }
+    else if(shift_temp < 8)
+    {
+        structInput->shift_size = 8;
+    }
+    else
+    {
+        structInput->shift_size = shift_temp;
+    }
+
+    structInput->cutoff_Freq = cutoffFreq;
+    structInput->A_param = (int32_t)( (1L << structInput->shift_size) * (structInput->cutoff_Freq) );
+    if (doClean)
+    {
+        structInput->acc = 0;
+        structInput->prev_x = 0;
+        structInput->y = 0;
+        structInput->prev_y = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Fixed Extended Version
+ *  - use fixed integer math with internal variables of 64 bit
+ *  - more headroom
+ *
+ *  - INPUT:    iirHighPassFixedExtended_t * inputStuct (pointer to struct with filter parameters)
+ *              int32_t xValue                          (input/sample value)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ *
+ ******************************************************************************
+ * - LIMITS:    SHIFTS      INPUT VALUE (Approximate value, influenced by cutoff)
+ *                30          +/- 61.7k
+ *                29          +/-123.4k
+ *                28          +/-246.9k
+ *                27          +/-493.8k
+ *                26          +/-987.5k
+ *                25          +/-1.975M
+ *                24          +/-3.950M
+ *                23          +/-7.900M
+ *
+ * Reference: https://dspguru.com/dsp/tricks/fixed-point-dc-blocking-filter-with-noise-shaping/
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleHighPass_FixedExtended(iirHighPassFixedExtended_t * inputStuct, int32_t xValue)
+{
+    inputStuct->acc -= inputStuct->prev_x;
+    inputStuct->prev_x = ((int64_t)xValue << inputStuct->shift_size);
+    inputStuct->acc += inputStuct->prev_x;
+    inputStuct->acc -= (inputStuct->A_param * (int64_t)inputStuct->prev_y);
+    inputStuct->prev_y = (int32_t)(inputStuct->acc >> inputStuct->shift_size);
+    inputStuct->y = inputStuct->prev_y;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Float Version - Initialization
+ *
+ *  - INPUT:    iirLowPassFloat_t * structInput     (pointer to struct with filter parameters)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Float_Init(iirLowPassFloat_t * structInput, float cutoffFreq, uint_fast8_t doClean)
+{
+    structInput->cutoff_Freq = cutoffFreq;
+
+    /***************************************
+     * b0 = (1.0f - x)      input coeff
+     * a1 = x               output coeff
+     ***************************************/
+    structInput->b0 = (structInput->cutoff_Freq);
+    structInput->a1 = (1.0f - structInput->cutoff_Freq);
+
+    if (doClean)
+    {
+        structInput->prev_y = 0;
+        structInput->y = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Float Version
+ *  - use float math (more efficient with FPU)
+ *
+ *  - INPUT:    iirLowPassFloat_t * structInput     (pointer to struct with filter parameters)
+ *              float xValueFloat                   (input/sample value)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ *
+ *  Reference: http://www.dspguide.com/ch19.htm
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Float(iirLowPassFloat_t * inputStruct, float xValueFloat)
+{
+    /***************************************
+     * b = input coefficients
+     * a = output coefficients
+     *
+     * y = b0*input + a1*y1
+     * y1 = y
+     ***************************************/
+    inputStruct->y = (inputStruct->b0 * xValueFloat) + (inputStruct->a1 * inputStruct->prev_y);
+    inputStruct->prev_y = inputStruct->y;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Version - Initialization
+ *
+ *  - INPUT:    iirLowPassFixed_t * structInput     (pointer to struct with filter parameters)
+ *              float cutoffFreq                    (pole value)
+ *              uint_fast8_t shift                  (shift of fixed math - from 8 to 15)
+ *              uint_fast8_t doClean                (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed_Init(iirLowPassFixed_t * structInput, float cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+{
+    uint_fast8_t shift_temp = shift;
+
+    /**********************************************************
+     * prevent shift bigger than 12 (filter stop to work)
+     **********************************************************/
+    if (shift_temp > 12)
+    {
+        structInput->shift_size = 12;
+    }
+    else if(shift_temp < 8)
+    {
+        structInput->shift_size = 8;
+    }
+    else
+    {
+        structInput->shift_size = shift_temp;
+    }
+
+    structInput->RoundNumber = (1l << structInput->shift_size);
+
+    structInput->cutoff_Freq = cutoffFreq;
+    structInput->A_param = (int32_t)(structInput->cutoff_Freq * (1l << structInput->shift_size));
+
+    if (doClean)
+        {
+            structInput->SHIFTED_filtered = 0;
+            structInput->SHIFTED_last_filtered = 0;
+            structInput->y = 0;
+        }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Version
+ *
+ *  - INPUT:    iirLowPassFixed_t * structInput     (pointer to struct with filter parameters)
+ *              int32_t xValue                      (input/sample value)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ *
+ ******************************************************************************
+ * - LIMITS:    SHIFTS      INPUT VALUE (Approximate value, influenced by cuttof)
+ *                12          +/- 30k
+ *                11          +/- 120k
+ *                10          +/- 480k
+ *                09          +/- 1.920M
+ *                08          +/- 7.680M
+ *
+ *  Reference: https://learn.openenergymonitor.org/electricity-monitoring/ctac/digital-filters-for-offset-removal
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed(iirLowPassFixed_t * inputStruct, int32_t xValue)
+{
+    /***************************************
+     * y = y1 + cutoffFreq * (input - y1)
+     * y1 = y
+     ***************************************/
+
+    /* RoundNumber math adding 0.5 before return the number */
+    inputStruct->SHIFTED_filtered = inputStruct->SHIFTED_last_filtered + (inputStruct->A_param * ((xValue << inputStruct->shift_size) - inputStruct->SHIFTED_filtered + inputStruct->RoundNumber) >> inputStruct->shift_size);
+    inputStruct->SHIFTED_last_filtered = inputStruct->SHIFTED_filtered;
+    inputStruct->y = inputStruct->SHIFTED_filtered >> inputStruct->shift_size;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Extended Version - Initialization
+ *
+ *  - INPUT:    iirLowPassFixedExtended_t * structInput (pointer to struct with filter parameters)
+ *              double cutoffFreq                       (pole value)
+ *              uint_fast8_t shift                      (shift of fixed math - from 8 to 15)
+ *              uint_fast8_t doClean                    (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_FixedExtended_Init(iirLowPassFixedExtended_t * structInput, double cutoffFreq, uint_fast8_t shift, uint_fast8_t doClean)
+{
+    uint_fast8_t shift_temp = shift;
+
+    /*
+     * prevent shift bigger than 28 (filter stop to work)
+     */
+    if (shift_temp > 28)
+    {
+        structInput->shift_size = 28;
+    }
+    else if(shift_temp < 8)
+    {
+        structInput->shift_size = 8;
+    }
+    else
+    {
+        structInput->shift_size = shift_temp;
+    }
+
+    structInput->RoundNumber = (int64_t)(1LL << structInput->shift_size);
+
+    structInput->cutoff_Freq = cutoffFreq;
+    structInput->A_param = (int64_t)(structInput->cutoff_Freq * (1LL << structInput->shift_size));
+
+    if (doClean)
+        {
+            structInput->SHIFTED_filtered = 0;
+            structInput->SHIFTED_last_filtered = 0;
+            structInput->y = 0;
+        }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Extended Version
+ *
+ *  - INPUT:    iirLowPassFixed_t * structInput     (pointer to struct with filter parameters)
+ *              int32_t xValue                      (input/sample value)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ *
+ *  Reference: https://learn.openenergymonitor.org/electricity-monitoring/ctac/digital-filters-for-offset-removal
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_FixedExtended(iirLowPassFixedExtended_t * inputStruct, int32_t xValue)
+{
+    /***************************************
+     * y = y1 + cutoffFreq * (input - y1)
+     * y1 = y
+     ***************************************/
+
+    /* RoundNumber math adding 0.5 before return the number */
+    inputStruct->SHIFTED_filtered = inputStruct->SHIFTED_last_filtered + (inputStruct->A_param * (((int64_t)xValue << inputStruct->shift_size) - inputStruct->SHIFTED_filtered + inputStruct->RoundNumber) >> inputStruct->shift_size);
+    inputStruct->SHIFTED_last_filtered = inputStruct->SHIFTED_filtered;
+    inputStruct->y = (int32_t)(inputStruct->SHIFTED_filtered >> inputStruct->shift_size);
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed FAST Version - Initialization
+ *
+ *  - INPUT:    iirLowPassFixedExtended_t * structInput (pointer to struct with filter parameters)
+ *              int_fast8_t attenuation                 (attenuation factor - see reference)
+ *              uint_fast8_t doClean                    (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed_Fast_Init(iirLowPassFixedFast_t * structInput, int_fast8_t attenuation, int_fast8_t doClean)
+{
+    structInput->attenuation = attenuation;
+
+    if (doClean)
+    {
+        structInput->filter_acc = 0;
+        structInput->y = 0;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed FAST Version - Initialization
+ *  - leaky integrator - very efficient
+ *
+ *  - INPUT:    iirLowPassFixedExtended_t * structInput (pointer to struct with filter parameters)
+ *              int_fast8_t attenuation                 (attenuation factor - see reference)
+ *              uint_fast8_t doClean                    (clean variables after change the pole)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ *
+ *  Reference: http://www.edn.com/design/systems-design/4320010/A-simple-software-lowpass-filter-suits-embedded-system-applications
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_SinglePoleLowPass_Fixed_Fast(iirLowPassFixedFast_t * inputStruct, int32_t xValue)
+{
+    /*******************************************************
+     * filt = filt - (filt >> attenuationFactor) + input
+     * y = filt >> attenuationFactor
+     *******************************************************/
+    inputStruct->filter_acc = inputStruct->filter_acc - (inputStruct->filter_acc >> inputStruct->attenuation) + xValue;
+    inputStruct->y = (inputStruct->filter_acc >> inputStruct->attenuation);
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Float - Sample by Sample
+ *
+ *  - INPUT:    iirBiquadFloat_t * inputStruct  (pointer to struct with filter parameters)
+ *              float xValueFloat               (new sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct - y)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_Biquad_Float(iirBiquadFloat_t * inputStruct, float xValueFloat)
+{
+    const float * coeffs = inputStruct->coeffs;
+    float * state = inputStruct->state;
+    float x = xValueFloat;
+    float y;
+    uint_fast8_t stage;
+
+    for (stage = 0; stage < inputStruct->stages; stage++)
+    {
+        y = (coeffs[0] * x) + state[0];
+        state[0] = (coeffs[1] * x) - (coeffs[3] * y) + state[1];
+        state[1] = (coeffs[2] * x) - (coeffs[4] * y);
+
+        x = y;                  // output of this section is the input of the next one
+        coeffs += 5;
+        state += 2;
+    }
+
+    inputStruct->y = x;
+}
+
+
+/******************************************************************************
+ *  Biquad Cascade - Fixed (Q31) - Sample by Sample
+ *
+ *  - INPUT:    iirBiquadFixed_t * inputStruct  (pointer to struct with filter parameters)
+ *              int32_t xValue                  (new sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct - y)
+ ******************************************************************************/
+DSP_MATH_KERNEL void iir_Biquad_Fixed(iirBiquadFixed_t * inputStruct, int32_t xValue)
+{
+    const int32_t * coeffs = inputStruct->coeffs;
+    int64_t * state = inputStruct->state;
+    uint_fast8_t shift = 31 - inputStruct->postShift;
+    int64_t roundNumber = (int64_t)1 << (shift - 1);
+    int32_t x = xValue;
+    int32_t y;
+    uint_fast8_t stage;
+
+    for (stage = 0; stage < inputStruct->stages; stage++)
+    {
+        y = (int32_t)((((int64_t)coeffs[0] * x) + state[0] + roundNumber) >> shift);
+        state[0] = ((int64_t)coeffs[1] * x) - ((int64_t)coeffs[3] * y) + state[1];
+        state[1] = ((int64_t)coeffs[2] * x) - ((int64_t)coeffs[4] * y);
+
+        x = y;                  // output of this section is the input of the next one
+        coeffs += 5;
+        state += 2;
+    }
+
+    inputStruct->y = x;
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Sample-by-sample Version - Add sample (FLOAT)
+ *  - Pre calculate each sample
+ *
+ *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
+ *              float sample                            (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void goertzelSampleAddFloat_Float(goertzel_sample_float_t * inputStruct, float sample)
+{
+    if (inputStruct->counter < inputStruct->size_array)
+    {
+        float s_float = sample + (inputStruct->coeff_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
+        inputStruct->sprev_float2 = inputStruct->sprev_float;
+        inputStruct->sprev_float = s_float;
+
+        inputStruct->counter++;
+        inputStruct->s_float = s_float;
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Math Sample-by-sample Version - Add sample (INT16)
+ *  - Pre calculate each sample
+ *
+ *  - INPUT:    goertzel_sample_float_t * inputStruct   (pointer to struct with parameters)
+ *              int16_t sample                          (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void goertzelSampleAddInt16_Float(goertzel_sample_float_t * inputStruct, int16_t sample)
+{
+    if (inputStruct->counter < inputStruct->size_array)
+    {
+        float s_float = (float)sample + (inputStruct->coeff_float * inputStruct->sprev_float) - inputStruct->sprev_float2;
+        inputStruct->sprev_float2 = inputStruct->sprev_float;
+        inputStruct->sprev_float = s_float;
+
+        inputStruct->counter++;
+        inputStruct->s_float = s_float;
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Fixed 64 Math Sample-by-sample Version - Add sample (INT16)
+ *  - Pre calculate each sample using fixed math
+ *
+ *  - INPUT:    goertzel_sample_fixed64_t * inputStruct (pointer to struct with parameters)
+ *              int16_t sample                          (input sample)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+DSP_MATH_KERNEL void goertzelSampleAddInt16_Fixed64(goertzel_sample_fixed64_t * inputStruct, int16_t sample)
+{
+    if (inputStruct->counter < inputStruct->size_array)
+    {
+        int_fast16_t shift = inputStruct->shift;
+
+        int64_t s_fix = ((int64_t)sample << shift) + ((inputStruct->coeff_fix * inputStruct->sprev_fix) >> shift) - inputStruct->sprev_fix2;
+        inputStruct->sprev_fix2 = inputStruct->sprev_fix;
+        inputStruct->sprev_fix = s_fix;
+        inputStruct->s_fix = s_fix;
+    }
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DSP_AND_MATH_INLINE_H_ */
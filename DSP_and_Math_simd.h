@@ -0,0 +1,1935 @@
+/******************************************************************************
+ *  DSP_and_Math - Library with useful DSP and math functions - SIMD kernels
+ *  - array/block functions with SSE2, SSE4.1 (+SSE3), AVX2 and AVX-512 paths
+ *  - included by "DSP_and_Math.c" once per instruction set (runtime dispatch)
+ *    or once with the instruction set enabled in the compiler
+ *  - before each include define:
+ *      DSP_SIMD_LEVEL          (DSP_SIMD_SCALAR ... DSP_SIMD_AVX512)
+ *      DSP_SIMD_NAME(name)     (add a suffix to the name of each function)
+ *  - all levels give the same output (same operations in the same order)
+ *  - do not include this file directly
+ *
+ *  author: Haroldo Amaral - agaelema@gmail.com
+ *  v0.5 - 2026/10/16
+ ******************************************************************************/
+
+#if !defined(_DSP_AND_MATH_C_) || !defined(DSP_SIMD_LEVEL) || !defined(DSP_SIMD_NAME)
+#error      "DSP_and_Math_simd.h - internal file, included only by DSP_and_Math.c"
+#endif
+
+/* no fused multiply-add contraction (AVX-512 and -march=native enable FMA) - same output in all levels */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+
+/******************************************************************************
+ *  Sum of squares of N samples of a int16_t array - 64 bit accumulation
+ *  - multiply-add (pmaddwd) in 8/16/32 lanes (SSE2/AVX2/AVX-512BW)
+ ******************************************************************************/
+static uint64_t DSP_SIMD_NAME(rmsSumSquaresArray_Int16)(const int16_t * arrayIn, size_t size, int16_t dcLevel)
+{
+    uint64_t acc_square = 0;        // sum(x^2)
+    int64_t acc_sample = 0;         // sum(x) - only with dc level
+    size_t counter = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    {
+        __m512i sq_64 = _mm512_setzero_si512();
+        __m512i sum_64 = _mm512_setzero_si512();
+        __m512i ones = _mm512_set1_epi16(1);
+        __m512i zero = _mm512_setzero_si512();
+
+        while (counter + 32 <= size)
+        {
+            /* int32 partial sum of samples is safe for 16384 iterations */
+            size_t block_end = counter + (32 * 16384);
+            __m512i sum_32 = _mm512_setzero_si512();
+            if (block_end > size)
+            {
+                block_end = size;
+            }
+
+            for (; counter + 32 <= block_end; counter += 32)
+            {
+                __m512i x = _mm512_loadu_si512((const void *)&arrayIn[counter]);
+                __m512i sq = _mm512_madd_epi16(x, x);               // x0^2 + x1^2 <= 2^31 (unsigned)
+                sq_64 = _mm512_add_epi64(sq_64, _mm512_unpacklo_epi32(sq, zero));
+                sq_64 = _mm512_add_epi64(sq_64, _mm512_unpackhi_epi32(sq, zero));
+                if (dcLevel)
+                {
+                    sum_32 = _mm512_add_epi32(sum_32, _mm512_madd_epi16(x, ones));
+                }
+            }
+            if (dcLevel)
+            {
+                __m512i sign = _mm512_srai_epi32(sum_32, 31);
+                sum_64 = _mm512_add_epi64(sum_64, _mm512_unpacklo_epi32(sum_32, sign));
+                sum_64 = _mm512_add_epi64(sum_64, _mm512_unpackhi_epi32(sum_32, sign));
+            }
+        }
+
+        acc_square = (uint64_t)_mm512_reduce_add_epi64(sq_64);
+        acc_sample = (int64_t)_mm512_reduce_add_epi64(sum_64);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    {
+        __m256i sq_64 = _mm256_setzero_si256();
+        __m256i sum_64 = _mm256_setzero_si256();
+        __m256i ones = _mm256_set1_epi16(1);
+        __m256i zero = _mm256_setzero_si256();
+
+        while (counter + 16 <= size)
+        {
+            /* int32 partial sum of samples is safe for 16384 iterations */
+            size_t block_end = counter + (16 * 16384);
+            __m256i sum_32 = _mm256_setzero_si256();
+            if (block_end > size)
+            {
+                block_end = size;
+            }
+
+            for (; counter + 16 <= block_end; counter += 16)
+            {
+                __m256i x = _mm256_loadu_si256((const __m256i *)&arrayIn[counter]);
+                __m256i sq = _mm256_madd_epi16(x, x);               // x0^2 + x1^2 <= 2^31 (unsigned)
+                sq_64 = _mm256_add_epi64(sq_64, _mm256_unpacklo_epi32(sq, zero));
+                sq_64 = _mm256_add_epi64(sq_64, _mm256_unpackhi_epi32(sq, zero));
+                if (dcLevel)
+                {
+                    sum_32 = _mm256_add_epi32(sum_32, _mm256_madd_epi16(x, ones));
+                }
+            }
+            if (dcLevel)
+            {
+                __m256i sign = _mm256_srai_epi32(sum_32, 31);
+                sum_64 = _mm256_add_epi64(sum_64, _mm256_unpacklo_epi32(sum_32, sign));
+                sum_64 = _mm256_add_epi64(sum_64, _mm256_unpackhi_epi32(sum_32, sign));
+            }
+        }
+
+        uint64_t lanes[4];
+        _mm256_storeu_si256((__m256i *)lanes, sq_64);
+        acc_square += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm256_storeu_si256((__m256i *)lanes, sum_64);
+        acc_sample += (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+#elif (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    {
+        __m128i sq_64 = _mm_setzero_si128();
+        __m128i sum_64 = _mm_setzero_si128();
+        __m128i ones = _mm_set1_epi16(1);
+        __m128i zero = _mm_setzero_si128();
+
+        while (counter + 8 <= size)
+        {
+            /* int32 partial sum of samples is safe for 16384 iterations */
+            size_t block_end = counter + (8 * 16384);
+            __m128i sum_32 = _mm_setzero_si128();
+            if (block_end > size)
+            {
+                block_end = size;
+            }
+
+            for (; counter + 8 <= block_end; counter += 8)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)&arrayIn[counter]);
+                __m128i sq = _mm_madd_epi16(x, x);                  // x0^2 + x1^2 <= 2^31 (unsigned)
+                sq_64 = _mm_add_epi64(sq_64, _mm_unpacklo_epi32(sq, zero));
+                sq_64 = _mm_add_epi64(sq_64, _mm_unpackhi_epi32(sq, zero));
+                if (dcLevel)
+                {
+                    sum_32 = _mm_add_epi32(sum_32, _mm_madd_epi16(x, ones));
+                }
+            }
+            if (dcLevel)
+            {
+                __m128i sign = _mm_srai_epi32(sum_32, 31);
+                sum_64 = _mm_add_epi64(sum_64, _mm_unpacklo_epi32(sum_32, sign));
+                sum_64 = _mm_add_epi64(sum_64, _mm_unpackhi_epi32(sum_32, sign));
+            }
+        }
+
+        uint64_t lanes[2];
+        _mm_storeu_si128((__m128i *)lanes, sq_64);
+        acc_square += lanes[0] + lanes[1];
+        _mm_storeu_si128((__m128i *)lanes, sum_64);
+        acc_sample += (int64_t)(lanes[0] + lanes[1]);
+    }
+#endif
+
+    /* remaining samples (or all samples without SIMD) */
+    for (; counter < size; counter++)
+    {
+        int32_t sample_temp = (int32_t)arrayIn[counter];
+        acc_square += (uint32_t)(sample_temp * sample_temp);
+        acc_sample += sample_temp;
+    }
+
+    /* remove dc level - modular math, exact while the result fits in 64 bits */
+    if (dcLevel)
+    {
+        acc_square = acc_square - (uint64_t)(2 * (int64_t)dcLevel * acc_sample)
+                     + ((uint64_t)size * (uint64_t)((int32_t)dcLevel * dcLevel));
+    }
+    return acc_square;
+}
+
+
+/******************************************************************************
+ *  Power metering - sums of one block
+ *  - SSE2/AVX2 multiply-add (AVX-512 level uses the AVX2 loop)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(powerMeterSums_Int16)(const int16_t * arrayV, const int16_t * arrayI, const int16_t * arrayVI,
+                                 size_t size, struct power_sums_ * sums)
+{
+    size_t counter = 0;
+
+    sums->vv = 0;
+    sums->ii = 0;
+    sums->vi = 0;
+    sums->v = 0;
+    sums->i = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    {
+        __m256i vv_64 = _mm256_setzero_si256();
+        __m256i ii_64 = _mm256_setzero_si256();
+        __m256i vi_64 = _mm256_setzero_si256();
+        __m256i v_64 = _mm256_setzero_si256();
+        __m256i i_64 = _mm256_setzero_si256();
+        __m256i ones = _mm256_set1_epi16(1);
+        __m256i zero = _mm256_setzero_si256();
+        __m256i int32_min = _mm256_set1_epi32(INT32_MIN);
+
+        while (counter + 16 <= size)
+        {
+            /* int32 partial sum of samples is safe for 16384 iterations */
+            size_t block_end = counter + (16 * 16384);
+            __m256i v_32 = _mm256_setzero_si256();
+            __m256i i_32 = _mm256_setzero_si256();
+            if (block_end > size)
+            {
+                block_end = size;
+            }
+
+            for (; counter + 16 <= block_end; counter += 16)
+            {
+                __m256i v, i, vv, ii, vi, sign;
+                if (arrayVI)
+                {
+                    /* de-interleave: v in low 16 bits, i in high 16 bits of each 32 bits */
+                    __m256i a = _mm256_loadu_si256((const __m256i *)&arrayVI[2 * counter]);
+                    __m256i b = _mm256_loadu_si256((const __m256i *)&arrayVI[2 * counter + 16]);
+                    v = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16), _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16));
+                    i = _mm256_packs_epi32(_mm256_srai_epi32(a, 16), _mm256_srai_epi32(b, 16));
+                }
+                else
+                {
+                    v = _mm256_loadu_si256((const __m256i *)&arrayV[counter]);
+                    i = _mm256_loadu_si256((const __m256i *)&arrayI[counter]);
+                }
+
+                vv = _mm256_madd_epi16(v, v);                       // <= 2^31 (unsigned)
+                ii = _mm256_madd_epi16(i, i);
+                vi = _mm256_madd_epi16(v, i);                       // signed, +2^31 wraps to INT32_MIN
+                sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(vi, int32_min), _mm256_srai_epi32(vi, 31));
+
+                vv_64 = _mm256_add_epi64(vv_64, _mm256_add_epi64(_mm256_unpacklo_epi32(vv, zero), _mm256_unpackhi_epi32(vv, zero)));
+                ii_64 = _mm256_add_epi64(ii_64, _mm256_add_epi64(_mm256_unpacklo_epi32(ii, zero), _mm256_unpackhi_epi32(ii, zero)));
+                vi_64 = _mm256_add_epi64(vi_64, _mm256_add_epi64(_mm256_unpacklo_epi32(vi, sign), _mm256_unpackhi_epi32(vi, sign)));
+                v_32 = _mm256_add_epi32(v_32, _mm256_madd_epi16(v, ones));
+                i_32 = _mm256_add_epi32(i_32, _mm256_madd_epi16(i, ones));
+            }
+            {
+                __m256i sign_v = _mm256_srai_epi32(v_32, 31);
+                __m256i sign_i = _mm256_srai_epi32(i_32, 31);
+                v_64 = _mm256_add_epi64(v_64, _mm256_add_epi64(_mm256_unpacklo_epi32(v_32, sign_v), _mm256_unpackhi_epi32(v_32, sign_v)));
+                i_64 = _mm256_add_epi64(i_64, _mm256_add_epi64(_mm256_unpacklo_epi32(i_32, sign_i), _mm256_unpackhi_epi32(i_32, sign_i)));
+            }
+        }
+
+        uint64_t lanes[4];
+        _mm256_storeu_si256((__m256i *)lanes, vv_64);
+        sums->vv = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm256_storeu_si256((__m256i *)lanes, ii_64);
+        sums->ii = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm256_storeu_si256((__m256i *)lanes, vi_64);
+        sums->vi = (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        _mm256_storeu_si256((__m256i *)lanes, v_64);
+        sums->v = (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        _mm256_storeu_si256((__m256i *)lanes, i_64);
+        sums->i = (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+#elif (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    {
+        __m128i vv_64 = _mm_setzero_si128();
+        __m128i ii_64 = _mm_setzero_si128();
+        __m128i vi_64 = _mm_setzero_si128();
+        __m128i v_64 = _mm_setzero_si128();
+        __m128i i_64 = _mm_setzero_si128();
+        __m128i ones = _mm_set1_epi16(1);
+        __m128i zero = _mm_setzero_si128();
+        __m128i int32_min = _mm_set1_epi32(INT32_MIN);
+
+        while (counter + 8 <= size)
+        {
+            /* int32 partial sum of samples is safe for 16384 iterations */
+            size_t block_end = counter + (8 * 16384);
+            __m128i v_32 = _mm_setzero_si128();
+            __m128i i_32 = _mm_setzero_si128();
+            if (block_end > size)
+            {
+                block_end = size;
+            }
+
+            for (; counter + 8 <= block_end; counter += 8)
+            {
+                __m128i v, i, vv, ii, vi, sign;
+                if (arrayVI)
+                {
+                    /* de-interleave: v in low 16 bits, i in high 16 bits of each 32 bits */
+                    __m128i a = _mm_loadu_si128((const __m128i *)&arrayVI[2 * counter]);
+                    __m128i b = _mm_loadu_si128((const __m128i *)&arrayVI[2 * counter + 8]);
+                    v = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+                    i = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+                }
+                else
+                {
+                    v = _mm_loadu_si128((const __m128i *)&arrayV[counter]);
+                    i = _mm_loadu_si128((const __m128i *)&arrayI[counter]);
+                }
+
+                vv = _mm_madd_epi16(v, v);                          // <= 2^31 (unsigned)
+                ii = _mm_madd_epi16(i, i);
+                vi = _mm_madd_epi16(v, i);                          // signed, +2^31 wraps to INT32_MIN
+                sign = _mm_andnot_si128(_mm_cmpeq_epi32(vi, int32_min), _mm_srai_epi32(vi, 31));
+
+                vv_64 = _mm_add_epi64(vv_64, _mm_add_epi64(_mm_unpacklo_epi32(vv, zero), _mm_unpackhi_epi32(vv, zero)));
+                ii_64 = _mm_add_epi64(ii_64, _mm_add_epi64(_mm_unpacklo_epi32(ii, zero), _mm_unpackhi_epi32(ii, zero)));
+                vi_64 = _mm_add_epi64(vi_64, _mm_add_epi64(_mm_unpacklo_epi32(vi, sign), _mm_unpackhi_epi32(vi, sign)));
+                v_32 = _mm_add_epi32(v_32, _mm_madd_epi16(v, ones));
+                i_32 = _mm_add_epi32(i_32, _mm_madd_epi16(i, ones));
+            }
+            {
+                __m128i sign_v = _mm_srai_epi32(v_32, 31);
+                __m128i sign_i = _mm_srai_epi32(i_32, 31);
+                v_64 = _mm_add_epi64(v_64, _mm_add_epi64(_mm_unpacklo_epi32(v_32, sign_v), _mm_unpackhi_epi32(v_32, sign_v)));
+                i_64 = _mm_add_epi64(i_64, _mm_add_epi64(_mm_unpacklo_epi32(i_32, sign_i), _mm_unpackhi_epi32(i_32, sign_i)));
+            }
+        }
+
+        uint64_t lanes[2];
+        _mm_storeu_si128((__m128i *)lanes, vv_64);
+        sums->vv = lanes[0] + lanes[1];
+        _mm_storeu_si128((__m128i *)lanes, ii_64);
+        sums->ii = lanes[0] + lanes[1];
+        _mm_storeu_si128((__m128i *)lanes, vi_64);
+        sums->vi = (int64_t)(lanes[0] + lanes[1]);
+        _mm_storeu_si128((__m128i *)lanes, v_64);
+        sums->v = (int64_t)(lanes[0] + lanes[1]);
+        _mm_storeu_si128((__m128i *)lanes, i_64);
+        sums->i = (int64_t)(lanes[0] + lanes[1]);
+    }
+#endif
+
+    /* remaining samples (or all samples without SIMD) */
+    for (; counter < size; counter++)
+    {
+        int32_t v = arrayVI ? arrayVI[2 * counter] : arrayV[counter];
+        int32_t i = arrayVI ? arrayVI[2 * counter + 1] : arrayI[counter];
+        sums->vv += (uint32_t)(v * v);
+        sums->ii += (uint32_t)(i * i);
+        sums->vi += (int64_t)v * i;
+        sums->v += v;
+        sums->i += i;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Float Bank - Block of frames
+ *  - SSE (4 lanes), AVX (8 lanes) or AVX-512 (16 lanes) across channels
+ ******************************************************************************/
+static void DSP_SIMD_NAME(iir_SinglePoleLowPass_Float_Bank_Block)(iirLowPassFloatBank_t * bankInput, const float * arrayIn, float * arrayOut, size_t frames)
+{
+    size_t channels = bankInput->channels;
+    size_t channel = 0;
+    size_t frame;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; channel + 16 <= channels; channel += 16)
+    {
+        __m512 b0 = _mm512_loadu_ps(&bankInput->b0[channel]);
+        __m512 a1 = _mm512_loadu_ps(&bankInput->a1[channel]);
+        __m512 y = _mm512_loadu_ps(&bankInput->prev_y[channel]);
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            __m512 x = _mm512_loadu_ps(&arrayIn[frame * channels + channel]);
+            y = _mm512_add_ps(_mm512_mul_ps(b0, x), _mm512_mul_ps(a1, y));
+            _mm512_storeu_ps(&arrayOut[frame * channels + channel], y);
+        }
+        _mm512_storeu_ps(&bankInput->prev_y[channel], y);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; channel + 8 <= channels; channel += 8)
+    {
+        __m256 b0 = _mm256_loadu_ps(&bankInput->b0[channel]);
+        __m256 a1 = _mm256_loadu_ps(&bankInput->a1[channel]);
+        __m256 y = _mm256_loadu_ps(&bankInput->prev_y[channel]);
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            __m256 x = _mm256_loadu_ps(&arrayIn[frame * channels + channel]);
+            y = _mm256_add_ps(_mm256_mul_ps(b0, x), _mm256_mul_ps(a1, y));
+            _mm256_storeu_ps(&arrayOut[frame * channels + channel], y);
+        }
+        _mm256_storeu_ps(&bankInput->prev_y[channel], y);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    for (; channel + 4 <= channels; channel += 4)
+    {
+        __m128 b0 = _mm_loadu_ps(&bankInput->b0[channel]);
+        __m128 a1 = _mm_loadu_ps(&bankInput->a1[channel]);
+        __m128 y = _mm_loadu_ps(&bankInput->prev_y[channel]);
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            __m128 x = _mm_loadu_ps(&arrayIn[frame * channels + channel]);
+            y = _mm_add_ps(_mm_mul_ps(b0, x), _mm_mul_ps(a1, y));
+            _mm_storeu_ps(&arrayOut[frame * channels + channel], y);
+        }
+        _mm_storeu_ps(&bankInput->prev_y[channel], y);
+    }
+#endif
+    /* remaining channels (or all channels without SIMD) */
+    for (; channel < channels; channel++)
+    {
+        float b0 = bankInput->b0[channel];
+        float a1 = bankInput->a1[channel];
+        float y = bankInput->prev_y[channel];
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            y = (b0 * arrayIn[frame * channels + channel]) + (a1 * y);
+            arrayOut[frame * channels + channel] = y;
+        }
+        bankInput->prev_y[channel] = y;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR First Order Scan - y[n] = b0 * x[n] + b1 * x[n-1] + a1 * y[n-1] - Float
+ *  - 16 samples solved together (lookahead), each output a sum of the 16
+ *    inputs, the input before the block and the output before the block
+ *    (lower triangular matrix of coefficients) - 4 partial sums (j % 4)
+ *    per lane, only the carry (last output of each block) is serial
+ *  - AVX-512 (16 lanes), AVX (2 x 8 lanes), SSE (4 x 4 lanes) or scalar -
+ *    the same sums in the same order, last "size % 16" samples serial
+ *  - powers: matrix columns (15 zeros, c0 ... c15, 0), b1 * a1^k and
+ *    a1^(k+1) (see "iir_FirstOrderScan_Float()")
+ ******************************************************************************/
+static float DSP_SIMD_NAME(iir_FirstOrderScan_Float)(const float * powers, const float * arrayIn, float * arrayOut, size_t size,
+                                                     float x_prev, float y)
+{
+    size_t counter = 0;
+    size_t j;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    {
+        __m512 x_pow = _mm512_loadu_ps(&powers[32]);
+        __m512 carry_pow = _mm512_loadu_ps(&powers[48]);
+        __m512 carry = _mm512_set1_ps(y);
+        __m512i last = _mm512_set1_epi32(15);
+
+        for (; counter + 16 <= size; counter += 16)
+        {
+            const float * x = &arrayIn[counter];
+            __m512 s0 = _mm512_mul_ps(_mm512_set1_ps(x[0]), _mm512_loadu_ps(&powers[15]));
+            __m512 s1 = _mm512_mul_ps(_mm512_set1_ps(x[1]), _mm512_loadu_ps(&powers[14]));
+            __m512 s2 = _mm512_mul_ps(_mm512_set1_ps(x[2]), _mm512_loadu_ps(&powers[13]));
+            __m512 s3 = _mm512_mul_ps(_mm512_set1_ps(x[3]), _mm512_loadu_ps(&powers[12]));
+            __m512 z;
+            for (j = 4; j < 16; j += 4)
+            {
+                s0 = _mm512_add_ps(s0, _mm512_mul_ps(_mm512_set1_ps(x[j]), _mm512_loadu_ps(&powers[15 - j])));
+                s1 = _mm512_add_ps(s1, _mm512_mul_ps(_mm512_set1_ps(x[j + 1]), _mm512_loadu_ps(&powers[14 - j])));
+                s2 = _mm512_add_ps(s2, _mm512_mul_ps(_mm512_set1_ps(x[j + 2]), _mm512_loadu_ps(&powers[13 - j])));
+                s3 = _mm512_add_ps(s3, _mm512_mul_ps(_mm512_set1_ps(x[j + 3]), _mm512_loadu_ps(&powers[12 - j])));
+            }
+            z = _mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3));
+            z = _mm512_add_ps(z, _mm512_mul_ps(x_pow, _mm512_set1_ps(x_prev)));
+            x_prev = x[15];                                     // read before write - allow in-place
+            z = _mm512_add_ps(z, _mm512_mul_ps(carry_pow, carry));
+            _mm512_storeu_ps(&arrayOut[counter], z);
+            carry = _mm512_permutexvar_ps(last, z);            // broadcast y[15]
+        }
+        y = _mm512_cvtss_f32(carry);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    {
+        __m256 x_pow_lo = _mm256_loadu_ps(&powers[32]);
+        __m256 x_pow_hi = _mm256_loadu_ps(&powers[40]);
+        __m256 carry_pow_lo = _mm256_loadu_ps(&powers[48]);
+        __m256 carry_pow_hi = _mm256_loadu_ps(&powers[56]);
+        __m256 carry = _mm256_set1_ps(y);
+        __m256i last = _mm256_set1_epi32(7);
+
+        for (; counter + 16 <= size; counter += 16)
+        {
+            const float * x = &arrayIn[counter];
+            __m256 x0 = _mm256_set1_ps(x[0]);
+            __m256 x1 = _mm256_set1_ps(x[1]);
+            __m256 x2 = _mm256_set1_ps(x[2]);
+            __m256 x3 = _mm256_set1_ps(x[3]);
+            __m256 xp = _mm256_set1_ps(x_prev);
+            __m256 lo0 = _mm256_mul_ps(x0, _mm256_loadu_ps(&powers[15]));
+            __m256 lo1 = _mm256_mul_ps(x1, _mm256_loadu_ps(&powers[14]));
+            __m256 lo2 = _mm256_mul_ps(x2, _mm256_loadu_ps(&powers[13]));
+            __m256 lo3 = _mm256_mul_ps(x3, _mm256_loadu_ps(&powers[12]));
+            __m256 hi0 = _mm256_mul_ps(x0, _mm256_loadu_ps(&powers[23]));
+            __m256 hi1 = _mm256_mul_ps(x1, _mm256_loadu_ps(&powers[22]));
+            __m256 hi2 = _mm256_mul_ps(x2, _mm256_loadu_ps(&powers[21]));
+            __m256 hi3 = _mm256_mul_ps(x3, _mm256_loadu_ps(&powers[20]));
+            __m256 z_lo;
+            __m256 z_hi;
+            /* lanes 0-7: only j <= 7 */
+            lo0 = _mm256_add_ps(lo0, _mm256_mul_ps(_mm256_set1_ps(x[4]), _mm256_loadu_ps(&powers[11])));
+            lo1 = _mm256_add_ps(lo1, _mm256_mul_ps(_mm256_set1_ps(x[5]), _mm256_loadu_ps(&powers[10])));
+            lo2 = _mm256_add_ps(lo2, _mm256_mul_ps(_mm256_set1_ps(x[6]), _mm256_loadu_ps(&powers[9])));
+            lo3 = _mm256_add_ps(lo3, _mm256_mul_ps(_mm256_set1_ps(x[7]), _mm256_loadu_ps(&powers[8])));
+            for (j = 4; j < 16; j += 4)
+            {
+                hi0 = _mm256_add_ps(hi0, _mm256_mul_ps(_mm256_set1_ps(x[j]), _mm256_loadu_ps(&powers[23 - j])));
+                hi1 = _mm256_add_ps(hi1, _mm256_mul_ps(_mm256_set1_ps(x[j + 1]), _mm256_loadu_ps(&powers[22 - j])));
+                hi2 = _mm256_add_ps(hi2, _mm256_mul_ps(_mm256_set1_ps(x[j + 2]), _mm256_loadu_ps(&powers[21 - j])));
+                hi3 = _mm256_add_ps(hi3, _mm256_mul_ps(_mm256_set1_ps(x[j + 3]), _mm256_loadu_ps(&powers[20 - j])));
+            }
+            z_lo = _mm256_add_ps(_mm256_add_ps(lo0, lo1), _mm256_add_ps(lo2, lo3));
+            z_hi = _mm256_add_ps(_mm256_add_ps(hi0, hi1), _mm256_add_ps(hi2, hi3));
+            z_lo = _mm256_add_ps(z_lo, _mm256_mul_ps(x_pow_lo, xp));
+            z_hi = _mm256_add_ps(z_hi, _mm256_mul_ps(x_pow_hi, xp));
+            x_prev = x[15];                                     // read before write - allow in-place
+            z_lo = _mm256_add_ps(z_lo, _mm256_mul_ps(carry_pow_lo, carry));
+            z_hi = _mm256_add_ps(z_hi, _mm256_mul_ps(carry_pow_hi, carry));
+            _mm256_storeu_ps(&arrayOut[counter], z_lo);
+            _mm256_storeu_ps(&arrayOut[counter + 8], z_hi);
+            carry = _mm256_permutevar8x32_ps(z_hi, last);       // broadcast y[15]
+        }
+        y = _mm256_cvtss_f32(carry);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    {
+        __m128 carry = _mm_set1_ps(y);
+
+        for (; counter + 16 <= size; counter += 16)
+        {
+            const float * x = &arrayIn[counter];
+            __m128 xp = _mm_set1_ps(x_prev);
+            __m128 z[4];
+            size_t g;
+
+            for (g = 0; g < 4; g++)                             // lanes 4g to 4g+3: only j <= 4g+3
+            {
+                const float * column = &powers[15 + (4 * g)];
+                __m128 s0 = _mm_setzero_ps();
+                __m128 s1 = _mm_setzero_ps();
+                __m128 s2 = _mm_setzero_ps();
+                __m128 s3 = _mm_setzero_ps();
+                for (j = 0; j <= (4 * g); j += 4)
+                {
+                    s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_set1_ps(x[j]), _mm_loadu_ps(column - j)));
+                    s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_set1_ps(x[j + 1]), _mm_loadu_ps(column - j - 1)));
+                    s2 = _mm_add_ps(s2, _mm_mul_ps(_mm_set1_ps(x[j + 2]), _mm_loadu_ps(column - j - 2)));
+                    s3 = _mm_add_ps(s3, _mm_mul_ps(_mm_set1_ps(x[j + 3]), _mm_loadu_ps(column - j - 3)));
+                }
+                z[g] = _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3));
+                z[g] = _mm_add_ps(z[g], _mm_mul_ps(_mm_loadu_ps(&powers[32 + (4 * g)]), xp));
+            }
+            x_prev = x[15];                                     // read before write - allow in-place
+            for (g = 0; g < 4; g++)
+            {
+                z[g] = _mm_add_ps(z[g], _mm_mul_ps(_mm_loadu_ps(&powers[48 + (4 * g)]), carry));
+                _mm_storeu_ps(&arrayOut[counter + (4 * g)], z[g]);
+            }
+            carry = _mm_shuffle_ps(z[3], z[3], _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        y = _mm_cvtss_f32(carry);
+    }
+#endif
+    /* blocks without SIMD */
+    for (; counter + 16 <= size; counter += 16)
+    {
+        float x[16];
+        float z[16];
+        size_t k;
+
+        for (j = 0; j < 16; j++)
+        {
+            x[j] = arrayIn[counter + j];                        // read before write - allow in-place
+        }
+        for (k = 0; k < 16; k++)
+        {
+            float s[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (j = 0; j <= k; j++)
+            {
+                s[j & 3] = s[j & 3] + (x[j] * powers[15 + k - j]);
+            }
+            z[k] = (s[0] + s[1]) + (s[2] + s[3]);
+            z[k] = z[k] + (powers[32 + k] * x_prev);
+            z[k] = z[k] + (powers[48 + k] * y);
+        }
+        for (k = 0; k < 16; k++)
+        {
+            arrayOut[counter + k] = z[k];
+        }
+        x_prev = x[15];
+        y = z[15];
+    }
+    /* remaining samples - serial recursion */
+    for (; counter < size; counter++)
+    {
+        float x = arrayIn[counter];
+        y = ((powers[15] * x) + (powers[32] * x_prev)) + (powers[48] * y);
+        x_prev = x;
+        arrayOut[counter] = y;
+    }
+    return y;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed Bank - Block of frames
+ *  - SSE4.1 (4 lanes), AVX2 (8 lanes) or AVX-512 (16 lanes) across channels
+ ******************************************************************************/
+static void DSP_SIMD_NAME(iir_SinglePoleLowPass_Fixed_Bank_Block)(iirLowPassFixedBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames)
+{
+    size_t channels = bankInput->channels;
+    uint_fast8_t shift = bankInput->shift_size;
+    int32_t RoundNumber = bankInput->RoundNumber;
+    size_t channel = 0;
+    size_t frame;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    {
+        __m128i shift_count = _mm_cvtsi32_si128((int)shift);
+        __m512i round = _mm512_set1_epi32(RoundNumber);
+
+        for (; channel + 16 <= channels; channel += 16)
+        {
+            __m512i A_param = _mm512_loadu_si512((const void *)&bankInput->A_param[channel]);
+            __m512i filtered = _mm512_loadu_si512((const void *)&bankInput->SHIFTED_last_filtered[channel]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m512i x = _mm512_loadu_si512((const void *)&arrayIn[frame * channels + channel]);
+                __m512i delta = _mm512_add_epi32(_mm512_sub_epi32(_mm512_sll_epi32(x, shift_count), filtered), round);
+                filtered = _mm512_add_epi32(filtered, _mm512_sra_epi32(_mm512_mullo_epi32(A_param, delta), shift_count));
+                _mm512_storeu_si512((void *)&arrayOut[frame * channels + channel], _mm512_sra_epi32(filtered, shift_count));
+            }
+            _mm512_storeu_si512((void *)&bankInput->SHIFTED_last_filtered[channel], filtered);
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    {
+        __m128i shift_count = _mm_cvtsi32_si128((int)shift);
+        __m256i round = _mm256_set1_epi32(RoundNumber);
+
+        for (; channel + 8 <= channels; channel += 8)
+        {
+            __m256i A_param = _mm256_loadu_si256((const __m256i *)&bankInput->A_param[channel]);
+            __m256i filtered = _mm256_loadu_si256((const __m256i *)&bankInput->SHIFTED_last_filtered[channel]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m256i x = _mm256_loadu_si256((const __m256i *)&arrayIn[frame * channels + channel]);
+                __m256i delta = _mm256_add_epi32(_mm256_sub_epi32(_mm256_sll_epi32(x, shift_count), filtered), round);
+                filtered = _mm256_add_epi32(filtered, _mm256_sra_epi32(_mm256_mullo_epi32(A_param, delta), shift_count));
+                _mm256_storeu_si256((__m256i *)&arrayOut[frame * channels + channel], _mm256_sra_epi32(filtered, shift_count));
+            }
+            _mm256_storeu_si256((__m256i *)&bankInput->SHIFTED_last_filtered[channel], filtered);
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE4_1)
+    {
+        __m128i shift_count = _mm_cvtsi32_si128((int)shift);
+        __m128i round = _mm_set1_epi32(RoundNumber);
+
+        for (; channel + 4 <= channels; channel += 4)
+        {
+            __m128i A_param = _mm_loadu_si128((const __m128i *)&bankInput->A_param[channel]);
+            __m128i filtered = _mm_loadu_si128((const __m128i *)&bankInput->SHIFTED_last_filtered[channel]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)&arrayIn[frame * channels + channel]);
+                __m128i delta = _mm_add_epi32(_mm_sub_epi32(_mm_sll_epi32(x, shift_count), filtered), round);
+                filtered = _mm_add_epi32(filtered, _mm_sra_epi32(_mm_mullo_epi32(A_param, delta), shift_count));
+                _mm_storeu_si128((__m128i *)&arrayOut[frame * channels + channel], _mm_sra_epi32(filtered, shift_count));
+            }
+            _mm_storeu_si128((__m128i *)&bankInput->SHIFTED_last_filtered[channel], filtered);
+        }
+    }
+#endif
+    /* remaining channels (or all channels without SIMD) */
+    for (; channel < channels; channel++)
+    {
+        int32_t A_param = bankInput->A_param[channel];
+        int32_t filtered = bankInput->SHIFTED_last_filtered[channel];
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            filtered = filtered + (A_param * ((arrayIn[frame * channels + channel] << shift) - filtered + RoundNumber) >> shift);
+            arrayOut[frame * channels + channel] = filtered >> shift;
+        }
+        bankInput->SHIFTED_last_filtered[channel] = filtered;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Fixed FAST Bank - Block of frames
+ *  - AVX2 (8 lanes) or AVX-512 (16 lanes) variable shift across channels
+ ******************************************************************************/
+static void DSP_SIMD_NAME(iir_SinglePoleLowPass_Fixed_Fast_Bank_Block)(iirLowPassFixedFastBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames)
+{
+    size_t channels = bankInput->channels;
+    size_t channel = 0;
+    size_t frame;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; channel + 16 <= channels; channel += 16)
+    {
+        __m512i attenuation = _mm512_loadu_si512((const void *)&bankInput->attenuation[channel]);
+        __m512i filter_acc = _mm512_loadu_si512((const void *)&bankInput->filter_acc[channel]);
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            __m512i x = _mm512_loadu_si512((const void *)&arrayIn[frame * channels + channel]);
+            filter_acc = _mm512_add_epi32(_mm512_sub_epi32(filter_acc, _mm512_srav_epi32(filter_acc, attenuation)), x);
+            _mm512_storeu_si512((void *)&arrayOut[frame * channels + channel], _mm512_srav_epi32(filter_acc, attenuation));
+        }
+        _mm512_storeu_si512((void *)&bankInput->filter_acc[channel], filter_acc);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; channel + 8 <= channels; channel += 8)
+    {
+        __m256i attenuation = _mm256_loadu_si256((const __m256i *)&bankInput->attenuation[channel]);
+        __m256i filter_acc = _mm256_loadu_si256((const __m256i *)&bankInput->filter_acc[channel]);
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)&arrayIn[frame * channels + channel]);
+            filter_acc = _mm256_add_epi32(_mm256_sub_epi32(filter_acc, _mm256_srav_epi32(filter_acc, attenuation)), x);
+            _mm256_storeu_si256((__m256i *)&arrayOut[frame * channels + channel], _mm256_srav_epi32(filter_acc, attenuation));
+        }
+        _mm256_storeu_si256((__m256i *)&bankInput->filter_acc[channel], filter_acc);
+    }
+#endif
+    /* remaining channels (or all channels without SIMD) */
+    for (; channel < channels; channel++)
+    {
+        int32_t attenuation = bankInput->attenuation[channel];
+        int32_t filter_acc = bankInput->filter_acc[channel];
+
+        for (frame = 0; frame < frames; frame++)
+        {
+            filter_acc = filter_acc - (filter_acc >> attenuation) + arrayIn[frame * channels + channel];
+            arrayOut[frame * channels + channel] = (filter_acc >> attenuation);
+        }
+        bankInput->filter_acc[channel] = filter_acc;
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Biquad - Float Bank - Block of frames
+ *  - SSE (4 lanes), AVX (8 lanes) or AVX-512 (16 lanes) across channels
+ ******************************************************************************/
+static void DSP_SIMD_NAME(iir_Biquad_Float_Bank_Block)(iirBiquadFloatBank_t * bankInput, const float * arrayIn, float * arrayOut, size_t frames)
+{
+    size_t channels = bankInput->channels;
+    size_t stages = bankInput->stages;
+    const float * coeffs = bankInput->coeffs;
+    float * state = bankInput->state;
+    size_t channel = 0;
+    size_t stage;
+    size_t frame;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; channel + 16 <= channels; channel += 16)
+    {
+        const float * source = arrayIn;
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const float * c = &coeffs[(stage * 5) * channels + channel];
+            float * s = &state[(stage * 2) * channels + channel];
+            __m512 b0 = _mm512_loadu_ps(&c[0 * channels]);
+            __m512 b1 = _mm512_loadu_ps(&c[1 * channels]);
+            __m512 b2 = _mm512_loadu_ps(&c[2 * channels]);
+            __m512 a1 = _mm512_loadu_ps(&c[3 * channels]);
+            __m512 a2 = _mm512_loadu_ps(&c[4 * channels]);
+            __m512 s1 = _mm512_loadu_ps(&s[0]);
+            __m512 s2 = _mm512_loadu_ps(&s[channels]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m512 x = _mm512_loadu_ps(&source[frame * channels + channel]);
+                __m512 y = _mm512_add_ps(_mm512_mul_ps(b0, x), s1);
+                s1 = _mm512_add_ps(_mm512_sub_ps(_mm512_mul_ps(b1, x), _mm512_mul_ps(a1, y)), s2);
+                s2 = _mm512_sub_ps(_mm512_mul_ps(b2, x), _mm512_mul_ps(a2, y));
+                _mm512_storeu_ps(&arrayOut[frame * channels + channel], y);
+            }
+            _mm512_storeu_ps(&s[0], s1);
+            _mm512_storeu_ps(&s[channels], s2);
+            source = arrayOut;
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; channel + 8 <= channels; channel += 8)
+    {
+        const float * source = arrayIn;
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const float * c = &coeffs[(stage * 5) * channels + channel];
+            float * s = &state[(stage * 2) * channels + channel];
+            __m256 b0 = _mm256_loadu_ps(&c[0 * channels]);
+            __m256 b1 = _mm256_loadu_ps(&c[1 * channels]);
+            __m256 b2 = _mm256_loadu_ps(&c[2 * channels]);
+            __m256 a1 = _mm256_loadu_ps(&c[3 * channels]);
+            __m256 a2 = _mm256_loadu_ps(&c[4 * channels]);
+            __m256 s1 = _mm256_loadu_ps(&s[0]);
+            __m256 s2 = _mm256_loadu_ps(&s[channels]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m256 x = _mm256_loadu_ps(&source[frame * channels + channel]);
+                __m256 y = _mm256_add_ps(_mm256_mul_ps(b0, x), s1);
+                s1 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(b1, x), _mm256_mul_ps(a1, y)), s2);
+                s2 = _mm256_sub_ps(_mm256_mul_ps(b2, x), _mm256_mul_ps(a2, y));
+                _mm256_storeu_ps(&arrayOut[frame * channels + channel], y);
+            }
+            _mm256_storeu_ps(&s[0], s1);
+            _mm256_storeu_ps(&s[channels], s2);
+            source = arrayOut;
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    for (; channel + 4 <= channels; channel += 4)
+    {
+        const float * source = arrayIn;
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const float * c = &coeffs[(stage * 5) * channels + channel];
+            float * s = &state[(stage * 2) * channels + channel];
+            __m128 b0 = _mm_loadu_ps(&c[0 * channels]);
+            __m128 b1 = _mm_loadu_ps(&c[1 * channels]);
+            __m128 b2 = _mm_loadu_ps(&c[2 * channels]);
+            __m128 a1 = _mm_loadu_ps(&c[3 * channels]);
+            __m128 a2 = _mm_loadu_ps(&c[4 * channels]);
+            __m128 s1 = _mm_loadu_ps(&s[0]);
+            __m128 s2 = _mm_loadu_ps(&s[channels]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m128 x = _mm_loadu_ps(&source[frame * channels + channel]);
+                __m128 y = _mm_add_ps(_mm_mul_ps(b0, x), s1);
+                s1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, x), _mm_mul_ps(a1, y)), s2);
+                s2 = _mm_sub_ps(_mm_mul_ps(b2, x), _mm_mul_ps(a2, y));
+                _mm_storeu_ps(&arrayOut[frame * channels + channel], y);
+            }
+            _mm_storeu_ps(&s[0], s1);
+            _mm_storeu_ps(&s[channels], s2);
+            source = arrayOut;
+        }
+    }
+#endif
+    /* remaining channels (or all channels without SIMD) */
+    for (; channel < channels; channel++)
+    {
+        const float * source = arrayIn;
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const float * c = &coeffs[(stage * 5) * channels + channel];
+            float * s = &state[(stage * 2) * channels + channel];
+            float b0 = c[0 * channels];
+            float b1 = c[1 * channels];
+            float b2 = c[2 * channels];
+            float a1 = c[3 * channels];
+            float a2 = c[4 * channels];
+            float s1 = s[0];
+            float s2 = s[channels];
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                float x = source[frame * channels + channel];
+                float y = (b0 * x) + s1;
+                s1 = (b1 * x) - (a1 * y) + s2;
+                s2 = (b2 * x) - (a2 * y);
+                arrayOut[frame * channels + channel] = y;
+            }
+            s[0] = s1;
+            s[channels] = s2;
+            source = arrayOut;
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  IIR Biquad - Fixed (Q31) Bank - Block of frames
+ *  - 64 bit states: SSE4.1 (2 lanes), AVX2 (4 lanes) or AVX-512 (8 lanes)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(iir_Biquad_Fixed_Bank_Block)(iirBiquadFixedBank_t * bankInput, const int32_t * arrayIn, int32_t * arrayOut, size_t frames)
+{
+    size_t channels = bankInput->channels;
+    size_t stages = bankInput->stages;
+    const int32_t * coeffs = bankInput->coeffs;
+    int64_t * state = bankInput->state;
+    uint_fast8_t shift = 31 - bankInput->postShift;
+    int64_t roundNumber = (int64_t)1 << (shift - 1);
+    size_t channel = 0;
+    size_t stage;
+    size_t frame;
+
+    /*
+     * SIMD: only the low 32 bits of each 64 bit lane are used as output and as
+     * multiplier input (mul_epi32), so a logical shift gives the same result of
+     * the arithmetic shift used in the scalar version
+     */
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; channel + 8 <= channels; channel += 8)
+    {
+        const int32_t * source = arrayIn;
+        __m128i count = _mm_cvtsi32_si128((int)shift);
+        __m512i rnd = _mm512_set1_epi64(roundNumber);
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const int32_t * c = &coeffs[(stage * 5) * channels + channel];
+            int64_t * s = &state[(stage * 2) * channels + channel];
+            __m512i b0 = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)&c[0 * channels]));
+            __m512i b1 = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)&c[1 * channels]));
+            __m512i b2 = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)&c[2 * channels]));
+            __m512i a1 = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)&c[3 * channels]));
+            __m512i a2 = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)&c[4 * channels]));
+            __m512i s1 = _mm512_loadu_si512((const void *)&s[0]);
+            __m512i s2 = _mm512_loadu_si512((const void *)&s[channels]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m512i x = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)&source[frame * channels + channel]));
+                __m512i y = _mm512_srl_epi64(_mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epi32(b0, x), s1), rnd), count);
+                s1 = _mm512_add_epi64(_mm512_sub_epi64(_mm512_mul_epi32(b1, x), _mm512_mul_epi32(a1, y)), s2);
+                s2 = _mm512_sub_epi64(_mm512_mul_epi32(b2, x), _mm512_mul_epi32(a2, y));
+                _mm256_storeu_si256((__m256i *)&arrayOut[frame * channels + channel], _mm512_cvtepi64_epi32(y));
+            }
+            _mm512_storeu_si512((void *)&s[0], s1);
+            _mm512_storeu_si512((void *)&s[channels], s2);
+            source = arrayOut;
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; channel + 4 <= channels; channel += 4)
+    {
+        const int32_t * source = arrayIn;
+        __m128i count = _mm_cvtsi32_si128((int)shift);
+        __m256i rnd = _mm256_set1_epi64x(roundNumber);
+        __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const int32_t * c = &coeffs[(stage * 5) * channels + channel];
+            int64_t * s = &state[(stage * 2) * channels + channel];
+            __m256i b0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&c[0 * channels]));
+            __m256i b1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&c[1 * channels]));
+            __m256i b2 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&c[2 * channels]));
+            __m256i a1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&c[3 * channels]));
+            __m256i a2 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&c[4 * channels]));
+            __m256i s1 = _mm256_loadu_si256((const __m256i *)&s[0]);
+            __m256i s2 = _mm256_loadu_si256((const __m256i *)&s[channels]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&source[frame * channels + channel]));
+                __m256i y = _mm256_srl_epi64(_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(b0, x), s1), rnd), count);
+                s1 = _mm256_add_epi64(_mm256_sub_epi64(_mm256_mul_epi32(b1, x), _mm256_mul_epi32(a1, y)), s2);
+                s2 = _mm256_sub_epi64(_mm256_mul_epi32(b2, x), _mm256_mul_epi32(a2, y));
+                _mm_storeu_si128((__m128i *)&arrayOut[frame * channels + channel],
+                                 _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(y, pack)));
+            }
+            _mm256_storeu_si256((__m256i *)&s[0], s1);
+            _mm256_storeu_si256((__m256i *)&s[channels], s2);
+            source = arrayOut;
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE4_1)
+    for (; channel + 2 <= channels; channel += 2)
+    {
+        const int32_t * source = arrayIn;
+        __m128i count = _mm_cvtsi32_si128((int)shift);
+        __m128i rnd = _mm_set1_epi64x(roundNumber);
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const int32_t * c = &coeffs[(stage * 5) * channels + channel];
+            int64_t * s = &state[(stage * 2) * channels + channel];
+            __m128i b0 = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&c[0 * channels]));
+            __m128i b1 = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&c[1 * channels]));
+            __m128i b2 = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&c[2 * channels]));
+            __m128i a1 = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&c[3 * channels]));
+            __m128i a2 = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&c[4 * channels]));
+            __m128i s1 = _mm_loadu_si128((const __m128i *)&s[0]);
+            __m128i s2 = _mm_loadu_si128((const __m128i *)&s[channels]);
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                __m128i x = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&source[frame * channels + channel]));
+                __m128i y = _mm_srl_epi64(_mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(b0, x), s1), rnd), count);
+                s1 = _mm_add_epi64(_mm_sub_epi64(_mm_mul_epi32(b1, x), _mm_mul_epi32(a1, y)), s2);
+                s2 = _mm_sub_epi64(_mm_mul_epi32(b2, x), _mm_mul_epi32(a2, y));
+                _mm_storel_epi64((__m128i *)&arrayOut[frame * channels + channel],
+                                 _mm_shuffle_epi32(y, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+            _mm_storeu_si128((__m128i *)&s[0], s1);
+            _mm_storeu_si128((__m128i *)&s[channels], s2);
+            source = arrayOut;
+        }
+    }
+#endif
+    /* remaining channels (or all channels without SIMD) */
+    for (; channel < channels; channel++)
+    {
+        const int32_t * source = arrayIn;
+
+        for (stage = 0; stage < stages; stage++)
+        {
+            const int32_t * c = &coeffs[(stage * 5) * channels + channel];
+            int64_t * s = &state[(stage * 2) * channels + channel];
+            int64_t b0 = c[0 * channels];
+            int64_t b1 = c[1 * channels];
+            int64_t b2 = c[2 * channels];
+            int64_t a1 = c[3 * channels];
+            int64_t a2 = c[4 * channels];
+            int64_t s1 = s[0];
+            int64_t s2 = s[channels];
+
+            for (frame = 0; frame < frames; frame++)
+            {
+                int64_t x = source[frame * channels + channel];
+                int32_t y = (int32_t)(((b0 * x) + s1 + roundNumber) >> shift);
+                s1 = (b1 * x) - (a1 * y) + s2;
+                s2 = (b2 * x) - (a2 * y);
+                arrayOut[frame * channels + channel] = y;
+            }
+            s[0] = s1;
+            s[channels] = s2;
+            source = arrayOut;
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank - Add one sample to all bins
+ *  - SSE (4 bins), AVX (8 bins) or AVX-512 (16 bins) lanes
+ ******************************************************************************/
+static inline void DSP_SIMD_NAME(goertzelBankAddSample_Float)(goertzel_bank_float_t * inputStruct, float sample)
+{
+    const float * coeff = inputStruct->coeff_float;
+    float * sprev = inputStruct->sprev_float;
+    float * sprev2 = inputStruct->sprev_float2;
+    uint_fast16_t bins = inputStruct->bins;
+    uint_fast16_t k = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; k + 16 <= bins; k += 16)
+    {
+        __m512 s1 = _mm512_loadu_ps(&sprev[k]);
+        __m512 s = _mm512_sub_ps(_mm512_add_ps(_mm512_set1_ps(sample), _mm512_mul_ps(_mm512_loadu_ps(&coeff[k]), s1)), _mm512_loadu_ps(&sprev2[k]));
+        _mm512_storeu_ps(&sprev2[k], s1);
+        _mm512_storeu_ps(&sprev[k], s);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    {
+        __m256 x = _mm256_set1_ps(sample);
+        for (; k + 8 <= bins; k += 8)
+        {
+            __m256 s1 = _mm256_loadu_ps(&sprev[k]);
+            __m256 s = _mm256_sub_ps(_mm256_add_ps(x, _mm256_mul_ps(_mm256_loadu_ps(&coeff[k]), s1)), _mm256_loadu_ps(&sprev2[k]));
+            _mm256_storeu_ps(&sprev2[k], s1);
+            _mm256_storeu_ps(&sprev[k], s);
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    {
+        __m128 x = _mm_set1_ps(sample);
+        for (; k + 4 <= bins; k += 4)
+        {
+            __m128 s1 = _mm_loadu_ps(&sprev[k]);
+            __m128 s = _mm_sub_ps(_mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(&coeff[k]), s1)), _mm_loadu_ps(&sprev2[k]));
+            _mm_storeu_ps(&sprev2[k], s1);
+            _mm_storeu_ps(&sprev[k], s);
+        }
+    }
+#endif
+    for (; k < bins; k++)
+    {
+        float s_float = sample + (coeff[k] * sprev[k]) - sprev2[k];
+        sprev2[k] = sprev[k];
+        sprev[k] = s_float;
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank - Do the Math (FLOAT INPUT)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(goertzelBankFloat_Float)(goertzel_bank_float_t * inputStruct, const float * arrayInput)
+{
+    uint_fast16_t size_array = inputStruct->size_array;
+    uint_fast16_t i;
+
+    for (i = 0; i < inputStruct->bins; i++)
+    {
+        inputStruct->sprev_float[i] = 0;
+        inputStruct->sprev_float2[i] = 0;
+    }
+
+    for (i = 0; i < size_array; i++)
+    {
+        DSP_SIMD_NAME(goertzelBankAddSample_Float)(inputStruct, arrayInput[i]);
+    }
+
+    goertzelBankCalc_Float(inputStruct);
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Float Bank - Do the Math (INT16 INPUT)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(goertzelBankInt16_Float)(goertzel_bank_float_t * inputStruct, const int16_t * arrayInput)
+{
+    uint_fast16_t size_array = inputStruct->size_array;
+    uint_fast16_t i;
+
+    for (i = 0; i < inputStruct->bins; i++)
+    {
+        inputStruct->sprev_float[i] = 0;
+        inputStruct->sprev_float2[i] = 0;
+    }
+
+    for (i = 0; i < size_array; i++)
+    {
+        DSP_SIMD_NAME(goertzelBankAddSample_Float)(inputStruct, (float)arrayInput[i]);
+    }
+
+    goertzelBankCalc_Float(inputStruct);
+}
+
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+/******************************************************************************
+ *  DDS (NCO) sine wave generator - 8 samples (Q31) - linear interpolation
+ *  - same math of "ddsGen_Lookup_Q31()": table gather, (t1 - t0)*frac in 64
+ *    bits (even/odd lanes), no saturation needed (result between t0 and t1)
+ ******************************************************************************/
+static inline __m256i DSP_SIMD_NAME(ddsGen_Lookup8_Q31)(__m256i phase)
+{
+    __m256i index = _mm256_srli_epi32(phase, DDS_FRAC_BITS);
+    __m256i frac = _mm256_and_si256(phase, _mm256_set1_epi32((1L << DDS_FRAC_BITS) - 1));
+    __m256i t0 = _mm256_i32gather_epi32((const int *)&ddsSineTable_Q31[0], index, 4);
+    __m256i t1 = _mm256_i32gather_epi32((const int *)&ddsSineTable_Q31[1], index, 4);
+    __m256i delta = _mm256_sub_epi32(t1, t0);                          // |t1 - t0| < 2^26
+    __m256i even = _mm256_mul_epi32(delta, frac);
+    __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(delta, 32), _mm256_srli_epi64(frac, 32));
+
+    /* bits 24..55 of each product - low 32 bits of (product >> 24) */
+    even = _mm256_srli_epi64(even, DDS_FRAC_BITS);
+    odd = _mm256_slli_epi64(odd, 32 - DDS_FRAC_BITS);
+    return _mm256_add_epi32(t0, _mm256_blend_epi32(even, odd, 0xAA));
+}
+
+
+/******************************************************************************
+ *  DDS (NCO) sine wave generator - phase of the next 8 samples
+ ******************************************************************************/
+static inline __m256i DSP_SIMD_NAME(ddsGen_Phase8)(const dds_parameters *inputParameters)
+{
+    return _mm256_add_epi32(_mm256_set1_epi32((int32_t)inputParameters->phase_acc),
+                            _mm256_mullo_epi32(_mm256_set1_epi32((int32_t)inputParameters->phase_inc),
+                                               _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+}
+#endif
+
+
+/******************************************************************************
+ *  DDS (NCO) sine wave generator - array versions
+ *  - AVX2: 8 samples per iteration with linear interpolation (gather)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(ddsGen_Array_Float)(dds_parameters *inputParameters, float * outputArray, size_t size)
+{
+    size_t counter = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    if (inputParameters->interpolation == DDS_INTERP_LINEAR)
+    {
+        __m256i phase = DSP_SIMD_NAME(ddsGen_Phase8)(inputParameters);
+        __m256i step = _mm256_set1_epi32((int32_t)(inputParameters->phase_inc * 8));
+        __m256 scale = _mm256_set1_ps(1.0f / 2147483648.0f);
+        __m256 amplitude = _mm256_set1_ps(inputParameters->amplitude);
+        __m256 offset = _mm256_set1_ps(inputParameters->V_offset);
+
+        for (; counter + 8 <= size; counter += 8)
+        {
+            __m256 sample = _mm256_mul_ps(_mm256_cvtepi32_ps(DSP_SIMD_NAME(ddsGen_Lookup8_Q31)(phase)), scale);
+            _mm256_storeu_ps(&outputArray[counter], _mm256_add_ps(_mm256_mul_ps(amplitude, sample), offset));
+            phase = _mm256_add_epi32(phase, step);
+        }
+        inputParameters->phase_acc += (uint32_t)counter * inputParameters->phase_inc;
+    }
+#endif
+    for (; counter < size; counter++)
+    {
+        outputArray[counter] = ddsGen_GetSample_Float(inputParameters);
+    }
+}
+
+
+static void DSP_SIMD_NAME(ddsGen_Array_Q15)(dds_parameters *inputParameters, int16_t * outputArray, size_t size)
+{
+    size_t counter = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    if (inputParameters->interpolation == DDS_INTERP_LINEAR)
+    {
+        __m256i phase = DSP_SIMD_NAME(ddsGen_Phase8)(inputParameters);
+        __m256i step = _mm256_set1_epi32((int32_t)(inputParameters->phase_inc * 8));
+        __m256i round = _mm256_set1_epi32(1L << 14);
+        __m256i int16_max = _mm256_set1_epi32(INT16_MAX);
+
+        for (; counter + 8 <= size; counter += 8)
+        {
+            __m256i sample = DSP_SIMD_NAME(ddsGen_Lookup8_Q31)(phase);
+            /* round to Q15: ((x >> 1) + 2^14) >> 15 == (x + 2^15) >> 16 without overflow */
+            sample = _mm256_srai_epi32(_mm256_add_epi32(_mm256_srai_epi32(sample, 1), round), 15);
+            sample = _mm256_min_epi32(sample, int16_max);
+            sample = _mm256_permute4x64_epi64(_mm256_packs_epi32(sample, sample), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128((__m128i *)&outputArray[counter], _mm256_castsi256_si128(sample));
+            phase = _mm256_add_epi32(phase, step);
+        }
+        inputParameters->phase_acc += (uint32_t)counter * inputParameters->phase_inc;
+    }
+#endif
+    for (; counter < size; counter++)
+    {
+        outputArray[counter] = ddsGen_GetSample_Q15(inputParameters);
+    }
+}
+
+
+static void DSP_SIMD_NAME(ddsGen_Array_Q31)(dds_parameters *inputParameters, int32_t * outputArray, size_t size)
+{
+    size_t counter = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    if (inputParameters->interpolation == DDS_INTERP_LINEAR)
+    {
+        __m256i phase = DSP_SIMD_NAME(ddsGen_Phase8)(inputParameters);
+        __m256i step = _mm256_set1_epi32((int32_t)(inputParameters->phase_inc * 8));
+
+        for (; counter + 8 <= size; counter += 8)
+        {
+            _mm256_storeu_si256((__m256i *)&outputArray[counter], DSP_SIMD_NAME(ddsGen_Lookup8_Q31)(phase));
+            phase = _mm256_add_epi32(phase, step);
+        }
+        inputParameters->phase_acc += (uint32_t)counter * inputParameters->phase_inc;
+    }
+#endif
+    for (; counter < size; counter++)
+    {
+        outputArray[counter] = ddsGen_GetSample_Q31(inputParameters);
+    }
+}
+
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE4_1)
+/******************************************************************************
+ *  FFT - complex multiply b*w (2/4/8 complex lanes, interleaved re, im)
+ *  - re = br*wr - bi*wi, im = bi*wr + br*wi (same order of the scalar code)
+ ******************************************************************************/
+static inline __m128 DSP_SIMD_NAME(fftCmul_128)(__m128 b, __m128 w)
+{
+    __m128 p1 = _mm_mul_ps(b, _mm_moveldup_ps(w));                                     // br*wr, bi*wr
+    __m128 p2 = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_movehdup_ps(w));  // bi*wi, br*wi
+    return _mm_addsub_ps(p1, p2);
+}
+
+/* multiply by -j: (re, im) -> (im, -re) */
+static inline __m128 DSP_SIMD_NAME(fftMulMinusJ_128)(__m128 p)
+{
+    return _mm_xor_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+}
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+static inline __m256 DSP_SIMD_NAME(fftCmul_256)(__m256 b, __m256 w)
+{
+    __m256 p1 = _mm256_mul_ps(b, _mm256_moveldup_ps(w));
+    __m256 p2 = _mm256_mul_ps(_mm256_permute_ps(b, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_movehdup_ps(w));
+    return _mm256_addsub_ps(p1, p2);
+}
+
+static inline __m256 DSP_SIMD_NAME(fftMulMinusJ_256)(__m256 p)
+{
+    return _mm256_xor_ps(_mm256_permute_ps(p, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+}
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+static inline __m512 DSP_SIMD_NAME(fftCmul_512)(__m512 b, __m512 w)
+{
+    __m512 p1 = _mm512_mul_ps(b, _mm512_moveldup_ps(w));
+    __m512 p2 = _mm512_mul_ps(_mm512_permute_ps(b, _MM_SHUFFLE(2, 3, 0, 1)), _mm512_movehdup_ps(w));
+    return _mm512_mask_sub_ps(_mm512_add_ps(p1, p2), 0x5555, p1, p2);                // addsub
+}
+
+static inline __m512 DSP_SIMD_NAME(fftMulMinusJ_512)(__m512 p)
+{
+    __m512i sign = _mm512_set1_epi64((long long)0x8000000000000000ULL);
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_permute_ps(p, _MM_SHUFFLE(2, 3, 0, 1))), sign));
+}
+#endif
+
+
+/******************************************************************************
+ *  FFT - complex forward transform in place (radix-4 with one radix-2 stage
+ *  when log2(size) is odd)
+ *  - bit reversal by table, then each radix-4 stage merges two radix-2 stages
+ *    (spans 2q and 4q): 4 points, twiddles W_2q^k and W_4q^k
+ *  - SSE3 (2 points), AVX (4 points) or AVX-512 (8 points) along k
+ ******************************************************************************/
+static void DSP_SIMD_NAME(fftComplex_Float)(const fft_plan_float_t * plan, float * data)
+{
+    uint32_t size = plan->size_complex;
+    const uint32_t * bitrev = plan->bitrev;
+    uint32_t i, k, q;
+
+    for (i = 0; i < size; i++)
+    {
+        uint32_t j = bitrev[i];
+        if (i < j)
+        {
+            float re = data[2 * i];
+            float im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+
+    /* odd number of stages - radix-2 stage of span 2 (twiddle = 1) */
+    q = 1;
+    if (plan->log2size & 1)
+    {
+        for (i = 0; i < 2 * size; i += 4)
+        {
+            float ar = data[i];
+            float ai = data[i + 1];
+            data[i] = ar + data[i + 2];
+            data[i + 1] = ai + data[i + 3];
+            data[i + 2] = ar - data[i + 2];
+            data[i + 3] = ai - data[i + 3];
+        }
+        q = 2;
+    }
+
+    for (; 4 * q <= size; q *= 4)
+    {
+        const float * w2 = &plan->twiddle[2 * q - 2];           // W_2q^k - table of span 2q
+        const float * w4 = &plan->twiddle[4 * q - 2];           // W_4q^k - table of span 4q
+
+        for (i = 0; i < size; i += 4 * q)
+        {
+            float * x0 = &data[2 * i];
+            float * x1 = &data[2 * (i + q)];
+            float * x2 = &data[2 * (i + 2 * q)];
+            float * x3 = &data[2 * (i + 3 * q)];
+            k = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+            for (; k + 8 <= q; k += 8)
+            {
+                __m512 wa = _mm512_loadu_ps(&w2[2 * k]);
+                __m512 wb = _mm512_loadu_ps(&w4[2 * k]);
+                __m512 a = _mm512_loadu_ps(&x0[2 * k]);
+                __m512 c = _mm512_loadu_ps(&x2[2 * k]);
+                __m512 tb = DSP_SIMD_NAME(fftCmul_512)(_mm512_loadu_ps(&x1[2 * k]), wa);
+                __m512 td = DSP_SIMD_NAME(fftCmul_512)(_mm512_loadu_ps(&x3[2 * k]), wa);
+                __m512 a1 = _mm512_add_ps(a, tb);
+                __m512 b1 = _mm512_sub_ps(a, tb);
+                __m512 c1 = _mm512_add_ps(c, td);
+                __m512 d1 = _mm512_sub_ps(c, td);
+                __m512 tc = DSP_SIMD_NAME(fftCmul_512)(c1, wb);
+                __m512 te = DSP_SIMD_NAME(fftMulMinusJ_512)(DSP_SIMD_NAME(fftCmul_512)(d1, wb));
+                _mm512_storeu_ps(&x0[2 * k], _mm512_add_ps(a1, tc));
+                _mm512_storeu_ps(&x1[2 * k], _mm512_add_ps(b1, te));
+                _mm512_storeu_ps(&x2[2 * k], _mm512_sub_ps(a1, tc));
+                _mm512_storeu_ps(&x3[2 * k], _mm512_sub_ps(b1, te));
+            }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+            for (; k + 4 <= q; k += 4)
+            {
+                __m256 wa = _mm256_loadu_ps(&w2[2 * k]);
+                __m256 wb = _mm256_loadu_ps(&w4[2 * k]);
+                __m256 a = _mm256_loadu_ps(&x0[2 * k]);
+                __m256 c = _mm256_loadu_ps(&x2[2 * k]);
+                __m256 tb = DSP_SIMD_NAME(fftCmul_256)(_mm256_loadu_ps(&x1[2 * k]), wa);
+                __m256 td = DSP_SIMD_NAME(fftCmul_256)(_mm256_loadu_ps(&x3[2 * k]), wa);
+                __m256 a1 = _mm256_add_ps(a, tb);
+                __m256 b1 = _mm256_sub_ps(a, tb);
+                __m256 c1 = _mm256_add_ps(c, td);
+                __m256 d1 = _mm256_sub_ps(c, td);
+                __m256 tc = DSP_SIMD_NAME(fftCmul_256)(c1, wb);
+                __m256 te = DSP_SIMD_NAME(fftMulMinusJ_256)(DSP_SIMD_NAME(fftCmul_256)(d1, wb));
+                _mm256_storeu_ps(&x0[2 * k], _mm256_add_ps(a1, tc));
+                _mm256_storeu_ps(&x1[2 * k], _mm256_add_ps(b1, te));
+                _mm256_storeu_ps(&x2[2 * k], _mm256_sub_ps(a1, tc));
+                _mm256_storeu_ps(&x3[2 * k], _mm256_sub_ps(b1, te));
+            }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE4_1)
+            for (; k + 2 <= q; k += 2)
+            {
+                __m128 wa = _mm_loadu_ps(&w2[2 * k]);
+                __m128 wb = _mm_loadu_ps(&w4[2 * k]);
+                __m128 a = _mm_loadu_ps(&x0[2 * k]);
+                __m128 c = _mm_loadu_ps(&x2[2 * k]);
+                __m128 tb = DSP_SIMD_NAME(fftCmul_128)(_mm_loadu_ps(&x1[2 * k]), wa);
+                __m128 td = DSP_SIMD_NAME(fftCmul_128)(_mm_loadu_ps(&x3[2 * k]), wa);
+                __m128 a1 = _mm_add_ps(a, tb);
+                __m128 b1 = _mm_sub_ps(a, tb);
+                __m128 c1 = _mm_add_ps(c, td);
+                __m128 d1 = _mm_sub_ps(c, td);
+                __m128 tc = DSP_SIMD_NAME(fftCmul_128)(c1, wb);
+                __m128 te = DSP_SIMD_NAME(fftMulMinusJ_128)(DSP_SIMD_NAME(fftCmul_128)(d1, wb));
+                _mm_storeu_ps(&x0[2 * k], _mm_add_ps(a1, tc));
+                _mm_storeu_ps(&x1[2 * k], _mm_add_ps(b1, te));
+                _mm_storeu_ps(&x2[2 * k], _mm_sub_ps(a1, tc));
+                _mm_storeu_ps(&x3[2 * k], _mm_sub_ps(b1, te));
+            }
+#endif
+            for (; k < q; k++)
+            {
+                float war = w2[2 * k], wai = w2[2 * k + 1];
+                float wbr = w4[2 * k], wbi = w4[2 * k + 1];
+                float ar = x0[2 * k], ai = x0[2 * k + 1];
+                float br = x1[2 * k], bi = x1[2 * k + 1];
+                float cr = x2[2 * k], ci = x2[2 * k + 1];
+                float dr = x3[2 * k], di = x3[2 * k + 1];
+
+                /* first radix-2 stage (span 2q): b and d times W_2q^k */
+                float tbr = (br * war) - (bi * wai), tbi = (bi * war) + (br * wai);
+                float tdr = (dr * war) - (di * wai), tdi = (di * war) + (dr * wai);
+                float a1r = ar + tbr, a1i = ai + tbi;
+                float b1r = ar - tbr, b1i = ai - tbi;
+                float c1r = cr + tdr, c1i = ci + tdi;
+                float d1r = cr - tdr, d1i = ci - tdi;
+
+                /* second radix-2 stage (span 4q): c1 times W_4q^k, d1 times W_4q^(k+q) = -j*W_4q^k */
+                float tcr = (c1r * wbr) - (c1i * wbi), tci = (c1i * wbr) + (c1r * wbi);
+                float ter = (d1i * wbr) + (d1r * wbi), tei = -((d1r * wbr) - (d1i * wbi));
+
+                x0[2 * k] = a1r + tcr;
+                x0[2 * k + 1] = a1i + tci;
+                x1[2 * k] = b1r + ter;
+                x1[2 * k + 1] = b1i + tei;
+                x2[2 * k] = a1r - tcr;
+                x2[2 * k + 1] = a1i - tci;
+                x3[2 * k] = b1r - ter;
+                x3[2 * k + 1] = b1i - tei;
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Decimator - Q15 - outputs of one chunk
+ *  - output n = dot product of the taps and the window starting at
+ *    window + n * step (only the outputs kept - polyphase decimation)
+ *  - multiply-add (pmaddwd) in 32/16/8 lanes (AVX-512BW/AVX2/SSE2), int32
+ *    sums (exact - same output in all levels)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(firDecimator_Q15)(const int16_t * coeffs, size_t taps, const int16_t * window, size_t step,
+                                            size_t count, int16_t * arrayOut)
+{
+    size_t n;
+
+    for (n = 0; n < count; n++, window += step)
+    {
+        int32_t acc = 0;
+        size_t k = 0;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+        if (taps >= 32)
+        {
+            __m512i sum = _mm512_setzero_si512();
+            for (; k + 32 <= taps; k += 32)
+            {
+                sum = _mm512_add_epi32(sum, _mm512_madd_epi16(_mm512_loadu_si512((const void *)&coeffs[k]),
+                                                              _mm512_loadu_si512((const void *)&window[k])));
+            }
+            acc += _mm512_reduce_add_epi32(sum);
+        }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+        if ((k + 16) <= taps)
+        {
+            __m256i sum = _mm256_setzero_si256();
+            __m128i half;
+            for (; k + 16 <= taps; k += 16)
+            {
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)&coeffs[k]),
+                                                              _mm256_loadu_si256((const __m256i *)&window[k])));
+            }
+            half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+            acc += _mm_cvtsi128_si32(half);
+        }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+        if ((k + 8) <= taps)
+        {
+            __m128i sum = _mm_setzero_si128();
+            for (; k + 8 <= taps; k += 8)
+            {
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&coeffs[k]),
+                                                        _mm_loadu_si128((const __m128i *)&window[k])));
+            }
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+            acc += _mm_cvtsi128_si32(sum);
+        }
+#endif
+        /* remaining taps (or all taps without SIMD) */
+        for (; k < taps; k++)
+        {
+            acc += (int32_t)coeffs[k] * window[k];
+        }
+
+        acc = (acc + 16384) >> 15;                              // Q30 -> Q15 with rounding
+        if (acc > INT16_MAX)
+        {
+            acc = INT16_MAX;
+        }
+        else if (acc < INT16_MIN)
+        {
+            acc = INT16_MIN;
+        }
+        arrayOut[n] = (int16_t)acc;
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Float - outputs of one chunk (direct form)
+ *  - output n = sum of taps[k] * window[n + k], k = 0 ... taps - 1
+ *  - 16/8/4 consecutive outputs per register (AVX-512/AVX/SSE), each tap
+ *    broadcast, 4 registers of outputs per loop - every output adds the
+ *    taps in the same order (same output in all levels)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(firFilter_Float)(const float * coeffs, size_t taps, const float * window, size_t count,
+                                           float * arrayOut)
+{
+    size_t n = 0;
+    size_t k;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; n + 64 <= count; n += 64)
+    {
+        const float * x = &window[n];
+        __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+        __m512 acc2 = _mm512_setzero_ps(), acc3 = _mm512_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            __m512 c = _mm512_set1_ps(coeffs[k]);
+            acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(c, _mm512_loadu_ps(&x[k])));
+            acc1 = _mm512_add_ps(acc1, _mm512_mul_ps(c, _mm512_loadu_ps(&x[k + 16])));
+            acc2 = _mm512_add_ps(acc2, _mm512_mul_ps(c, _mm512_loadu_ps(&x[k + 32])));
+            acc3 = _mm512_add_ps(acc3, _mm512_mul_ps(c, _mm512_loadu_ps(&x[k + 48])));
+        }
+        _mm512_storeu_ps(&arrayOut[n], acc0);
+        _mm512_storeu_ps(&arrayOut[n + 16], acc1);
+        _mm512_storeu_ps(&arrayOut[n + 32], acc2);
+        _mm512_storeu_ps(&arrayOut[n + 48], acc3);
+    }
+    for (; n + 32 <= count; n += 32)
+    {
+        const float * x = &window[n];
+        __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            __m512 c = _mm512_set1_ps(coeffs[k]);
+            acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(c, _mm512_loadu_ps(&x[k])));
+            acc1 = _mm512_add_ps(acc1, _mm512_mul_ps(c, _mm512_loadu_ps(&x[k + 16])));
+        }
+        _mm512_storeu_ps(&arrayOut[n], acc0);
+        _mm512_storeu_ps(&arrayOut[n + 16], acc1);
+    }
+    for (; n + 16 <= count; n += 16)
+    {
+        __m512 acc = _mm512_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            acc = _mm512_add_ps(acc, _mm512_mul_ps(_mm512_set1_ps(coeffs[k]), _mm512_loadu_ps(&window[n + k])));
+        }
+        _mm512_storeu_ps(&arrayOut[n], acc);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; n + 32 <= count; n += 32)
+    {
+        const float * x = &window[n];
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            __m256 c = _mm256_set1_ps(coeffs[k]);
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(c, _mm256_loadu_ps(&x[k])));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(c, _mm256_loadu_ps(&x[k + 8])));
+            acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(c, _mm256_loadu_ps(&x[k + 16])));
+            acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(c, _mm256_loadu_ps(&x[k + 24])));
+        }
+        _mm256_storeu_ps(&arrayOut[n], acc0);
+        _mm256_storeu_ps(&arrayOut[n + 8], acc1);
+        _mm256_storeu_ps(&arrayOut[n + 16], acc2);
+        _mm256_storeu_ps(&arrayOut[n + 24], acc3);
+    }
+    for (; n + 8 <= count; n += 8)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(coeffs[k]), _mm256_loadu_ps(&window[n + k])));
+        }
+        _mm256_storeu_ps(&arrayOut[n], acc);
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    for (; n + 16 <= count; n += 16)
+    {
+        const float * x = &window[n];
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            __m128 c = _mm_set1_ps(coeffs[k]);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(c, _mm_loadu_ps(&x[k])));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(c, _mm_loadu_ps(&x[k + 4])));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(c, _mm_loadu_ps(&x[k + 8])));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(c, _mm_loadu_ps(&x[k + 12])));
+        }
+        _mm_storeu_ps(&arrayOut[n], acc0);
+        _mm_storeu_ps(&arrayOut[n + 4], acc1);
+        _mm_storeu_ps(&arrayOut[n + 8], acc2);
+        _mm_storeu_ps(&arrayOut[n + 12], acc3);
+    }
+    for (; n + 4 <= count; n += 4)
+    {
+        __m128 acc = _mm_setzero_ps();
+        for (k = 0; k < taps; k++)
+        {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(coeffs[k]), _mm_loadu_ps(&window[n + k])));
+        }
+        _mm_storeu_ps(&arrayOut[n], acc);
+    }
+#endif
+    /* remaining outputs (or all outputs without SIMD) */
+    for (; n < count; n++)
+    {
+        float acc = 0.0f;
+        for (k = 0; k < taps; k++)
+        {
+            acc = acc + (coeffs[k] * window[n + k]);
+        }
+        arrayOut[n] = acc;
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Q15 - outputs of one chunk (direct form)
+ *  - output n = sum of taps[k] * window[n + k], k = 0 ... taps - 1
+ *  - pairs of taps broadcast, multiply-add (pmaddwd) with the window at
+ *    n (even outputs) and n + 1 (odd outputs) - 32/16/8 outputs per loop
+ *    (AVX-512BW/AVX2/SSE2), no horizontal sums, int32 sums (exact - same
+ *    output in all levels)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(firFilter_Q15)(const int16_t * coeffs, size_t taps, const int16_t * window, size_t count,
+                                         int16_t * arrayOut)
+{
+    size_t n = 0;
+    size_t k;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; n + 32 <= count; n += 32)
+    {
+        const int16_t * x = &window[n];
+        __m512i even = _mm512_setzero_si512();
+        __m512i odd = _mm512_setzero_si512();
+        __m512i rnd = _mm512_set1_epi32(16384);
+        for (k = 0; k + 2 <= taps; k += 2)
+        {
+            __m512i c = _mm512_set1_epi32((int32_t)(((uint32_t)(uint16_t)coeffs[k + 1] << 16) | (uint16_t)coeffs[k]));
+            even = _mm512_add_epi32(even, _mm512_madd_epi16(_mm512_loadu_si512((const void *)&x[k]), c));
+            odd = _mm512_add_epi32(odd, _mm512_madd_epi16(_mm512_loadu_si512((const void *)&x[k + 1]), c));
+        }
+        if (k < taps)                                           // odd number of taps - last tap alone
+        {
+            __m512i last = _mm512_loadu_si512((const void *)&x[k]);
+            even = _mm512_add_epi32(even, _mm512_madd_epi16(last, _mm512_set1_epi32((uint16_t)coeffs[k])));
+            odd = _mm512_add_epi32(odd, _mm512_madd_epi16(last, _mm512_set1_epi32((int32_t)((uint32_t)(uint16_t)coeffs[k] << 16))));
+        }
+        even = _mm512_srai_epi32(_mm512_add_epi32(even, rnd), 15);
+        odd = _mm512_srai_epi32(_mm512_add_epi32(odd, rnd), 15);
+        _mm512_storeu_si512((void *)&arrayOut[n], _mm512_packs_epi32(_mm512_unpacklo_epi32(even, odd), _mm512_unpackhi_epi32(even, odd)));
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; n + 16 <= count; n += 16)
+    {
+        const int16_t * x = &window[n];
+        __m256i even = _mm256_setzero_si256();
+        __m256i odd = _mm256_setzero_si256();
+        __m256i rnd = _mm256_set1_epi32(16384);
+        for (k = 0; k + 2 <= taps; k += 2)
+        {
+            __m256i c = _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)coeffs[k + 1] << 16) | (uint16_t)coeffs[k]));
+            even = _mm256_add_epi32(even, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)&x[k]), c));
+            odd = _mm256_add_epi32(odd, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)&x[k + 1]), c));
+        }
+        if (k < taps)
+        {
+            __m256i last = _mm256_loadu_si256((const __m256i *)&x[k]);
+            even = _mm256_add_epi32(even, _mm256_madd_epi16(last, _mm256_set1_epi32((uint16_t)coeffs[k])));
+            odd = _mm256_add_epi32(odd, _mm256_madd_epi16(last, _mm256_set1_epi32((int32_t)((uint32_t)(uint16_t)coeffs[k] << 16))));
+        }
+        /* unpack and pack in each 128 bit lane - outputs back in order */
+        even = _mm256_srai_epi32(_mm256_add_epi32(even, rnd), 15);
+        odd = _mm256_srai_epi32(_mm256_add_epi32(odd, rnd), 15);
+        _mm256_storeu_si256((__m256i *)&arrayOut[n], _mm256_packs_epi32(_mm256_unpacklo_epi32(even, odd), _mm256_unpackhi_epi32(even, odd)));
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE2)
+    for (; n + 8 <= count; n += 8)
+    {
+        const int16_t * x = &window[n];
+        __m128i even = _mm_setzero_si128();
+        __m128i odd = _mm_setzero_si128();
+        __m128i rnd = _mm_set1_epi32(16384);
+        for (k = 0; k + 2 <= taps; k += 2)
+        {
+            __m128i c = _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)coeffs[k + 1] << 16) | (uint16_t)coeffs[k]));
+            even = _mm_add_epi32(even, _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&x[k]), c));
+            odd = _mm_add_epi32(odd, _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&x[k + 1]), c));
+        }
+        if (k < taps)
+        {
+            __m128i last = _mm_loadu_si128((const __m128i *)&x[k]);
+            even = _mm_add_epi32(even, _mm_madd_epi16(last, _mm_set1_epi32((uint16_t)coeffs[k])));
+            odd = _mm_add_epi32(odd, _mm_madd_epi16(last, _mm_set1_epi32((int32_t)((uint32_t)(uint16_t)coeffs[k] << 16))));
+        }
+        even = _mm_srai_epi32(_mm_add_epi32(even, rnd), 15);
+        odd = _mm_srai_epi32(_mm_add_epi32(odd, rnd), 15);
+        _mm_storeu_si128((__m128i *)&arrayOut[n], _mm_packs_epi32(_mm_unpacklo_epi32(even, odd), _mm_unpackhi_epi32(even, odd)));
+    }
+#endif
+    /* remaining outputs (or all outputs without SIMD) */
+    for (; n < count; n++)
+    {
+        int32_t acc = 0;
+        for (k = 0; k < taps; k++)
+        {
+            acc += (int32_t)coeffs[k] * window[n + k];
+        }
+
+        acc = (acc + 16384) >> 15;                              // Q30 -> Q15 with rounding
+        if (acc > INT16_MAX)
+        {
+            acc = INT16_MAX;
+        }
+        else if (acc < INT16_MIN)
+        {
+            acc = INT16_MIN;
+        }
+        arrayOut[n] = (int16_t)acc;
+    }
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Q31 - rounding and saturation of one output (Q62 -> Q31)
+ ******************************************************************************/
+static inline int32_t DSP_SIMD_NAME(firFilter_Q31_Output)(int64_t acc)
+{
+    acc = (acc + 1073741824LL) >> 31;
+    if (acc > INT32_MAX)
+    {
+        acc = INT32_MAX;
+    }
+    else if (acc < INT32_MIN)
+    {
+        acc = INT32_MIN;
+    }
+    return (int32_t)acc;
+}
+
+
+/******************************************************************************
+ *  FIR Filter - Q31 - outputs of one chunk (direct form)
+ *  - output n = sum of taps[k] * window[n + k], k = 0 ... taps - 1
+ *  - each tap broadcast, 32x32 -> 64 bit products (pmuldq) with the even
+ *    and odd samples of the window - 16/8/4 outputs per loop
+ *    (AVX-512/AVX2/SSE4.1), int64 sums (exact - same output in all levels)
+ ******************************************************************************/
+static void DSP_SIMD_NAME(firFilter_Q31)(const int32_t * coeffs, size_t taps, const int32_t * window, size_t count,
+                                         int32_t * arrayOut)
+{
+    size_t n = 0;
+    size_t k;
+
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX512)
+    for (; n + 16 <= count; n += 16)
+    {
+        const int32_t * x = &window[n];
+        __m512i even = _mm512_setzero_si512();
+        __m512i odd = _mm512_setzero_si512();
+        int64_t lanes[2][8];
+        for (k = 0; k < taps; k++)
+        {
+            __m512i c = _mm512_set1_epi32(coeffs[k]);
+            __m512i x_k = _mm512_loadu_si512((const void *)&x[k]);
+            even = _mm512_add_epi64(even, _mm512_mul_epi32(c, x_k));
+            odd = _mm512_add_epi64(odd, _mm512_mul_epi32(c, _mm512_srli_epi64(x_k, 32)));
+        }
+        _mm512_storeu_si512((void *)lanes[0], even);
+        _mm512_storeu_si512((void *)lanes[1], odd);
+        for (k = 0; k < 8; k++)
+        {
+            arrayOut[n + (2 * k)] = DSP_SIMD_NAME(firFilter_Q31_Output)(lanes[0][k]);
+            arrayOut[n + (2 * k) + 1] = DSP_SIMD_NAME(firFilter_Q31_Output)(lanes[1][k]);
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_AVX2)
+    for (; n + 8 <= count; n += 8)
+    {
+        const int32_t * x = &window[n];
+        __m256i even = _mm256_setzero_si256();
+        __m256i odd = _mm256_setzero_si256();
+        int64_t lanes[2][4];
+        for (k = 0; k < taps; k++)
+        {
+            __m256i c = _mm256_set1_epi32(coeffs[k]);
+            __m256i x_k = _mm256_loadu_si256((const __m256i *)&x[k]);
+            even = _mm256_add_epi64(even, _mm256_mul_epi32(c, x_k));
+            odd = _mm256_add_epi64(odd, _mm256_mul_epi32(c, _mm256_srli_epi64(x_k, 32)));
+        }
+        _mm256_storeu_si256((__m256i *)lanes[0], even);
+        _mm256_storeu_si256((__m256i *)lanes[1], odd);
+        for (k = 0; k < 4; k++)
+        {
+            arrayOut[n + (2 * k)] = DSP_SIMD_NAME(firFilter_Q31_Output)(lanes[0][k]);
+            arrayOut[n + (2 * k) + 1] = DSP_SIMD_NAME(firFilter_Q31_Output)(lanes[1][k]);
+        }
+    }
+#endif
+#if (DSP_SIMD_LEVEL >= DSP_SIMD_SSE4_1)
+    for (; n + 4 <= count; n += 4)
+    {
+        const int32_t * x = &window[n];
+        __m128i even = _mm_setzero_si128();
+        __m128i odd = _mm_setzero_si128();
+        int64_t lanes[2][2];
+        for (k = 0; k < taps; k++)
+        {
+            __m128i c = _mm_set1_epi32(coeffs[k]);
+            __m128i x_k = _mm_loadu_si128((const __m128i *)&x[k]);
+            even = _mm_add_epi64(even, _mm_mul_epi32(c, x_k));
+            odd = _mm_add_epi64(odd, _mm_mul_epi32(c, _mm_srli_epi64(x_k, 32)));
+        }
+        _mm_storeu_si128((__m128i *)lanes[0], even);
+        _mm_storeu_si128((__m128i *)lanes[1], odd);
+        for (k = 0; k < 2; k++)
+        {
+            arrayOut[n + (2 * k)] = DSP_SIMD_NAME(firFilter_Q31_Output)(lanes[0][k]);
+            arrayOut[n + (2 * k) + 1] = DSP_SIMD_NAME(firFilter_Q31_Output)(lanes[1][k]);
+        }
+    }
+#endif
+    /* remaining outputs (or all outputs without SIMD) */
+    for (; n < count; n++)
+    {
+        int64_t acc = 0;
+        for (k = 0; k < taps; k++)
+        {
+            acc += (int64_t)coeffs[k] * window[n + k];
+        }
+        arrayOut[n] = DSP_SIMD_NAME(firFilter_Q31_Output)(acc);
+    }
+}
+
+
+/******************************************************************************
+ *  Table with the functions of this level (see "struct dsp_simd_kernels_")
+ ******************************************************************************/
+static const struct dsp_simd_kernels_ DSP_SIMD_NAME(dspSimd_KernelTable) =
+{
+    DSP_SIMD_LEVEL,
+    DSP_SIMD_NAME(rmsSumSquaresArray_Int16),
+    DSP_SIMD_NAME(powerMeterSums_Int16),
+    DSP_SIMD_NAME(ddsGen_Array_Float),
+    DSP_SIMD_NAME(ddsGen_Array_Q15),
+    DSP_SIMD_NAME(ddsGen_Array_Q31),
+    DSP_SIMD_NAME(iir_SinglePoleLowPass_Float_Bank_Block),
+    DSP_SIMD_NAME(iir_SinglePoleLowPass_Fixed_Bank_Block),
+    DSP_SIMD_NAME(iir_SinglePoleLowPass_Fixed_Fast_Bank_Block),
+    DSP_SIMD_NAME(iir_Biquad_Float_Bank_Block),
+    DSP_SIMD_NAME(iir_Biquad_Fixed_Bank_Block),
+    DSP_SIMD_NAME(goertzelBankFloat_Float),
+    DSP_SIMD_NAME(goertzelBankInt16_Float),
+    DSP_SIMD_NAME(fftComplex_Float),
+    DSP_SIMD_NAME(iir_FirstOrderScan_Float),
+    DSP_SIMD_NAME(firDecimator_Q15),
+    DSP_SIMD_NAME(firFilter_Float),
+    DSP_SIMD_NAME(firFilter_Q15),
+    DSP_SIMD_NAME(firFilter_Q31),
+};
+
+
+#undef      DSP_SIMD_LEVEL
+#undef      DSP_SIMD_NAME
@@ -0,0 +1,942 @@
+/******************************************************************************
+ *  DSP_and_Math - Library with useful DSP and math functions - threads
+ *  - worker pool and channel engine (see "DSP_and_Math_threads.h")
+ *
+ *  author: Haroldo Amaral - agaelema@gmail.com
+ *  v0.5 - 2026/10/16
+ ******************************************************************************
+ *  log:
+ *    v0.5      + add worker pool and channel engine (work stealing, per block barrier)
+ *              + add segmented Goertzel on the pool (long single channel arrays)
+ *              + add scan low/high pass float on the pool (segments joined by the carry)
+ ******************************************************************************/
+
+/* pthread_setaffinity_np / CPU_SET (Linux) */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define     _GNU_SOURCE
+#endif
+
+#include    "DSP_and_Math_threads.h"
+
+#include    <math.h>
+
+#if defined(DSP_MATH_THREADS)
+#include    <sched.h>
+#include    <unistd.h>
+#endif
+
+
+/******************************************************************************
+ *  Worker queue - tasks [first, last) packed in 64 bits (internal)
+ *  - the owner takes tasks from the start, other workers steal from the
+ *    end - both with compare-and-swap, no locks
+ *  - tasks of a block are known before the start (range of indices),
+ *    queues are only filled by "dspPoolRunBlock()" before waking the workers
+ ******************************************************************************/
+#if defined(DSP_MATH_THREADS)
+#define     DSP_POOL_LOAD(ptr)                  __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define     DSP_POOL_STORE(ptr, value)          __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define     DSP_POOL_CAS(ptr, expected, value)  __atomic_compare_exchange_n((ptr), (expected), (value), 0, \
+                                                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define     DSP_POOL_LOAD(ptr)                  (*(ptr))
+#define     DSP_POOL_STORE(ptr, value)          (*(ptr) = (value))
+#define     DSP_POOL_CAS(ptr, expected, value)  ((void)(expected), (*(ptr) = (value)), 1)
+#endif
+
+static inline uint64_t dspPool_Queue(size_t first, size_t last)
+{
+    return ((uint64_t)last << 32) | (uint64_t)first;
+}
+
+/* owner - first task of its queue */
+static uint_fast8_t dspPool_PopFirst(dsp_pool_worker_t * worker, size_t * task)
+{
+    uint64_t queue = DSP_POOL_LOAD(&worker->queue);
+
+    for (;;)
+    {
+        size_t first = (size_t)(queue & 0xFFFFFFFFUL);
+        size_t last = (size_t)(queue >> 32);
+
+        if (first >= last)
+        {
+            return 0;
+        }
+        if (DSP_POOL_CAS(&worker->queue, &queue, dspPool_Queue(first + 1, last)))
+        {
+            *task = first;
+            return 1;
+        }
+    }
+}
+
+/* thief - last task of other worker queue */
+static uint_fast8_t dspPool_StealLast(dsp_pool_worker_t * victim, size_t * task)
+{
+    uint64_t queue = DSP_POOL_LOAD(&victim->queue);
+
+    for (;;)
+    {
+        size_t first = (size_t)(queue & 0xFFFFFFFFUL);
+        size_t last = (size_t)(queue >> 32);
+
+        if (first >= last)
+        {
+            return 0;
+        }
+        if (DSP_POOL_CAS(&victim->queue, &queue, dspPool_Queue(first, last - 1)))
+        {
+            *task = last - 1;
+            return 1;
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  Channel engine - run one task: a batch of channels of one group (internal)
+ ******************************************************************************/
+static void dspPool_RunTask(dsp_pool_t * pool, size_t task)
+{
+    const dsp_channel_group_t * group;
+    size_t size = pool->block_size;
+    size_t g = 0;
+    size_t first, count, c, i;
+
+    while (task >= pool->group_first_task[g + 1])
+    {
+        g++;
+    }
+    group = &pool->groups[g];
+    first = (task - pool->group_first_task[g]) * pool->group_batch[g];
+    count = group->channel_count - first;
+    if (count > pool->group_batch[g])
+    {
+        count = pool->group_batch[g];
+    }
+
+    switch (group->type)
+    {
+    case DSP_CHANNEL_RMS_INT16:
+        for (c = first; c < (first + count); c++)
+        {
+            rms_int16_t * channel = (rms_int16_t *)group->channels + c;
+            const int16_t * input = (const int16_t *)group->input + (c * group->input_stride);
+            for (i = 0; i < size; i++)
+            {
+                rmsValueAddSample_Int16(channel, input[i]);
+            }
+            rmsValueCalcRmsStdMath_Int16(channel);
+            channel->acc = 0;                   // next block (rmsValue kept)
+            channel->size_counter = 0;
+        }
+        break;
+
+    case DSP_CHANNEL_HIGHPASS_FIXED:
+        for (c = first; c < (first + count); c++)
+        {
+            iir_SinglePoleHighPass_Fixed_Block((iirHighPassFixed_t *)group->channels + c,
+                                               (const int32_t *)group->input + (c * group->input_stride),
+                                               (int32_t *)group->output + (c * group->output_stride), size);
+        }
+        break;
+
+    case DSP_CHANNEL_GOERTZEL_INT16_FLOAT:
+        for (c = first; c < (first + count); c++)
+        {
+            goertzelArrayInt16_Float((goertzel_array_float_t *)group->channels + c,
+                                     (const int16_t *)group->input + (c * group->input_stride));
+        }
+        break;
+
+    case DSP_CHANNEL_CUSTOM:
+        group->process(group->context, first, count, size);
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+/******************************************************************************
+ *  Worker pool - process tasks of the block (internal)
+ *  - own queue first (channels close in memory), then steal from the
+ *    other workers until all queues are empty
+ ******************************************************************************/
+static void dspPool_Work(dsp_pool_t * pool, uint_fast16_t index)
+{
+    dsp_pool_worker_t * worker = &pool->workers[index];
+    uint_fast16_t k;
+    size_t task;
+
+    while (dspPool_PopFirst(worker, &task))
+    {
+        dspPool_RunTask(pool, task);
+    }
+    for (k = 1; k < pool->threads; k++)
+    {
+        dsp_pool_worker_t * victim = &pool->workers[(index + k) % pool->threads];
+        while (dspPool_StealLast(victim, &task))
+        {
+            dspPool_RunTask(pool, task);
+        }
+    }
+}
+
+
+#if defined(DSP_MATH_THREADS)
+/******************************************************************************
+ *  Worker pool - pin the calling thread to a core (internal)
+ *  - "index"-th core allowed to the process (Linux only)
+ ******************************************************************************/
+static void dspPool_Pin(uint_fast16_t index)
+{
+#if defined(__linux__)
+    cpu_set_t allowed, cpu;
+    int n, count, found = 0;
+
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+    {
+        return;
+    }
+    count = CPU_COUNT(&allowed);
+    if (count <= 0)
+    {
+        return;
+    }
+    index = (uint_fast16_t)(index % (uint_fast16_t)count);
+    for (n = 0; n < CPU_SETSIZE; n++)
+    {
+        if (CPU_ISSET(n, &allowed) && (found++ == (int)index))
+        {
+            CPU_ZERO(&cpu);
+            CPU_SET(n, &cpu);
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu), &cpu);
+            return;
+        }
+    }
+#else
+    (void)index;
+#endif
+}
+
+
+/******************************************************************************
+ *  Worker pool - thread of workers 1..N-1 (internal)
+ *  - sleeps until a new block (generation), works, last one wakes the caller
+ ******************************************************************************/
+static void * dspPool_Thread(void * argument)
+{
+    dsp_pool_worker_t * worker = (dsp_pool_worker_t *)argument;
+    dsp_pool_t * pool = worker->pool;
+    uint32_t seen = 0;
+
+    if (pool->pinned)
+    {
+        dspPool_Pin(worker->index);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        while ((pool->generation == seen) && (pool->stop == 0))
+        {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop)
+        {
+            break;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        dspPool_Work(pool, worker->index);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+        {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+#endif
+
+
+/******************************************************************************
+ *  Worker Pool - Number of cores available to the process
+ *
+ *  - INPUT:    N/A
+ *
+ *  - RETURN:   number of cores (1 without threads)
+ ******************************************************************************/
+uint_fast16_t dspPoolCores(void)
+{
+#if defined(DSP_MATH_THREADS) && defined(__linux__)
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+    {
+        return (uint_fast16_t)CPU_COUNT(&allowed);
+    }
+#endif
+#if defined(DSP_MATH_THREADS)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        return (cores > 0) ? (uint_fast16_t)cores : 1;
+    }
+#else
+    return 1;
+#endif
+}
+
+
+/******************************************************************************
+ *  Worker Pool - Initialize and start the workers
+ *  - threads created once (not per block), worker 0 is the calling thread
+ *    of "dspPoolRunBlock()"
+ *  - "pinCores": worker N runs only on the N-th core (also the calling
+ *    thread) - no migration, caches kept warm between blocks
+ *  - "workers" and "groupBuffer" provided by the user (no malloc)
+ *
+ *  - INPUT:    dsp_pool_t * pool                   (pointer to struct with parameters)
+ *              dsp_pool_worker_t * workers         (array with "threads" workers)
+ *              uint_fast16_t threads               (number of workers - e.g. dspPoolCores())
+ *              uint_fast8_t pinCores               (DSP_POOL_PIN or DSP_POOL_NO_PIN)
+ *              size_t * groupBuffer                (DSP_POOL_GROUP_BUFFER_SIZE(maxGroups) elements)
+ *              size_t maxGroups                    (maximum groups per block)
+ *
+ *  - RETURN:   number of workers running (0 if invalid parameters)
+ ******************************************************************************/
+uint_fast16_t dspPoolInit(dsp_pool_t * pool, dsp_pool_worker_t * workers, uint_fast16_t threads, uint_fast8_t pinCores,
+                          size_t * groupBuffer, size_t maxGroups)
+{
+    uint_fast16_t i;
+
+    if ((threads == 0) || (maxGroups == 0))
+    {
+        return 0;
+    }
+#if !defined(DSP_MATH_THREADS)
+    threads = 1;
+#endif
+
+    pool->workers = workers;
+    pool->threads = 1;
+    pool->pinned = pinCores;
+    pool->max_groups = maxGroups;
+    pool->groups = NULL;
+    pool->group_count = 0;
+    pool->block_size = 0;
+    pool->group_batch = groupBuffer;
+    pool->group_first_task = &groupBuffer[maxGroups];
+    pool->task_count = 0;
+
+    for (i = 0; i < threads; i++)
+    {
+        workers[i].queue = 0;
+        workers[i].pool = pool;
+        workers[i].index = i;
+    }
+
+#if defined(DSP_MATH_THREADS)
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->stop = 0;
+
+    for (i = 1; i < threads; i++)
+    {
+        if (pthread_create(&workers[i].thread, NULL, dspPool_Thread, &workers[i]) != 0)
+        {
+            break;                                      // run with the workers created
+        }
+        pool->threads = i + 1;
+    }
+    if (pinCores)
+    {
+        dspPool_Pin(0);                                 // after the threads (they inherit the affinity)
+    }
+#endif
+
+    return pool->threads;
+}
+
+
+/******************************************************************************
+ *  Worker Pool - Stop and join the workers
+ *
+ *  - INPUT:    dsp_pool_t * pool                   (pointer to struct with parameters)
+ *
+ *  - RETURN:   N/A
+ ******************************************************************************/
+void dspPoolDestroy(dsp_pool_t * pool)
+{
+#if defined(DSP_MATH_THREADS)
+    uint_fast16_t i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 1; i < pool->threads; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+#endif
+    pool->threads = 0;
+}
+
+
+/******************************************************************************
+ *  Channel Group - Initialize (RMS INT16)
+ *  - each block: samples added to each channel and rms calculated
+ *    (rmsValue of the block, accumulator and counter cleared by the engine)
+ *  - block size limited by the 32 bit accumulator of "rms_int16_t"
+ *
+ *  - INPUT:    dsp_channel_group_t * group         (pointer to struct with parameters)
+ *              rms_int16_t * channels              (array of "count" structs - rmsClearStruct_Int16)
+ *              size_t count                        (number of channels)
+ *              const int16_t * input               (samples, channel by channel)
+ *              size_t inputStride                  (samples between channels)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void dspChannelGroupInitRms_Int16(dsp_channel_group_t * group, rms_int16_t * channels, size_t count,
+                                  const int16_t * input, size_t inputStride)
+{
+    group->type = DSP_CHANNEL_RMS_INT16;
+    group->channels = channels;
+    group->channel_count = count;
+    group->channel_bytes = sizeof(rms_int16_t);
+    group->input = input;
+    group->input_stride = inputStride;
+    group->output = NULL;
+    group->output_stride = 0;
+    group->sample_bytes = sizeof(int16_t);
+    group->process = NULL;
+    group->context = NULL;
+}
+
+
+/******************************************************************************
+ *  Channel Group - Initialize (HIGH PASS FIXED)
+ *  - each block: "iir_SinglePoleHighPass_Fixed_Block()" of each channel
+ *
+ *  - INPUT:    dsp_channel_group_t * group         (pointer to struct with parameters)
+ *              iirHighPassFixed_t * channels       (array of "count" filters - initialized)
+ *              size_t count                        (number of channels)
+ *              const int32_t * input               (samples, channel by channel)
+ *              int32_t * output                    (filtered samples - can be equal to input)
+ *              size_t stride                       (samples between channels)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void dspChannelGroupInitHighPass_Fixed(dsp_channel_group_t * group, iirHighPassFixed_t * channels, size_t count,
+                                       const int32_t * input, int32_t * output, size_t stride)
+{
+    group->type = DSP_CHANNEL_HIGHPASS_FIXED;
+    group->channels = channels;
+    group->channel_count = count;
+    group->channel_bytes = sizeof(iirHighPassFixed_t);
+    group->input = input;
+    group->input_stride = stride;
+    group->output = output;
+    group->output_stride = stride;
+    group->sample_bytes = 2 * sizeof(int32_t);          // input and output
+    group->process = NULL;
+    group->context = NULL;
+}
+
+
+/******************************************************************************
+ *  Channel Group - Initialize (GOERTZEL ARRAY INT16)
+ *  - each block: "goertzelArrayInt16_Float()" of each channel - block
+ *    size equal to "size_array" of the channels
+ *
+ *  - INPUT:    dsp_channel_group_t * group         (pointer to struct with parameters)
+ *              goertzel_array_float_t * channels   (array of "count" structs - goertzelArrayInit_Float)
+ *              size_t count                        (number of channels)
+ *              const int16_t * input               (samples, channel by channel)
+ *              size_t inputStride                  (samples between channels)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void dspChannelGroupInitGoertzel_Float(dsp_channel_group_t * group, goertzel_array_float_t * channels, size_t count,
+                                       const int16_t * input, size_t inputStride)
+{
+    group->type = DSP_CHANNEL_GOERTZEL_INT16_FLOAT;
+    group->channels = channels;
+    group->channel_count = count;
+    group->channel_bytes = sizeof(goertzel_array_float_t);
+    group->input = input;
+    group->input_stride = inputStride;
+    group->output = NULL;
+    group->output_stride = 0;
+    group->sample_bytes = sizeof(int16_t);
+    group->process = NULL;
+    group->context = NULL;
+}
+
+
+/******************************************************************************
+ *  Channel Group - Initialize (CUSTOM)
+ *  - each block: "process(context, first, count, size)" for batches of
+ *    channels (any other function of the library, or several in sequence)
+ *  - "channelBytes" and "sampleBytes" only used to size the batches
+ *
+ *  - INPUT:    dsp_channel_group_t * group         (pointer to struct with parameters)
+ *              dsp_channel_fn process              (function - called by all workers)
+ *              void * context                      (first parameter of "process")
+ *              size_t count                        (number of channels)
+ *              size_t channelBytes                 (bytes of state of each channel)
+ *              size_t sampleBytes                  (bytes of each sample - input + output)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void dspChannelGroupInitCustom(dsp_channel_group_t * group, dsp_channel_fn process, void * context, size_t count,
+                               size_t channelBytes, size_t sampleBytes)
+{
+    group->type = DSP_CHANNEL_CUSTOM;
+    group->channels = NULL;
+    group->channel_count = count;
+    group->channel_bytes = channelBytes;
+    group->input = NULL;
+    group->input_stride = 0;
+    group->output = NULL;
+    group->output_stride = 0;
+    group->sample_bytes = sampleBytes;
+    group->process = process;
+    group->context = context;
+}
+
+
+/******************************************************************************
+ *  Worker Pool - Process one block of all channel groups
+ *  - channels split in batches (tasks) of ~DSP_POOL_BATCH_BYTES (structs +
+ *    samples in the cache), at least DSP_POOL_TASKS_PER_WORKER per worker
+ *  - tasks distributed in contiguous ranges (one queue per worker), idle
+ *    workers steal from the end of the other queues
+ *  - returns only when all channels finished the block (barrier) - the
+ *    next block (or the results) can be used without other sync
+ *
+ *  - INPUT:    dsp_pool_t * pool                   (pointer to struct with parameters)
+ *              const dsp_channel_group_t * groups  (array of groups)
+ *              size_t groupCount                   (number of groups - up to "maxGroups")
+ *              size_t blockSize                    (samples of each channel in this block)
+ *
+ *  - RETURN:   1 if ok, 0 if too many groups
+ ******************************************************************************/
+uint_fast8_t dspPoolRunBlock(dsp_pool_t * pool, const dsp_channel_group_t * groups, size_t groupCount, size_t blockSize)
+{
+    size_t g, tasks = 0;
+    uint_fast16_t w;
+
+    if ((groupCount > pool->max_groups) || (pool->threads == 0))
+    {
+        return 0;
+    }
+
+    /* batches of each group - cache-friendly size, enough tasks to balance */
+    for (g = 0; g < groupCount; g++)
+    {
+        size_t count = groups[g].channel_count;
+        size_t bytes = groups[g].channel_bytes + (blockSize * groups[g].sample_bytes);
+        size_t maxBatch = (count + ((size_t)pool->threads * DSP_POOL_TASKS_PER_WORKER) - 1) /
+                          ((size_t)pool->threads * DSP_POOL_TASKS_PER_WORKER);
+        size_t batch = DSP_POOL_BATCH_BYTES / ((bytes == 0) ? 1 : bytes);
+
+        if (batch > maxBatch)
+        {
+            batch = maxBatch;
+        }
+        if (batch == 0)
+        {
+            batch = 1;
+        }
+        pool->group_batch[g] = batch;
+        pool->group_first_task[g] = tasks;
+        tasks += (count + batch - 1) / batch;
+    }
+    pool->group_first_task[groupCount] = tasks;
+
+    pool->groups = groups;
+    pool->group_count = groupCount;
+    pool->block_size = blockSize;
+    pool->task_count = tasks;
+
+    /* one contiguous range of tasks per worker */
+    for (w = 0; w < pool->threads; w++)
+    {
+        size_t first = (tasks * w) / pool->threads;
+        size_t last = (tasks * (w + 1)) / pool->threads;
+        DSP_POOL_STORE(&pool->workers[w].queue, dspPool_Queue(first, last));
+    }
+
+#if defined(DSP_MATH_THREADS)
+    if (pool->threads > 1)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->pending = pool->threads;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+
+        dspPool_Work(pool, 0);
+
+        /* barrier - wait the other workers */
+        pthread_mutex_lock(&pool->lock);
+        pool->pending--;
+        while (pool->pending != 0)
+        {
+            pthread_cond_wait(&pool->done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+        return 1;
+    }
+#endif
+
+    dspPool_Work(pool, 0);
+    return 1;
+}
+
+
+/******************************************************************************
+ *  Segmented Goertzel - segments of one array (internal)
+ ******************************************************************************/
+struct dsp_pool_goertzel_
+{
+    const goertzel_segmented_float_t * goertzel;
+    const int16_t * input;
+    size_t size;                    // samples of the array
+    size_t segments;
+    size_t length;                  // samples per segment (last one also the remainder)
+    double (*partial)[2];           // state of each segment from zero
+};
+
+static void dspPool_GoertzelSegments(void * context, size_t first, size_t count, size_t size)
+{
+    struct dsp_pool_goertzel_ * job = (struct dsp_pool_goertzel_ *)context;
+    size_t c;
+    (void)size;
+
+    for (c = first; c < (first + count); c++)
+    {
+        size_t start = c * job->length;
+        size_t length = (c == (job->segments - 1)) ? (job->size - start) : job->length;
+        goertzelSegmentStateInt16_Float(job->goertzel, &job->input[start], length, job->partial[c]);
+    }
+}
+
+
+/******************************************************************************
+ *  Goertzel DFT - Segments on all workers (INT16 INPUT)
+ *  - very long single channel array (e.g. 10M samples, one bin): split in
+ *    segments (DSP_POOL_TASKS_PER_WORKER per worker), each worker runs the
+ *    recursion of its segments from zero state (also split in SIMD lanes)
+ *  - partial DFTs of the segments joined in order (rotation by each segment
+ *    length) - same math of "goertzelArraySegmentedInt16_Float()"
+ *    (double coefficients and state)
+ *
+ *  - INPUT:    dsp_pool_t * pool                           (pointer to struct with parameters)
+ *              goertzel_segmented_float_t * inputStruct    (goertzelSegmentedInit_Float - "size_array" samples)
+ *              const int16_t * arrayInput                  (pointer to array with input samples)
+ *
+ *  - RETURN:   N/A (result returned inside the struct)
+ ******************************************************************************/
+void dspPoolGoertzelInt16_Float(dsp_pool_t * pool, goertzel_segmented_float_t * inputStruct, const int16_t * arrayInput)
+{
+    double partial[DSP_POOL_GOERTZEL_SEGMENTS][2];
+    double state[2] = {0.0, 0.0};
+    struct dsp_pool_goertzel_ job;
+    dsp_channel_group_t group;
+    size_t segments = (size_t)pool->threads * DSP_POOL_TASKS_PER_WORKER;
+    size_t c;
+
+    if (segments > DSP_POOL_GOERTZEL_SEGMENTS)
+    {
+        segments = DSP_POOL_GOERTZEL_SEGMENTS;
+    }
+    if (segments > (inputStruct->size_array / DSP_POOL_GOERTZEL_MIN_SEGMENT))
+    {
+        segments = inputStruct->size_array / DSP_POOL_GOERTZEL_MIN_SEGMENT;
+    }
+    if ((segments <= 1) || (pool->threads <= 1) || (pool->max_groups == 0))
+    {
+        goertzelArraySegmentedInt16_Float(inputStruct, arrayInput);
+        return;
+    }
+
+    job.goertzel = inputStruct;
+    job.input = arrayInput;
+    job.size = inputStruct->size_array;
+    job.segments = segments;
+    job.length = job.size / segments;
+    job.partial = partial;
+
+    /* one task per segment (batch of one "channel") */
+    dspChannelGroupInitCustom(&group, dspPool_GoertzelSegments, &job, segments, job.length * sizeof(int16_t), 0);
+    dspPoolRunBlock(pool, &group, 1, 0);
+
+    for (c = 0; c < segments; c++)
+    {
+        size_t length = (c == (segments - 1)) ? (job.size - (c * job.length)) : job.length;
+        goertzelSegmentCombine_Float(inputStruct, state, partial[c], length);
+    }
+    goertzelSegmentResult_Float(inputStruct, state);
+}
+
+
+/******************************************************************************
+ *  Scan filters - segments of one array (internal)
+ *  - phase 0: each segment filtered from zero output (the first one from
+ *    the state of the filter) - "last" = output at the end of the segment
+ *  - phase 1: carry of the previous segments added while a^(k+1) * carry
+ *    is above the float resolution (geometric decay)
+ ******************************************************************************/
+struct dsp_pool_scan_
+{
+    uint_fast8_t phase;
+    float b0;                       // y[n] = b0 * x[n] + b1 * x[n-1] + a * y[n-1]
+    float b1;
+    float a;                        // pole (a1 or cutoff)
+    float x_init;                   // input before the array
+    float y_init;                   // output before the array
+    const float * input;
+    float * output;
+    size_t size;                    // samples of the array
+    size_t segments;
+    size_t length;                  // samples per segment (last one also the remainder)
+    float * prev_x;                 // input before each segment
+    float * last;                   // output at the end of each segment (from zero)
+    double * carry;                 // output before each segment (joined)
+};
+
+static void dspPool_ScanSegments(void * context, size_t first, size_t count, size_t size)
+{
+    struct dsp_pool_scan_ * job = (struct dsp_pool_scan_ *)context;
+    size_t c;
+    (void)size;
+
+    for (c = first; c < (first + count); c++)
+    {
+        size_t start = c * job->length;
+        size_t length = (c == (job->segments - 1)) ? (job->size - start) : job->length;
+        float y_init = (c == 0) ? job->y_init : 0.0f;
+
+        if (job->phase == 0)
+        {
+            job->last[c] = iir_FirstOrderScan_Float(job->b0, job->b1, job->a, &job->input[start], &job->output[start], length,
+                                                    job->prev_x[c], y_init);
+        }
+        else if (c > 0)
+        {
+            double power[IIR_SCAN_LOOKAHEAD];
+            double step;
+            double carry = job->carry[c];
+            double limit = fabs(carry) * 1e-9;          // below the float resolution of the outputs
+            size_t counter = 0;
+            size_t k;
+
+            power[0] = (double)job->a;
+            for (k = 1; k < IIR_SCAN_LOOKAHEAD; k++)
+            {
+                power[k] = power[k - 1] * (double)job->a;
+            }
+            step = power[IIR_SCAN_LOOKAHEAD - 1];
+
+            for (; (counter + IIR_SCAN_LOOKAHEAD) <= length; counter += IIR_SCAN_LOOKAHEAD)
+            {
+                float * out = &job->output[start + counter];
+                if (!(fabs(carry) > limit))
+                {
+                    break;
+                }
+                for (k = 0; k < IIR_SCAN_LOOKAHEAD; k++)
+                {
+                    out[k] = (float)((double)out[k] + (power[k] * carry));
+                }
+                carry *= step;
+            }
+            for (k = 0; (counter < length) && (k < IIR_SCAN_LOOKAHEAD) && (fabs(carry) > limit); counter++, k++)
+            {
+                job->output[start + counter] = (float)((double)job->output[start + counter] + (power[k] * carry));
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  Scan filters - filter an array in segments on all workers (internal)
+ ******************************************************************************/
+static void dspPool_ScanRun(dsp_pool_t * pool, struct dsp_pool_scan_ * job, float * lastY)
+{
+    float prev_x[DSP_POOL_SCAN_SEGMENTS];
+    float last[DSP_POOL_SCAN_SEGMENTS];
+    double carry[DSP_POOL_SCAN_SEGMENTS];
+    double power_length;
+    double power;
+    dsp_channel_group_t group;
+    size_t length;
+    size_t c;
+
+    job->length = job->size / job->segments;
+    job->prev_x = prev_x;
+    job->last = last;
+    job->carry = carry;
+
+    /* input before each segment (read before an in-place filter) */
+    prev_x[0] = job->x_init;
+    for (c = 1; c < job->segments; c++)
+    {
+        prev_x[c] = job->input[(c * job->length) - 1];
+    }
+
+    /* one task per segment (batch of one "channel") */
+    dspChannelGroupInitCustom(&group, dspPool_ScanSegments, job, job->segments, job->length * sizeof(float), 0);
+    job->phase = 0;
+    dspPoolRunBlock(pool, &group, 1, 0);
+
+    /* carry into each segment - a^length by squaring (double) */
+    power_length = 1.0;
+    power = (double)job->a;
+    for (length = job->length; length > 0; length >>= 1)
+    {
+        if (length & 1)
+        {
+            power_length *= power;
+        }
+        power *= power;
+    }
+    carry[0] = (double)job->y_init;
+    carry[1] = (double)last[0];
+    for (c = 2; c < job->segments; c++)
+    {
+        carry[c] = (double)last[c - 1] + (power_length * carry[c - 1]);
+    }
+
+    job->phase = 1;
+    dspPoolRunBlock(pool, &group, 1, 0);
+
+    *lastY = job->output[job->size - 1];
+}
+
+
+/******************************************************************************
+ *  Scan filters - number of segments of an array (internal)
+ *  - 0 if the array is short (scan in the calling thread)
+ ******************************************************************************/
+static size_t dspPool_ScanSegmentCount(const dsp_pool_t * pool, size_t size)
+{
+    size_t segments = (size_t)pool->threads * DSP_POOL_TASKS_PER_WORKER;
+
+    if ((size < DSP_POOL_SCAN_MIN_SIZE) || (pool->threads <= 1) || (pool->max_groups == 0))
+    {
+        return 0;
+    }
+    if (segments > DSP_POOL_SCAN_SEGMENTS)
+    {
+        segments = DSP_POOL_SCAN_SEGMENTS;
+    }
+    if (segments > (size / DSP_POOL_SCAN_MIN_SEGMENT))
+    {
+        segments = size / DSP_POOL_SCAN_MIN_SEGMENT;
+    }
+    return (segments > 1) ? segments : 0;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole Low Pass - Float - Scan on all workers
+ *  - very long array (more than DSP_POOL_SCAN_MIN_SIZE samples): segments
+ *    filtered in parallel from zero output ("iir_FirstOrderScan_Float()" -
+ *    SIMD), joined in order with a1^length and the carry added to the
+ *    start of each segment (until it decays below the float resolution)
+ *  - shorter arrays: "iir_SinglePoleLowPass_Float_Scan()" in the caller
+ *  - arrayIn and arrayOut can be the same array (in-place)
+ *  - same result of "iir_SinglePoleLowPass_Float_Block()" (float tolerance)
+ *
+ *  - INPUT:    dsp_pool_t * pool                   (pointer to struct with parameters)
+ *              iirLowPassFloat_t * inputStruct     (pointer to struct with filter parameters)
+ *              const float * arrayIn               (pointer to array with input samples)
+ *              float * arrayOut                    (pointer to array to store filtered samples)
+ *              size_t size                         (number of samples)
+ *
+ *  - RETURN:   N/A (filtered samples in arrayOut, last output in struct "y")
+ ******************************************************************************/
+void dspPoolLowPassScan_Float(dsp_pool_t * pool, iirLowPassFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size)
+{
+    struct dsp_pool_scan_ job;
+    size_t segments = dspPool_ScanSegmentCount(pool, size);
+
+    if (segments == 0)
+    {
+        iir_SinglePoleLowPass_Float_Scan(inputStruct, arrayIn, arrayOut, size);
+        return;
+    }
+
+    job.b0 = inputStruct->b0;
+    job.b1 = 0.0f;
+    job.a = inputStruct->a1;
+    job.x_init = 0.0f;
+    job.y_init = inputStruct->prev_y;
+    job.input = arrayIn;
+    job.output = arrayOut;
+    job.size = size;
+    job.segments = segments;
+    dspPool_ScanRun(pool, &job, &inputStruct->prev_y);
+    inputStruct->y = inputStruct->prev_y;
+}
+
+
+/******************************************************************************
+ *  IIR Single Pole High Pass - Float - Scan on all workers
+ *  - same segments of "dspPoolLowPassScan_Float()" (pole = cutoff), the
+ *    input before each segment saved first (in-place safe)
+ *  - shorter arrays: "iir_SinglePoleHighPass_Float_Scan()" in the caller
+ *  - same result of "iir_SinglePoleHighPass_Float_Block()" (float tolerance)
+ *
+ *  - INPUT:    dsp_pool_t * pool                   (pointer to struct with parameters)
+ *              iirHighPassFloat_t * structInput    (pointer to struct with filter parameters)
+ *              const float * arrayIn               (pointer to array with input samples)
+ *              float * arrayOut                    (pointer to array to store filtered samples)
+ *              size_t size                         (number of samples)
+ *
+ *  - RETURN:   N/A (filtered samples in arrayOut, last output in struct "y")
+ ******************************************************************************/
+void dspPoolHighPassScan_Float(dsp_pool_t * pool, iirHighPassFloat_t * structInput, const float * arrayIn, float * arrayOut, size_t size)
+{
+    struct dsp_pool_scan_ job;
+    size_t segments = dspPool_ScanSegmentCount(pool, size);
+    float last_x;
+
+    if (segments == 0)
+    {
+        iir_SinglePoleHighPass_Float_Scan(structInput, arrayIn, arrayOut, size);
+        return;
+    }
+
+    last_x = arrayIn[size - 1];                     // read before an in-place filter
+
+    job.b0 = 1.0f;
+    job.b1 = -1.0f;
+    job.a = structInput->cutoff_Freq;
+    job.x_init = structInput->prev_x;
+    job.y_init = structInput->prev_y;
+    job.input = arrayIn;
+    job.output = arrayOut;
+    job.size = size;
+    job.segments = segments;
+    dspPool_ScanRun(pool, &job, &structInput->prev_y);
+    structInput->prev_x = last_x;
+    structInput->y = structInput->prev_y;
+}
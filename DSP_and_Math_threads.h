@@ -0,0 +1,180 @@
+/******************************************************************************
+ *  DSP_and_Math - Library with useful DSP and math functions - threads
+ *  - host only (POSIX threads), separated from "DSP_and_Math.c" so MCU
+ *    builds do not depend on pthreads
+ *  - worker pool (threads created once, pinned to cores), work stealing
+ *    and a barrier at the end of each block
+ *  - channel engine: thousands of independent channels (rms, high pass,
+ *    Goertzel...) processed block by block on all cores
+ *  - compile with "DSP_and_Math.c" and link with -pthread
+ *  - define DSP_MATH_NO_THREADS to remove (single thread fallback)
+ *
+ *  author: Haroldo Amaral - agaelema@gmail.com
+ *  v0.5 - 2026/10/16
+ ******************************************************************************
+ *  log:
+ *    v0.5      + add worker pool and channel engine (work stealing, per block barrier)
+ *              + add segmented Goertzel on the pool (long single channel arrays)
+ *              + add scan low/high pass float on the pool (segments joined by the carry)
+ ******************************************************************************/
+
+#ifndef _DSP_AND_MATH_THREADS_H_
+#define _DSP_AND_MATH_THREADS_H_
+
+#include    "DSP_and_Math.h"
+
+#if !defined(DSP_MATH_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define     DSP_MATH_THREADS
+#include    <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/******************************************************************************
+ *                              DEFINES
+ ******************************************************************************/
+
+/* POOL - cache line size (workers and their queues in different lines) */
+#define     DSP_POOL_CACHE_LINE                 64
+
+/* POOL - bytes of each task (channel structs + block samples) - fits the L1/L2 cache */
+#define     DSP_POOL_BATCH_BYTES                32768
+
+/* POOL - minimum tasks per worker (balance between cores, stealing) */
+#define     DSP_POOL_TASKS_PER_WORKER           4
+
+/* POOL - number of size_t of "groupBuffer" used by "dspPoolInit()" */
+#define     DSP_POOL_GROUP_BUFFER_SIZE(groups)  ((2 * (groups)) + 1)
+
+/* POOL - pin workers to cores (dspPoolInit "pinCores") */
+#define     DSP_POOL_NO_PIN                     0
+#define     DSP_POOL_PIN                        1
+
+/* SEGMENTED GOERTZEL - maximum segments and minimum samples per segment of "dspPoolGoertzelInt16_Float()" */
+#define     DSP_POOL_GOERTZEL_SEGMENTS          256
+#define     DSP_POOL_GOERTZEL_MIN_SEGMENT       4096
+
+/* SCAN FILTERS - minimum array (threads), maximum segments and minimum samples per segment of "dspPool...Scan_Float()" */
+#define     DSP_POOL_SCAN_MIN_SIZE              262144
+#define     DSP_POOL_SCAN_SEGMENTS              256
+#define     DSP_POOL_SCAN_MIN_SEGMENT           65536
+
+/* CHANNEL GROUP - operation executed on each channel */
+#define     DSP_CHANNEL_RMS_INT16               0       // rmsValueAddSample_Int16 + rmsValueCalcRmsStdMath_Int16 (accumulator cleared)
+#define     DSP_CHANNEL_HIGHPASS_FIXED          1       // iir_SinglePoleHighPass_Fixed_Block
+#define     DSP_CHANNEL_GOERTZEL_INT16_FLOAT    2       // goertzelArrayInt16_Float
+#define     DSP_CHANNEL_CUSTOM                  3       // user function
+
+
+/******************************************************************************
+ *                  CHANNEL ENGINE STRUCTS
+ ******************************************************************************/
+/* custom channel operation - process channels "first" to "first + count - 1", "size" samples each */
+typedef void (*dsp_channel_fn)(void * context, size_t first, size_t count, size_t size);
+
+/* group of channels with the same operation - structs in an array, samples channel by channel */
+struct dsp_channel_group_
+{
+    uint_fast8_t type;              // DSP_CHANNEL_...
+    void * channels;                // array of structs (rms_int16_t, iirHighPassFixed_t...)
+    size_t channel_count;
+    size_t channel_bytes;           // size of each struct
+    const void * input;             // samples of channel "c" start at input + c * input_stride
+    size_t input_stride;            // samples between channels (>= block size)
+    void * output;                  // filtered samples (high pass) - same layout of input
+    size_t output_stride;
+    size_t sample_bytes;            // bytes of each input sample
+    dsp_channel_fn process;         // custom operation
+    void * context;                 // first parameter of "process"
+};
+/* group of channels with the same operation - structs in an array, samples channel by channel */
+typedef struct dsp_channel_group_ dsp_channel_group_t;
+
+
+/******************************************************************************
+ *                  WORKER POOL STRUCTS
+ ******************************************************************************/
+struct dsp_pool_;
+
+/* worker - thread and its queue of tasks (one cache line, no false sharing) */
+struct dsp_pool_worker_
+{
+    volatile uint64_t queue;        // tasks [first, last) - owner takes the first, thieves the last
+    struct dsp_pool_ * pool;
+    uint_fast16_t index;
+#if defined(DSP_MATH_THREADS)
+    pthread_t thread;
+#endif
+    uint8_t pad[DSP_POOL_CACHE_LINE];
+};
+/* worker - thread and its queue of tasks (one cache line, no false sharing) */
+typedef struct dsp_pool_worker_ dsp_pool_worker_t;
+
+/* pool of workers - created once, run the channel groups block by block */
+struct dsp_pool_
+{
+    dsp_pool_worker_t * workers;    // array from the user (worker 0 = calling thread)
+    uint_fast16_t threads;          // number of workers
+    uint_fast8_t pinned;            // workers pinned to cores
+    size_t max_groups;              // groups per block (size of "groupBuffer")
+    /* current block */
+    const dsp_channel_group_t * groups;
+    size_t group_count;
+    size_t block_size;
+    size_t * group_batch;           // channels per task of each group
+    size_t * group_first_task;      // first task of each group (group_count + 1)
+    size_t task_count;
+#if defined(DSP_MATH_THREADS)
+    pthread_mutex_t lock;
+    pthread_cond_t start;           // new block (or stop)
+    pthread_cond_t done;            // all workers finished the block
+    uint32_t generation;            // blocks started
+    uint_fast16_t pending;          // workers still running the block
+    uint_fast8_t stop;
+#endif
+};
+/* pool of workers - created once, run the channel groups block by block */
+typedef struct dsp_pool_ dsp_pool_t;
+
+
+/******************************************************************************
+ *                  WORKER POOL FUNCTIONS
+ ******************************************************************************/
+uint_fast16_t dspPoolInit(dsp_pool_t * pool, dsp_pool_worker_t * workers, uint_fast16_t threads, uint_fast8_t pinCores,
+                          size_t * groupBuffer, size_t maxGroups);
+void dspPoolDestroy(dsp_pool_t * pool);
+uint_fast16_t dspPoolCores(void);
+
+
+/******************************************************************************
+ *                  CHANNEL ENGINE FUNCTIONS
+ ******************************************************************************/
+void dspChannelGroupInitRms_Int16(dsp_channel_group_t * group, rms_int16_t * channels, size_t count,
+                                  const int16_t * input, size_t inputStride);
+void dspChannelGroupInitHighPass_Fixed(dsp_channel_group_t * group, iirHighPassFixed_t * channels, size_t count,
+                                       const int32_t * input, int32_t * output, size_t stride);
+void dspChannelGroupInitGoertzel_Float(dsp_channel_group_t * group, goertzel_array_float_t * channels, size_t count,
+                                       const int16_t * input, size_t inputStride);
+void dspChannelGroupInitCustom(dsp_channel_group_t * group, dsp_channel_fn process, void * context, size_t count,
+                               size_t channelBytes, size_t sampleBytes);
+
+uint_fast8_t dspPoolRunBlock(dsp_pool_t * pool, const dsp_channel_group_t * groups, size_t groupCount, size_t blockSize);
+
+
+/******************************************************************************
+ *                  PARALLEL DSP FUNCTIONS
+ ******************************************************************************/
+void dspPoolGoertzelInt16_Float(dsp_pool_t * pool, goertzel_segmented_float_t * inputStruct, const int16_t * arrayInput);
+void dspPoolLowPassScan_Float(dsp_pool_t * pool, iirLowPassFloat_t * inputStruct, const float * arrayIn, float * arrayOut, size_t size);
+void dspPoolHighPassScan_Float(dsp_pool_t * pool, iirHighPassFloat_t * structInput, const float * arrayIn, float * arrayOut, size_t size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DSP_AND_MATH_THREADS_H_ */
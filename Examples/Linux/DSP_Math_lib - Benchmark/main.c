@@ -0,0 +1,1239 @@
+/******************************************************************************
+ *  Linux (host) - DSP_and_Math benchmark
+ *  - measure ns/sample, cycles/sample and throughput (MS/s) of the library
+ *    functions for sizes from 64 to 1M samples
+ *  - results printed as a table and optionally saved as JSON (trend tracking)
+ *  - cycles from the time stamp counter (x86 only - reference cycles)
+ *
+ *  build (from this folder):
+ *      gcc -O2 -std=c99 -pthread -I../../.. main.c ../../../DSP_and_Math.c ../../../DSP_and_Math_threads.c -lm -o dsp_bench
+ *      (add -march=native to enable the SSE/AVX paths, -DDSP_MATH_INLINE for
+ *       the inline build)
+ *
+ *  usage:
+ *      ./dsp_bench [-j results.json] [-f filter] [-s max_size] [-t min_time_ms]
+ *      DSP_MATH_SIMD=avx2 ./dsp_bench      (force a SIMD level - runtime dispatch)
+ *
+ *  Author: Haroldo Amaral - agaelema@gmail.com
+ *  2026/10/16
+ ******************************************************************************/
+#define     _POSIX_C_SOURCE     199309L
+
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+#include    <time.h>
+#include    <math.h>
+#include    "DSP_and_Math.h"
+#include    "DSP_and_Math_threads.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include    <x86intrin.h>
+#define     BENCH_HAS_CYCLES    1
+#else
+#define     BENCH_HAS_CYCLES    0
+#endif
+
+/******************************************************************************
+ * Benchmark parameters
+ ******************************************************************************/
+#define     BENCH_MAX_SIZE      (1u << 20)      // 1M samples
+#define     BENCH_BLOCK         1024            // window of Goertzel / rms sample-by-sample
+#define     BENCH_CHUNK         4096            // functions limited to uint_fast16_t sizes
+#define     BENCH_CHANNELS      8               // channels of the bank versions
+#define     BENCH_STAGES        4               // biquad sections (8th order)
+#define     BENCH_BINS          8               // bins of the Goertzel bank
+#define     BENCH_FFT_SIZE      BENCH_BLOCK     // real FFT size (complex FFT: BENCH_FFT_SIZE/2 points)
+#define     BENCH_HARMONICS     32              // harmonics of the analyzer (fundamental = 16 cycles per block)
+#define     BENCH_PIPE_BLOCK    256             // samples per block of the pipeline
+#define     BENCH_RING_SIZE     1024            // samples of the SPSC ring buffer (transfers of 1/4)
+#define     BENCH_FIR_TAPS      64              // taps of the FIR decimator (D = 4, after CIC R = 16, N = 4)
+#define     BENCH_FILTER_TAPS   32              // taps of the FIR filters (direct form)
+#define     BENCH_LONG_TAPS     1024            // taps of the long FIR filter (overlap-save FFT)
+#define     BENCH_FIR_STREAM    64              // samples per call of the streaming long FIR filter (short acquisition blocks)
+#define     BENCH_POOL_BLOCK    256             // samples per channel of the channel engine (n / 256 channels)
+#define     BENCH_POOL_CHANNELS (BENCH_MAX_SIZE / BENCH_POOL_BLOCK)
+#define     BENCH_POOL_THREADS  64              // maximum workers
+#define     BENCH_REPEAT        3               // best of N measurements
+#define     BENCH_MIN_TIME_MS   10.0            // minimum time of each measurement
+
+static const size_t bench_sizes[] = {64, 1024, 16384, 262144, 1048576};
+
+/******************************************************************************
+ * Input / output buffers and structures
+ ******************************************************************************/
+static float * in_f;
+static float * out_f;
+static int16_t * in_i16;
+static int16_t * in2_i16;
+static int16_t * in_vi16;
+static int16_t * out_i16;
+static int32_t * in_i32;
+static int32_t * out_i32;
+
+static volatile float sink_f;
+static volatile int64_t sink_i;
+
+static iirHighPassFloat_t hp_float;
+static iirHighPassFixed_t hp_fixed;
+static iirHighPassFixedExtended_t hp_fixedExt;
+static iirLowPassFloat_t lp_float;
+static iirLowPassFixed_t lp_fixed;
+static iirLowPassFixedExtended_t lp_fixedExt;
+static iirLowPassFixedFast_t lp_fast;
+
+static float lpBank_b0[BENCH_CHANNELS], lpBank_a1[BENCH_CHANNELS], lpBank_y[BENCH_CHANNELS];
+static int32_t lpBank_A[BENCH_CHANNELS], lpBank_state[BENCH_CHANNELS];
+static int32_t lpBank_att[BENCH_CHANNELS], lpBank_acc[BENCH_CHANNELS];
+static iirLowPassFloatBank_t lp_floatBank;
+static iirLowPassFixedBank_t lp_fixedBank;
+static iirLowPassFixedFastBank_t lp_fastBank;
+
+static float bq_coeffs[IIR_BIQUAD_COEFFS_SIZE(BENCH_STAGES)];
+static int32_t bq_coeffsFixed[IIR_BIQUAD_COEFFS_SIZE(BENCH_STAGES)];
+static float bq_state[IIR_BIQUAD_STATE_SIZE(BENCH_STAGES)];
+static int64_t bq_stateFixed[IIR_BIQUAD_STATE_SIZE(BENCH_STAGES)];
+static float bqBank_coeffs[BENCH_CHANNELS * IIR_BIQUAD_COEFFS_SIZE(BENCH_STAGES)];
+static float bqBank_state[BENCH_CHANNELS * IIR_BIQUAD_STATE_SIZE(BENCH_STAGES)];
+static int32_t bqBank_coeffsFixed[BENCH_CHANNELS * IIR_BIQUAD_COEFFS_SIZE(BENCH_STAGES)];
+static int64_t bqBank_stateFixed[BENCH_CHANNELS * IIR_BIQUAD_STATE_SIZE(BENCH_STAGES)];
+static iirBiquadFloat_t bq_float;
+static iirBiquadFixed_t bq_fixed;
+static iirBiquadFloatBank_t bq_floatBank;
+static iirBiquadFixedBank_t bq_fixedBank;
+
+static rms_float_t rms_float;
+static rms_int16_t rms_int16;
+static float rmsSliding_buffer[BENCH_BLOCK];
+static int16_t rmsSliding_buffer16[BENCH_BLOCK];
+static rms_sliding_float_t rms_slidingFloat;
+static rms_sliding_int16_t rms_slidingInt16;
+static power_meter_int16_t power_meter;
+
+static sine_wave_parameters sine_param;
+static sine_wave_oscillator sine_osc;
+static dds_parameters dds_param;
+
+static goertzel_array_float_t gz_arrayFloat;
+static goertzel_array_fixed64_t gz_arrayFixed;
+static float gzBank_buffer[GOERTZEL_BANK_BUFFER_SIZE(BENCH_BINS)];
+static const float gzBank_bins[BENCH_BINS] = {1, 2, 3, 5, 7, 9, 11, 13};
+static goertzel_bank_float_t gz_bank;
+static goertzel_sample_float_t gz_sampleFloat;
+static goertzel_sample_fixed64_t gz_sampleFixed;
+static float gzSliding_buffer[BENCH_BLOCK];
+static int16_t gzSliding_buffer16[BENCH_BLOCK];
+static goertzel_sliding_float_t gz_slidingFloat;
+static goertzel_sliding_int16_t gz_slidingInt16;
+
+static float fft_twiddle[FFT_TWIDDLE_SIZE(BENCH_FFT_SIZE)];
+static uint32_t fft_bitrev[FFT_BITREV_SIZE(BENCH_FFT_SIZE)];
+static float fftReal_twiddle[FFT_TWIDDLE_SIZE(BENCH_FFT_SIZE)];
+static uint32_t fftReal_bitrev[FFT_BITREV_SIZE(BENCH_FFT_SIZE)];
+static fft_plan_float_t fft_plan;
+static fft_plan_float_t fft_realPlan;
+static float fft_buffer[BENCH_FFT_SIZE];
+static float fft_magnitude[(BENCH_FFT_SIZE / 2) + 1];
+static int16_t fftFixed_buffer16[BENCH_FFT_SIZE];
+static int32_t fftFixed_buffer32[BENCH_FFT_SIZE];
+static uint32_t fftFixed_magnitude[(BENCH_FFT_SIZE / 2) + 1];
+static float harmonic_buffer[HARMONIC_BUFFER_SIZE(BENCH_HARMONICS, BENCH_BLOCK)];
+static uint32_t harmonic_bitrev[HARMONIC_BITREV_SIZE(BENCH_HARMONICS, BENCH_BLOCK)];
+static harmonic_analyzer_float_t harmonic_analyzer;
+
+static iirHighPassFloat_t pipe_hp;
+static iirLowPassFloat_t pipe_lp;
+static rms_float_t pipe_rms;
+static goertzel_sample_float_t pipe_goertzel;
+static dsp_stage_float_t pipe_stages[4];
+static float pipe_block[BENCH_PIPE_BLOCK];
+static dsp_pipeline_float_t pipeline;
+
+static cic_decimator_int16_t dec_cic;
+static int16_t dec_taps[BENCH_FIR_TAPS];
+static int16_t dec_firBuffer[FIR_DECIMATOR_BUFFER_SIZE(BENCH_FIR_TAPS)];
+static fir_decimator_q15_t dec_fir;
+static decimator_int16_t decimator;
+
+static float fir_taps[BENCH_LONG_TAPS];
+static float fir_buffer[FIR_FLOAT_BUFFER_SIZE(BENCH_FILTER_TAPS)];
+static float firLong_buffer[FIR_FLOAT_BUFFER_SIZE(BENCH_LONG_TAPS)];
+static uint32_t firLong_bitrev[FIR_FLOAT_BITREV_SIZE(BENCH_LONG_TAPS)];
+static int16_t fir_taps16[BENCH_FILTER_TAPS];
+static int16_t fir_buffer16[FIR_Q15_BUFFER_SIZE(BENCH_FILTER_TAPS)];
+static int32_t fir_taps32[BENCH_FILTER_TAPS];
+static int32_t fir_buffer32[FIR_Q31_BUFFER_SIZE(BENCH_FILTER_TAPS)];
+static fir_float_t fir_float;
+static fir_float_t fir_long;
+static fir_q15_t fir_q15;
+static fir_q31_t fir_q31;
+
+static int16_t ring_buffer[BENCH_RING_SIZE];
+static dsp_ring_t ring;
+
+static rms_int16_t pool_rms[BENCH_POOL_CHANNELS];
+static iirHighPassFixed_t pool_hp[BENCH_POOL_CHANNELS];
+static goertzel_array_float_t pool_goertzel[BENCH_POOL_CHANNELS];
+static dsp_pool_worker_t pool_workers[BENCH_POOL_THREADS];
+static size_t pool_groupBuffer[DSP_POOL_GROUP_BUFFER_SIZE(3)];
+static dsp_pool_t pool;
+
+
+/******************************************************************************
+ * Benchmark functions - each one process "n" samples
+ ******************************************************************************/
+static void bench_sqrt_Int32(size_t n)
+{
+    int64_t acc = 0;
+    size_t i;
+    for (i = 0; i < n; i++) acc += sqrt_Int32(in_i32[i] & 0x7FFFFFFF);
+    sink_i = acc;
+}
+
+static void bench_isqrt32(size_t n)
+{
+    int64_t acc = 0;
+    size_t i;
+    for (i = 0; i < n; i++) acc += isqrt32((uint32_t)in_i32[i]);
+    sink_i = acc;
+}
+
+static void bench_isqrt64(size_t n)
+{
+    int64_t acc = 0;
+    size_t i;
+    for (i = 0; i < n; i++) acc += isqrt64(((uint64_t)(uint32_t)in_i32[i] << 31) | (uint32_t)i);
+    sink_i = acc;
+}
+
+static void bench_isqrt32_Q16(size_t n)
+{
+    int64_t acc = 0;
+    size_t i;
+    for (i = 0; i < n; i++) acc += isqrt32_Q16((uint32_t)in_i32[i]);
+    sink_i = acc;
+}
+
+static void bench_rmsValueArray_Float_StdMath(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i += BENCH_CHUNK)
+    {
+        size_t len = ((n - i) < BENCH_CHUNK) ? (n - i) : BENCH_CHUNK;
+        sink_f = rmsValueArray_Float_StdMath(&in_f[i], (uint_fast16_t)len, 0);
+    }
+}
+
+static void bench_rmsValueArray_Int16_StdMath(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i += BENCH_CHUNK)
+    {
+        size_t len = ((n - i) < BENCH_CHUNK) ? (n - i) : BENCH_CHUNK;
+        sink_f = rmsValueArray_Int16_StdMath(&in_i16[i], (uint_fast16_t)len, 0);
+    }
+}
+
+static void bench_rmsValueArray_Int16_Acc64(size_t n)
+{
+    sink_f = rmsValueArray_Int16_Acc64(in_i16, n, 0);
+}
+
+static void bench_rmsValueAddSample_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        rmsValueAddSample_Float(&rms_float, in_f[i]);
+        if ((i & (BENCH_BLOCK - 1)) == (BENCH_BLOCK - 1))
+        {
+            rmsValueCalcRmsStdMath_Float(&rms_float);
+        }
+    }
+    sink_f = rms_float.rmsValue;
+}
+
+static void bench_rmsValueAddSample_Int16(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        rmsValueAddSample_Int16(&rms_int16, in_i16[i]);
+        if ((i & (BENCH_BLOCK - 1)) == (BENCH_BLOCK - 1))
+        {
+            rmsValueCalcRmsStdMath_Int16(&rms_int16);
+            rms_int16.acc = 0;
+            rms_int16.size_counter = 0;
+        }
+    }
+    sink_f = rms_int16.rmsValue;
+}
+
+static void bench_rmsSlidingAddSample_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) rmsSlidingAddSample_Float(&rms_slidingFloat, in_f[i]);
+    rmsSlidingCalcRms_Float(&rms_slidingFloat);
+    sink_f = rms_slidingFloat.rmsValue;
+}
+
+static void bench_rmsSlidingAddSample_Int16(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) rmsSlidingAddSample_Int16(&rms_slidingInt16, in_i16[i]);
+    rmsSlidingCalcRms_Int16(&rms_slidingInt16);
+    sink_f = rms_slidingInt16.rmsValue;
+}
+
+static void bench_powerMeterCalc_Int16(size_t n)
+{
+    powerMeterCalc_Int16(&power_meter, in_i16, in2_i16, n);
+    sink_f = power_meter.activePower;
+}
+
+static void bench_powerMeterCalcInterleaved_Int16(size_t n)
+{
+    powerMeterCalcInterleaved_Int16(&power_meter, in_vi16, n);
+    sink_f = power_meter.activePower;
+}
+
+static void bench_sineWaveGen_Array_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i += BENCH_CHUNK)
+    {
+        size_t len = ((n - i) < BENCH_CHUNK) ? (n - i) : BENCH_CHUNK;
+        sineWaveGen_Array_Float(&out_f[i], 1.0f, 0, 100.0f, 0, (uint_fast16_t)len, WAVEGEN_CLEAN);
+    }
+}
+
+static void bench_sineWaveGen_GetSample(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) out_f[i] = sineWaveGen_GetSample(&sine_param);
+}
+
+static void bench_sineWaveGenOsc_Array_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i += BENCH_CHUNK)
+    {
+        size_t len = ((n - i) < BENCH_CHUNK) ? (n - i) : BENCH_CHUNK;
+        sineWaveGenOsc_Array_Float(&out_f[i], 1.0f, 0, 100.0f, 0, (uint_fast16_t)len, WAVEGEN_CLEAN);
+    }
+}
+
+static void bench_sineWaveGenOsc_GetSample(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) out_f[i] = sineWaveGenOsc_GetSample(&sine_osc);
+}
+
+static void bench_ddsGen_GetSample_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) out_f[i] = ddsGen_GetSample_Float(&dds_param);
+}
+
+static void bench_ddsGen_Array_Float(size_t n) { ddsGen_Array_Float(&dds_param, out_f, n); }
+static void bench_ddsGen_Array_Q15(size_t n) { ddsGen_Array_Q15(&dds_param, out_i16, n); }
+static void bench_ddsGen_Array_Q31(size_t n) { ddsGen_Array_Q31(&dds_param, out_i32, n); }
+
+static void bench_iir_SinglePoleHighPass_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleHighPass_Float(&hp_float, in_f[i]);
+        out_f[i] = hp_float.y;
+    }
+}
+
+static void bench_iir_SinglePoleHighPass_Fixed(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleHighPass_Fixed(&hp_fixed, in_i16[i]);
+        out_i32[i] = hp_fixed.y;
+    }
+}
+
+static void bench_iir_SinglePoleHighPass_FixedExtended(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleHighPass_FixedExtended(&hp_fixedExt, in_i16[i]);
+        out_i32[i] = hp_fixedExt.y;
+    }
+}
+
+static void bench_iir_SinglePoleHighPass_Float_Block(size_t n) { iir_SinglePoleHighPass_Float_Block(&hp_float, in_f, out_f, n); }
+static void bench_iir_SinglePoleHighPass_Fixed_Block(size_t n) { iir_SinglePoleHighPass_Fixed_Block(&hp_fixed, in_i32, out_i32, n); }
+static void bench_iir_SinglePoleHighPass_FixedExtended_Block(size_t n) { iir_SinglePoleHighPass_FixedExtended_Block(&hp_fixedExt, in_i32, out_i32, n); }
+
+/* scan (16 samples lookahead) and scan on the pool (threads above DSP_POOL_SCAN_MIN_SIZE samples) */
+static void bench_iir_SinglePoleHighPass_Float_Scan(size_t n) { iir_SinglePoleHighPass_Float_Scan(&hp_float, in_f, out_f, n); }
+static void bench_dspPoolHighPassScan_Float(size_t n) { dspPoolHighPassScan_Float(&pool, &hp_float, in_f, out_f, n); }
+
+static void bench_iir_SinglePoleLowPass_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleLowPass_Float(&lp_float, in_f[i]);
+        out_f[i] = lp_float.y;
+    }
+}
+
+static void bench_iir_SinglePoleLowPass_Fixed(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleLowPass_Fixed(&lp_fixed, in_i16[i]);
+        out_i32[i] = lp_fixed.y;
+    }
+}
+
+static void bench_iir_SinglePoleLowPass_FixedExtended(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleLowPass_FixedExtended(&lp_fixedExt, in_i16[i]);
+        out_i32[i] = lp_fixedExt.y;
+    }
+}
+
+static void bench_iir_SinglePoleLowPass_Fixed_Fast(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleLowPass_Fixed_Fast(&lp_fast, in_i16[i]);
+        out_i32[i] = lp_fast.y;
+    }
+}
+
+static void bench_iir_SinglePoleLowPass_Float_Block(size_t n) { iir_SinglePoleLowPass_Float_Block(&lp_float, in_f, out_f, n); }
+static void bench_iir_SinglePoleLowPass_Float_Scan(size_t n) { iir_SinglePoleLowPass_Float_Scan(&lp_float, in_f, out_f, n); }
+static void bench_dspPoolLowPassScan_Float(size_t n) { dspPoolLowPassScan_Float(&pool, &lp_float, in_f, out_f, n); }
+
+/* banks - n samples = n / channels frames */
+static void bench_iir_SinglePoleLowPass_Float_Bank_Block(size_t n) { iir_SinglePoleLowPass_Float_Bank_Block(&lp_floatBank, in_f, out_f, n / BENCH_CHANNELS); }
+static void bench_iir_SinglePoleLowPass_Fixed_Bank_Block(size_t n) { iir_SinglePoleLowPass_Fixed_Bank_Block(&lp_fixedBank, in_i32, out_i32, n / BENCH_CHANNELS); }
+static void bench_iir_SinglePoleLowPass_Fixed_Fast_Bank_Block(size_t n) { iir_SinglePoleLowPass_Fixed_Fast_Bank_Block(&lp_fastBank, in_i32, out_i32, n / BENCH_CHANNELS); }
+
+static void bench_iir_SinglePoleLowPass_Float_Bank_Frame(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_CHANNELS) <= n; i += BENCH_CHANNELS) iir_SinglePoleLowPass_Float_Bank_Frame(&lp_floatBank, &in_f[i], &out_f[i]);
+}
+
+static void bench_iir_Biquad_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_Biquad_Float(&bq_float, in_f[i]);
+        out_f[i] = bq_float.y;
+    }
+}
+
+static void bench_iir_Biquad_Fixed(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_Biquad_Fixed(&bq_fixed, in_i32[i]);
+        out_i32[i] = bq_fixed.y;
+    }
+}
+
+static void bench_iir_Biquad_Float_Block(size_t n) { iir_Biquad_Float_Block(&bq_float, in_f, out_f, n); }
+static void bench_iir_Biquad_Fixed_Block(size_t n) { iir_Biquad_Fixed_Block(&bq_fixed, in_i32, out_i32, n); }
+static void bench_iir_Biquad_Float_Bank_Block(size_t n) { iir_Biquad_Float_Bank_Block(&bq_floatBank, in_f, out_f, n / BENCH_CHANNELS); }
+static void bench_iir_Biquad_Fixed_Bank_Block(size_t n) { iir_Biquad_Fixed_Bank_Block(&bq_fixedBank, in_i32, out_i32, n / BENCH_CHANNELS); }
+
+/* Goertzel array versions - blocks of BENCH_BLOCK samples */
+static void bench_goertzelArrayFloat_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) goertzelArrayFloat_Float(&gz_arrayFloat, &in_f[i]);
+    sink_f = gz_arrayFloat.result;
+}
+
+static void bench_goertzelArrayInt16_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) goertzelArrayInt16_Float(&gz_arrayFloat, &in_i16[i]);
+    sink_f = gz_arrayFloat.result;
+}
+
+/* one window of n samples (long capture, single bin) - serial, segments (lanes) and segments on the pool */
+static void bench_goertzelLongSerial_Float(size_t n)
+{
+    goertzel_array_float_t goertzel;
+    goertzelArrayInit_Float(&goertzel, 37.0f, n);
+    goertzelArrayInt16_Float(&goertzel, in_i16);
+    sink_f = goertzel.result;
+}
+
+static void bench_goertzelArraySegmentedInt16_Float(size_t n)
+{
+    goertzel_segmented_float_t goertzel;
+    goertzelSegmentedInit_Float(&goertzel, 37.0, n);
+    goertzelArraySegmentedInt16_Float(&goertzel, in_i16);
+    sink_f = goertzel.result;
+}
+
+static void bench_dspPoolGoertzelInt16_Float(size_t n)
+{
+    goertzel_segmented_float_t goertzel;
+    goertzelSegmentedInit_Float(&goertzel, 37.0, n);
+    dspPoolGoertzelInt16_Float(&pool, &goertzel, in_i16);
+    sink_f = goertzel.result;
+}
+
+static void bench_goertzelArrayInt16_Fixed64(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) goertzelArrayInt16_Fixed64(&gz_arrayFixed, &in_i16[i]);
+    sink_f = gz_arrayFixed.result;
+}
+
+static void bench_goertzelBankFloat_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) goertzelBankFloat_Float(&gz_bank, &in_f[i]);
+    sink_f = gz_bank.result[0];
+}
+
+static void bench_goertzelBankInt16_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) goertzelBankInt16_Float(&gz_bank, &in_i16[i]);
+    sink_f = gz_bank.result[0];
+}
+
+static void bench_goertzelSampleAddFloat_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        goertzelSampleAddFloat_Float(&gz_sampleFloat, in_f[i]);
+        if ((i & (BENCH_BLOCK - 1)) == (BENCH_BLOCK - 1)) goertzelSampleCalc_Float(&gz_sampleFloat);
+    }
+    sink_f = gz_sampleFloat.result;
+}
+
+static void bench_goertzelSampleAddInt16_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        goertzelSampleAddInt16_Float(&gz_sampleFloat, in_i16[i]);
+        if ((i & (BENCH_BLOCK - 1)) == (BENCH_BLOCK - 1)) goertzelSampleCalc_Float(&gz_sampleFloat);
+    }
+    sink_f = gz_sampleFloat.result;
+}
+
+static void bench_goertzelSampleAddInt16_Fixed64(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        goertzelSampleAddInt16_Fixed64(&gz_sampleFixed, in_i16[i]);
+        if ((i & (BENCH_BLOCK - 1)) == (BENCH_BLOCK - 1)) goertzelSampleCalc_Fixed64(&gz_sampleFixed);
+    }
+    sink_f = gz_sampleFixed.result;
+}
+
+static void bench_goertzelSlidingAddFloat_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) goertzelSlidingAddFloat_Float(&gz_slidingFloat, in_f[i]);
+    goertzelSlidingCalc_Float(&gz_slidingFloat);
+    sink_f = gz_slidingFloat.result;
+}
+
+static void bench_goertzelSlidingAddInt16_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) goertzelSlidingAddInt16_Float(&gz_slidingInt16, in_i16[i]);
+    goertzelSlidingCalcInt16_Float(&gz_slidingInt16);
+    sink_f = gz_slidingInt16.result;
+}
+
+static void bench_goertzelSlidingCalc_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        goertzelSlidingAddFloat_Float(&gz_slidingFloat, in_f[i]);
+        goertzelSlidingCalc_Float(&gz_slidingFloat);            // magnitude and phase every sample
+    }
+    sink_f = gz_slidingFloat.result;
+}
+
+
+/* FFT - blocks of BENCH_FFT_SIZE samples (complex: BENCH_FFT_SIZE/2 points) */
+static void bench_fftComplex_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fft_buffer, &in_f[i], sizeof(fft_buffer));
+        fftComplex_Float(&fft_plan, fft_buffer);
+    }
+    sink_f = fft_buffer[2];
+}
+
+static void bench_fftReal_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fft_buffer, &in_f[i], sizeof(fft_buffer));
+        fftReal_Float(&fft_realPlan, fft_buffer);
+    }
+    sink_f = fft_buffer[2];
+}
+
+static void bench_fftRealInverse_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fft_buffer, &in_f[i], sizeof(fft_buffer));
+        fftRealInverse_Float(&fft_realPlan, fft_buffer);
+    }
+    sink_f = fft_buffer[2];
+}
+
+static void bench_fftRealMagnitude_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fft_buffer, &in_f[i], sizeof(fft_buffer));
+        fftReal_Float(&fft_realPlan, fft_buffer);
+        fftRealMagnitude_Float(&fft_realPlan, fft_buffer, fft_magnitude);   // all bins, same scale of Goertzel
+    }
+    sink_f = fft_magnitude[16];
+}
+
+/* fixed FFT - same blocks of the float version (int16_t/int32_t input) */
+static void bench_fftReal_Q15(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fftFixed_buffer16, &in_i16[i], sizeof(fftFixed_buffer16));
+        sink_i = fftReal_Q15(fftFixed_buffer16, BENCH_FFT_SIZE);
+    }
+}
+
+static void bench_fftReal_Q31(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fftFixed_buffer32, &in_i32[i], sizeof(fftFixed_buffer32));
+        sink_i = fftReal_Q31(fftFixed_buffer32, BENCH_FFT_SIZE);
+    }
+}
+
+static void bench_fftRealMagnitude_Q15(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_FFT_SIZE) <= n; i += BENCH_FFT_SIZE)
+    {
+        memcpy(fftFixed_buffer16, &in_i16[i], sizeof(fftFixed_buffer16));
+        uint_fast8_t exponent = fftReal_Q15(fftFixed_buffer16, BENCH_FFT_SIZE);
+        fftRealMagnitude_Q15(fftFixed_buffer16, fftFixed_magnitude, BENCH_FFT_SIZE, exponent);
+    }
+    sink_i = fftFixed_magnitude[16];
+}
+
+/* harmonic analyzer - blocks of BENCH_BLOCK samples */
+static void bench_harmonicAnalyzerFloat_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) harmonicAnalyzerFloat_Float(&harmonic_analyzer, &in_f[i]);
+    sink_f = harmonic_analyzer.thd_f;
+}
+
+static void bench_harmonicAnalyzerInt16_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; (i + BENCH_BLOCK) <= n; i += BENCH_BLOCK) harmonicAnalyzerInt16_Float(&harmonic_analyzer, &in_i16[i]);
+    sink_f = harmonic_analyzer.thd_f;
+}
+
+/* pipeline HP -> LP -> rms -> Goertzel (float output in out_f / int16 input) */
+static void bench_dspPipelineProcess_Float(size_t n)
+{
+    memcpy(out_f, in_f, n * sizeof(float));
+    dspPipelineProcess_Float(&pipeline, out_f, n);
+    rmsValueCalcRmsStdMath_Float(&pipe_rms);
+    sink_f = pipe_rms.rmsValue + pipe_goertzel.result;
+}
+
+static void bench_dspPipelineProcessInt16_Float(size_t n)
+{
+    dspPipelineProcessInt16_Float(&pipeline, in_i16, n);
+    rmsValueCalcRmsStdMath_Float(&pipe_rms);
+    sink_f = pipe_rms.rmsValue + pipe_goertzel.result;
+}
+
+/* same chain written sample by sample (reference of the pipeline) */
+static void bench_chainSampleBySample_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        iir_SinglePoleHighPass_Float(&pipe_hp, (float)in_i16[i]);
+        iir_SinglePoleLowPass_Float(&pipe_lp, pipe_hp.y);
+        rmsValueAddSample_Float(&pipe_rms, pipe_lp.y);
+        goertzelSampleAddFloat_Float(&pipe_goertzel, pipe_lp.y);
+        if (pipe_goertzel.counter >= pipe_goertzel.size_array) goertzelSampleCalc_Float(&pipe_goertzel);
+    }
+    rmsValueCalcRmsStdMath_Float(&pipe_rms);
+    sink_f = pipe_rms.rmsValue + pipe_goertzel.result;
+}
+
+/* decimation - CIC R = 16 (N = 4), FIR D = 4 (64 taps) and both (R = 64) */
+static void bench_cicDecimate_Int16(size_t n)
+{
+    size_t count = cicDecimate_Int16(&dec_cic, in_i16, out_i16, n);
+    sink_i += (count > 0) ? out_i16[count - 1] : 0;
+}
+
+static void bench_firDecimate_Q15(size_t n)
+{
+    size_t count = firDecimate_Q15(&dec_fir, in_i16, out_i16, n);
+    sink_i += (count > 0) ? out_i16[count - 1] : 0;
+}
+
+static void bench_decimatorProcess_Int16(size_t n)
+{
+    size_t count = decimatorProcess_Int16(&decimator, in_i16, out_i16, n);
+    sink_i += (count > 0) ? out_i16[count - 1] : 0;
+}
+
+/* FIR filters - 32 taps (direct form) and 1024 taps (overlap-save FFT, also in short blocks) */
+static void bench_firFilter_Float(size_t n)
+{
+    firFilter_Float(&fir_float, in_f, out_f, n);
+    sink_f = out_f[n - 1];
+}
+
+static void bench_firFilterLong_Float(size_t n)
+{
+    firFilter_Float(&fir_long, in_f, out_f, n);
+    sink_f = out_f[n - 1];
+}
+
+static void bench_firFilterLongStream_Float(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i += BENCH_FIR_STREAM)
+    {
+        size_t length = ((n - i) < BENCH_FIR_STREAM) ? (n - i) : BENCH_FIR_STREAM;
+        firFilter_Float(&fir_long, &in_f[i], &out_f[i], length);
+    }
+    sink_f = out_f[n - 1];
+}
+
+static void bench_firFilter_Q15(size_t n)
+{
+    firFilter_Q15(&fir_q15, in_i16, out_i16, n);
+    sink_i += out_i16[n - 1];
+}
+
+static void bench_firFilter_Q31(size_t n)
+{
+    firFilter_Q31(&fir_q31, in_i32, out_i32, n);
+    sink_i += out_i32[n - 1];
+}
+
+/* SPSC ring - producer and consumer in the same thread (cost of the hand-off only) */
+static void bench_ringDrain(void)
+{
+    const int16_t * span;
+    size_t count;
+    while ((count = dspRingReadSpan_Int16(&ring, &span)) != 0)
+    {
+        sink_i += span[count - 1];
+        dspRingReadRelease(&ring, count);
+    }
+}
+
+static void bench_dspRingPushSample_Int16(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        dspRingPushSample_Int16(&ring, in_i16[i]);
+        if ((i & ((BENCH_RING_SIZE / 4) - 1)) == ((BENCH_RING_SIZE / 4) - 1)) bench_ringDrain();
+    }
+    bench_ringDrain();
+}
+
+static void bench_dspRingPush_Int16(size_t n)
+{
+    size_t i, len;
+    for (i = 0; i < n; i += len)
+    {
+        len = ((n - i) < (BENCH_RING_SIZE / 4)) ? (n - i) : (BENCH_RING_SIZE / 4);
+        dspRingPush_Int16(&ring, &in_i16[i], len);
+        dspRingPop_Int16(&ring, &out_i16[i], len);
+    }
+    sink_i += out_i16[n - 1];
+}
+
+static void bench_dspRingWriteSpan_Int16(size_t n)
+{
+    size_t i = 0, j;
+    while (i < n)
+    {
+        int16_t * span;
+        size_t len = dspRingWriteSpan_Int16(&ring, &span);
+        if (len > (n - i)) len = n - i;
+        if (len > (BENCH_RING_SIZE / 4)) len = BENCH_RING_SIZE / 4;
+        for (j = 0; j < len; j++) span[j] = in_i16[i + j];
+        dspRingWriteCommit(&ring, len);
+        i += len;
+        bench_ringDrain();
+    }
+}
+
+
+/* channel engine - rms, high pass and Goertzel of n / BENCH_POOL_BLOCK channels (all cores) */
+static void bench_dspPoolRunBlock(size_t n)
+{
+    dsp_channel_group_t groups[3];
+    size_t channels = n / BENCH_POOL_BLOCK;
+    dspChannelGroupInitRms_Int16(&groups[0], pool_rms, channels, in_i16, BENCH_POOL_BLOCK);
+    dspChannelGroupInitHighPass_Fixed(&groups[1], pool_hp, channels, in_i32, out_i32, BENCH_POOL_BLOCK);
+    dspChannelGroupInitGoertzel_Float(&groups[2], pool_goertzel, channels, in_i16, BENCH_POOL_BLOCK);
+    dspPoolRunBlock(&pool, groups, 3, BENCH_POOL_BLOCK);
+    sink_f = pool_rms[0].rmsValue + pool_goertzel[channels - 1].result + (float)out_i32[n - 1];
+}
+
+/* same channels in a single thread (reference of the pool) */
+static void bench_channelsSingleThread(size_t n)
+{
+    size_t c, i, channels = n / BENCH_POOL_BLOCK;
+    for (c = 0; c < channels; c++)
+    {
+        for (i = 0; i < BENCH_POOL_BLOCK; i++) rmsValueAddSample_Int16(&pool_rms[c], in_i16[(c * BENCH_POOL_BLOCK) + i]);
+        rmsValueCalcRmsStdMath_Int16(&pool_rms[c]);
+        pool_rms[c].acc = 0;
+        pool_rms[c].size_counter = 0;
+    }
+    for (c = 0; c < channels; c++)
+    {
+        iir_SinglePoleHighPass_Fixed_Block(&pool_hp[c], &in_i32[c * BENCH_POOL_BLOCK], &out_i32[c * BENCH_POOL_BLOCK], BENCH_POOL_BLOCK);
+    }
+    for (c = 0; c < channels; c++)
+    {
+        goertzelArrayInt16_Float(&pool_goertzel[c], &in_i16[c * BENCH_POOL_BLOCK]);
+    }
+    sink_f = pool_rms[0].rmsValue + pool_goertzel[channels - 1].result + (float)out_i32[n - 1];
+}
+
+/******************************************************************************
+ * List of benchmarks
+ ******************************************************************************/
+struct bench_item_
+{
+    const char * name;
+    const char * group;
+    void (*run)(size_t n);
+    size_t min_size;                                        // smaller sizes are skipped
+};
+
+#define     BENCH(group, name)          { #name, group, bench_##name, 0 }
+#define     BENCH_MIN(group, name, min) { #name, group, bench_##name, min }
+
+static const struct bench_item_ bench_list[] =
+{
+    BENCH("sqrt", sqrt_Int32),
+    BENCH("sqrt", isqrt32),
+    BENCH("sqrt", isqrt64),
+    BENCH("sqrt", isqrt32_Q16),
+    BENCH("rms", rmsValueArray_Float_StdMath),
+    BENCH("rms", rmsValueArray_Int16_StdMath),
+    BENCH("rms", rmsValueArray_Int16_Acc64),
+    BENCH("rms", rmsValueAddSample_Float),
+    BENCH("rms", rmsValueAddSample_Int16),
+    BENCH("rms", rmsSlidingAddSample_Float),
+    BENCH("rms", rmsSlidingAddSample_Int16),
+    BENCH("power", powerMeterCalc_Int16),
+    BENCH("power", powerMeterCalcInterleaved_Int16),
+    BENCH("sine", sineWaveGen_Array_Float),
+    BENCH("sine", sineWaveGen_GetSample),
+    BENCH("sine", sineWaveGenOsc_Array_Float),
+    BENCH("sine", sineWaveGenOsc_GetSample),
+    BENCH("sine", ddsGen_GetSample_Float),
+    BENCH("sine", ddsGen_Array_Float),
+    BENCH("sine", ddsGen_Array_Q15),
+    BENCH("sine", ddsGen_Array_Q31),
+    BENCH("highpass", iir_SinglePoleHighPass_Float),
+    BENCH("highpass", iir_SinglePoleHighPass_Fixed),
+    BENCH("highpass", iir_SinglePoleHighPass_FixedExtended),
+    BENCH("highpass", iir_SinglePoleHighPass_Float_Block),
+    BENCH("highpass", iir_SinglePoleHighPass_Fixed_Block),
+    BENCH("highpass", iir_SinglePoleHighPass_FixedExtended_Block),
+    BENCH("highpass", iir_SinglePoleHighPass_Float_Scan),
+    BENCH("highpass", dspPoolHighPassScan_Float),
+    BENCH("lowpass", iir_SinglePoleLowPass_Float),
+    BENCH("lowpass", iir_SinglePoleLowPass_Fixed),
+    BENCH("lowpass", iir_SinglePoleLowPass_FixedExtended),
+    BENCH("lowpass", iir_SinglePoleLowPass_Fixed_Fast),
+    BENCH("lowpass", iir_SinglePoleLowPass_Float_Block),
+    BENCH("lowpass", iir_SinglePoleLowPass_Float_Scan),
+    BENCH("lowpass", dspPoolLowPassScan_Float),
+    BENCH("lowpass", iir_SinglePoleLowPass_Float_Bank_Block),
+    BENCH("lowpass", iir_SinglePoleLowPass_Float_Bank_Frame),
+    BENCH("lowpass", iir_SinglePoleLowPass_Fixed_Bank_Block),
+    BENCH("lowpass", iir_SinglePoleLowPass_Fixed_Fast_Bank_Block),
+    BENCH("biquad", iir_Biquad_Float),
+    BENCH("biquad", iir_Biquad_Fixed),
+    BENCH("biquad", iir_Biquad_Float_Block),
+    BENCH("biquad", iir_Biquad_Fixed_Block),
+    BENCH("biquad", iir_Biquad_Float_Bank_Block),
+    BENCH("biquad", iir_Biquad_Fixed_Bank_Block),
+    BENCH_MIN("goertzel", goertzelArrayFloat_Float, BENCH_BLOCK),
+    BENCH_MIN("goertzel", goertzelArrayInt16_Float, BENCH_BLOCK),
+    BENCH_MIN("goertzel", goertzelArrayInt16_Fixed64, BENCH_BLOCK),
+    BENCH_MIN("goertzel", goertzelBankFloat_Float, BENCH_BLOCK),
+    BENCH_MIN("goertzel", goertzelBankInt16_Float, BENCH_BLOCK),
+    BENCH("goertzel", goertzelLongSerial_Float),
+    BENCH("goertzel", goertzelArraySegmentedInt16_Float),
+    BENCH("goertzel", dspPoolGoertzelInt16_Float),
+    BENCH("goertzel", goertzelSampleAddFloat_Float),
+    BENCH("goertzel", goertzelSampleAddInt16_Float),
+    BENCH("goertzel", goertzelSampleAddInt16_Fixed64),
+    BENCH("goertzel", goertzelSlidingAddFloat_Float),
+    BENCH("goertzel", goertzelSlidingAddInt16_Float),
+    BENCH("goertzel", goertzelSlidingCalc_Float),
+    BENCH_MIN("fft", fftComplex_Float, BENCH_FFT_SIZE),
+    BENCH_MIN("fft", fftReal_Float, BENCH_FFT_SIZE),
+    BENCH_MIN("fft", fftRealInverse_Float, BENCH_FFT_SIZE),
+    BENCH_MIN("fft", fftRealMagnitude_Float, BENCH_FFT_SIZE),
+    BENCH_MIN("fft", fftReal_Q15, BENCH_FFT_SIZE),
+    BENCH_MIN("fft", fftReal_Q31, BENCH_FFT_SIZE),
+    BENCH_MIN("fft", fftRealMagnitude_Q15, BENCH_FFT_SIZE),
+    BENCH_MIN("harmonic", harmonicAnalyzerFloat_Float, BENCH_BLOCK),
+    BENCH_MIN("harmonic", harmonicAnalyzerInt16_Float, BENCH_BLOCK),
+    BENCH("pipeline", dspPipelineProcess_Float),
+    BENCH("pipeline", dspPipelineProcessInt16_Float),
+    BENCH("pipeline", chainSampleBySample_Float),
+    BENCH("decimation", cicDecimate_Int16),
+    BENCH("decimation", firDecimate_Q15),
+    BENCH("decimation", decimatorProcess_Int16),
+    BENCH("fir", firFilter_Float),
+    BENCH("fir", firFilterLong_Float),
+    BENCH("fir", firFilterLongStream_Float),
+    BENCH("fir", firFilter_Q15),
+    BENCH("fir", firFilter_Q31),
+    BENCH("ring", dspRingPushSample_Int16),
+    BENCH("ring", dspRingPush_Int16),
+    BENCH("ring", dspRingWriteSpan_Int16),
+    BENCH_MIN("pool", dspPoolRunBlock, BENCH_POOL_BLOCK),
+    BENCH_MIN("pool", channelsSingleThread, BENCH_POOL_BLOCK),
+};
+
+
+/******************************************************************************
+ * Setup - input signals and structures
+ ******************************************************************************/
+static void bench_Setup(void)
+{
+    size_t i;
+    uint32_t seed = 12345;
+
+    in_f = malloc(BENCH_MAX_SIZE * sizeof(float));
+    out_f = malloc(BENCH_MAX_SIZE * sizeof(float));
+    in_i16 = malloc(BENCH_MAX_SIZE * sizeof(int16_t));
+    in2_i16 = malloc(BENCH_MAX_SIZE * sizeof(int16_t));
+    in_vi16 = malloc(2 * BENCH_MAX_SIZE * sizeof(int16_t));
+    out_i16 = malloc(BENCH_MAX_SIZE * sizeof(int16_t));
+    in_i32 = malloc(BENCH_MAX_SIZE * sizeof(int32_t));
+    out_i32 = malloc(BENCH_MAX_SIZE * sizeof(int32_t));
+    if (!in_f || !out_f || !in_i16 || !in2_i16 || !in_vi16 || !out_i16 || !in_i32 || !out_i32)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    /* 50 Hz like wave (64 points per cycle), 3rd harmonic and noise */
+    for (i = 0; i < BENCH_MAX_SIZE; i++)
+    {
+        float x = TWO_PI * (float)(i % 64) / 64.0f;
+        seed = (seed * 1664525u) + 1013904223u;
+        float noise = (float)(int32_t)(seed >> 20) / 2048.0f - 1.0f;
+
+        in_f[i] = (0.8f * sinf(x)) + (0.1f * sinf(3 * x)) + (0.01f * noise) + 0.05f;
+        in_i16[i] = (int16_t)(in_f[i] * 30000.0f);
+        in2_i16[i] = (int16_t)(20000.0f * sinf(x - 0.5f));
+        in_vi16[2 * i] = in_i16[i];
+        in_vi16[(2 * i) + 1] = in2_i16[i];
+        in_i32[i] = (int32_t)in_i16[i] << 8;
+    }
+
+    iir_SinglePoleHighPass_Float_Init(&hp_float, 0.005f, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleHighPass_Fixed_Init(&hp_fixed, 0.005f, 15, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleHighPass_FixedExtended_Init(&hp_fixedExt, 0.005, 24, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Float_Init(&lp_float, 0.01f, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Fixed_Init(&lp_fixed, 0.01f, 10, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_FixedExtended_Init(&lp_fixedExt, 0.01, 20, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Fixed_Fast_Init(&lp_fast, 5, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Float_Bank_Init(&lp_floatBank, lpBank_b0, lpBank_a1, lpBank_y, BENCH_CHANNELS, 0.01f, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Fixed_Bank_Init(&lp_fixedBank, lpBank_A, lpBank_state, BENCH_CHANNELS, 0.01f, 10, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Fixed_Fast_Bank_Init(&lp_fastBank, lpBank_att, lpBank_acc, BENCH_CHANNELS, 5, IIR_FILTER_DO_CLEAN);
+
+    for (i = 0; i < BENCH_STAGES; i++)
+    {
+        iir_Biquad_Design_LowPass(&bq_coeffs[5 * i], 0.1f, 0.7071f);
+    }
+    iir_Biquad_Coeffs_ToFixed(bq_coeffs, bq_coeffsFixed, BENCH_STAGES, 1);
+    iir_Biquad_Float_Init(&bq_float, bq_coeffs, bq_state, BENCH_STAGES, IIR_FILTER_DO_CLEAN);
+    iir_Biquad_Fixed_Init(&bq_fixed, bq_coeffsFixed, bq_stateFixed, BENCH_STAGES, 1, IIR_FILTER_DO_CLEAN);
+    iir_Biquad_Float_Bank_Init(&bq_floatBank, bqBank_coeffs, bqBank_state, BENCH_CHANNELS, BENCH_STAGES, bq_coeffs, IIR_FILTER_DO_CLEAN);
+    iir_Biquad_Fixed_Bank_Init(&bq_fixedBank, bqBank_coeffsFixed, bqBank_stateFixed, BENCH_CHANNELS, BENCH_STAGES, 1, bq_coeffsFixed, IIR_FILTER_DO_CLEAN);
+
+    rmsClearStruct_Float(&rms_float);
+    rmsClearStruct_Int16(&rms_int16);
+    rmsSlidingInit_Float(&rms_slidingFloat, rmsSliding_buffer, BENCH_BLOCK);
+    rmsSlidingInit_Int16(&rms_slidingInt16, rmsSliding_buffer16, BENCH_BLOCK);
+    powerMeterInit_Int16(&power_meter, 0, 0, 1);
+
+    sineWaveGen_bySample_Init(&sine_param, 1.0f, 0, 100.0f, 0, 64, WAVEGEN_CLEAN);
+    sineWaveGenOsc_bySample_Init(&sine_osc, 1.0f, 0, 100.0f, 0, 64, WAVEGEN_CLEAN);
+    ddsGen_Init(&dds_param, 1.0f, 0, 1.0f, 0, 64, DDS_INTERP_LINEAR, WAVEGEN_CLEAN);
+
+    goertzelArrayInit_Float(&gz_arrayFloat, 16, BENCH_BLOCK);
+    goertzelArrayInit_Fixed64(&gz_arrayFixed, 16, BENCH_BLOCK, 10);
+    goertzelBankInit_Float(&gz_bank, gzBank_buffer, gzBank_bins, BENCH_BINS, BENCH_BLOCK);
+    goertzelSampleInit_Float(&gz_sampleFloat, 16, BENCH_BLOCK);
+    goertzelSampleInit_Fixed64(&gz_sampleFixed, 16, BENCH_BLOCK, 10);
+    goertzelSlidingInit_Float(&gz_slidingFloat, gzSliding_buffer, 16, BENCH_BLOCK);
+    goertzelSlidingInit_Int16(&gz_slidingInt16, gzSliding_buffer16, 16, BENCH_BLOCK);
+
+    fftPlanInit_Float(&fft_plan, fft_twiddle, fft_bitrev, BENCH_FFT_SIZE / 2);
+    fftRealPlanInit_Float(&fft_realPlan, fftReal_twiddle, fftReal_bitrev, BENCH_FFT_SIZE);
+    harmonicAnalyzerInit_Float(&harmonic_analyzer, harmonic_buffer, harmonic_bitrev, 16, BENCH_HARMONICS, BENCH_BLOCK);
+
+    iir_SinglePoleHighPass_Float_Init(&pipe_hp, 0.005f, IIR_FILTER_DO_CLEAN);
+    iir_SinglePoleLowPass_Float_Init(&pipe_lp, 0.2f, IIR_FILTER_DO_CLEAN);
+    rmsClearStruct_Float(&pipe_rms);
+    goertzelSampleInit_Float(&pipe_goertzel, 16, BENCH_BLOCK);
+    dspPipelineInit_Float(&pipeline, pipe_stages, 4, pipe_block, BENCH_PIPE_BLOCK);
+    dspPipelineAddHighPass_Float(&pipeline, &pipe_hp);
+    dspPipelineAddLowPass_Float(&pipeline, &pipe_lp);
+    dspPipelineAddRms_Float(&pipeline, &pipe_rms);
+    dspPipelineAddGoertzel_Float(&pipeline, &pipe_goertzel);
+
+    cicDecimatorInit_Int16(&dec_cic, 4, 16);
+    firDesignLowPass_Q15(dec_taps, BENCH_FIR_TAPS, 0.8f / 4);
+    firDecimatorInit_Q15(&dec_fir, dec_firBuffer, dec_taps, BENCH_FIR_TAPS, 4);
+    decimatorInit_Int16(&decimator, &dec_cic);
+    decimatorAddFir_Q15(&decimator, &dec_fir);
+
+    firDesignLowPass_Q15(fir_taps16, BENCH_FILTER_TAPS, 0.25f);
+    for (i = 0; i < BENCH_FILTER_TAPS; i++)
+    {
+        fir_taps[i] = fir_taps16[i] / 32768.0f;
+        fir_taps32[i] = (int32_t)fir_taps16[i] << 16;
+    }
+    firFilterInit_Float(&fir_float, fir_buffer, NULL, fir_taps, BENCH_FILTER_TAPS);
+    firFilterInit_Q15(&fir_q15, fir_buffer16, fir_taps16, BENCH_FILTER_TAPS);
+    firFilterInit_Q31(&fir_q31, fir_buffer32, fir_taps32, BENCH_FILTER_TAPS);
+    for (i = 0; i < BENCH_LONG_TAPS; i++)
+    {
+        fir_taps[i] = 0.01f * expf(-(float)i / 200.0f) * cosf(0.05f * (float)i);     // long decaying response (equalizer like)
+    }
+    firFilterInit_Float(&fir_long, firLong_buffer, firLong_bitrev, fir_taps, BENCH_LONG_TAPS);
+
+    dspRingInit_Int16(&ring, ring_buffer, BENCH_RING_SIZE);
+
+    for (i = 0; i < BENCH_POOL_CHANNELS; i++)
+    {
+        rmsClearStruct_Int16(&pool_rms[i]);
+        iir_SinglePoleHighPass_Fixed_Init(&pool_hp[i], 0.005f, 12, IIR_FILTER_DO_CLEAN);
+        goertzelArrayInit_Float(&pool_goertzel[i], (float)(1 + (i % 64)), BENCH_POOL_BLOCK);
+    }
+    dspPoolInit(&pool, pool_workers, (dspPoolCores() < BENCH_POOL_THREADS) ? dspPoolCores() : BENCH_POOL_THREADS,
+                DSP_POOL_PIN, pool_groupBuffer, 3);
+}
+
+
+/******************************************************************************
+ * Timing
+ ******************************************************************************/
+static double bench_TimeNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static uint64_t bench_Cycles(void)
+{
+#if BENCH_HAS_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* best of BENCH_REPEAT measurements, each one running at least "min_time_ms" */
+static void bench_Measure(const struct bench_item_ * item, size_t size, double min_time_ms,
+                          double * ns_per_sample, double * cycles_per_sample)
+{
+    size_t loops = 1;
+    size_t loop;
+    int repeat;
+    double best_ns = 0;
+    double best_cycles = 0;
+
+    item->run(size);                                        // warm-up (cache and branch predictor)
+
+    /* calibrate number of loops */
+    for (;;)
+    {
+        double t0 = bench_TimeNs();
+        for (loop = 0; loop < loops; loop++) item->run(size);
+        if ((bench_TimeNs() - t0) >= (min_time_ms * 1e6)) break;
+        loops *= 2;
+    }
+
+    for (repeat = 0; repeat < BENCH_REPEAT; repeat++)
+    {
+        double t0 = bench_TimeNs();
+        uint64_t c0 = bench_Cycles();
+        for (loop = 0; loop < loops; loop++) item->run(size);
+        uint64_t c1 = bench_Cycles();
+        double t1 = bench_TimeNs();
+
+        double ns = (t1 - t0) / ((double)loops * (double)size);
+        double cycles = (double)(c1 - c0) / ((double)loops * (double)size);
+        if ((repeat == 0) || (ns < best_ns))
+        {
+            best_ns = ns;
+            best_cycles = cycles;
+        }
+    }
+
+    *ns_per_sample = best_ns;
+    *cycles_per_sample = best_cycles;
+}
+
+
+/******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(int argc, char * argv[])
+{
+    const char * json_file = NULL;
+    const char * filter = NULL;
+    size_t max_size = BENCH_MAX_SIZE;
+    double min_time_ms = BENCH_MIN_TIME_MS;
+    FILE * json = NULL;
+    size_t item, size_index;
+    int first = 1;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (!strcmp(argv[arg], "-j") && (arg + 1 < argc)) json_file = argv[++arg];
+        else if (!strcmp(argv[arg], "-f") && (arg + 1 < argc)) filter = argv[++arg];
+        else if (!strcmp(argv[arg], "-s") && (arg + 1 < argc)) max_size = (size_t)strtoul(argv[++arg], NULL, 0);
+        else if (!strcmp(argv[arg], "-t") && (arg + 1 < argc)) min_time_ms = strtod(argv[++arg], NULL);
+        else
+        {
+            printf("usage: %s [-j results.json] [-f filter] [-s max_size] [-t min_time_ms]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench_Setup();
+
+    if (json_file)
+    {
+        json = fopen(json_file, "w");
+        if (!json)
+        {
+            perror(json_file);
+            return 1;
+        }
+        fprintf(json, "{\n  \"benchmark\": \"DSP_and_Math\",\n  \"version\": \"0.5\",\n");
+#if defined(__VERSION__)
+        fprintf(json, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+        fprintf(json, "  \"simd\": \"%s\",\n", dspSimd_LevelName(dspSimd_GetLevel()));
+        fprintf(json, "  \"inline_build\": %s,\n",
+#if defined(DSP_MATH_INLINE)
+                "true"
+#else
+                "false"
+#endif
+               );
+        fprintf(json, "  \"results\": [");
+    }
+
+    printf("SIMD level: %s (force with DSP_MATH_SIMD=scalar|sse2|sse4.1|avx2|avx512)\n", dspSimd_LevelName(dspSimd_GetLevel()));
+    printf("%-46s %9s %12s %14s %10s\n", "function", "size", "ns/sample", "cycles/sample", "MS/s");
+    for (item = 0; item < (sizeof(bench_list) / sizeof(bench_list[0])); item++)
+    {
+        if (filter && !strstr(bench_list[item].name, filter) && strcmp(bench_list[item].group, filter))
+        {
+            continue;
+        }
+
+        for (size_index = 0; size_index < (sizeof(bench_sizes) / sizeof(bench_sizes[0])); size_index++)
+        {
+            size_t size = bench_sizes[size_index];
+            double ns, cycles;
+
+            if (size > max_size)
+            {
+                break;
+            }
+            if (size < bench_list[item].min_size)
+            {
+                continue;
+            }
+
+            bench_Measure(&bench_list[item], size, min_time_ms, &ns, &cycles);
+            printf("%-46s %9zu %12.3f %14.3f %10.1f\n", bench_list[item].name, size, ns, cycles, 1e3 / ns);
+            fflush(stdout);
+
+            if (json)
+            {
+                fprintf(json, "%s\n    {\"name\": \"%s\", \"group\": \"%s\", \"size\": %zu, "
+                              "\"ns_per_sample\": %.4f, \"cycles_per_sample\": ",
+                        first ? "" : ",", bench_list[item].name, bench_list[item].group, size, ns);
+                if (BENCH_HAS_CYCLES) fprintf(json, "%.4f", cycles);
+                else fprintf(json, "null");
+                fprintf(json, ", \"msps\": %.3f}", 1e3 / ns);
+                first = 0;
+            }
+        }
+    }
+
+    if (json)
+    {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+    }
+
+    dspPoolDestroy(&pool);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ *  Linux (host) - DSP_and_Math accuracy tests
+ *  - compare the library functions with a double precision reference and
+ *    print the error of each case
+ *  - exit code 0 if all cases are inside the tolerance, 1 otherwise
+ *
+ *  build (from this folder):
+ *      gcc -O2 -std=c99 -pthread -I../../.. main.c ../../../DSP_and_Math.c ../../../DSP_and_Math_threads.c -lm -o dsp_tests
+ *
+ *  usage:
+ *      ./dsp_tests
+ *      DSP_MATH_SIMD=sse2 ./dsp_tests      (force a SIMD level - runtime dispatch)
+ *
+ *  Author: Haroldo Amaral - agaelema@gmail.com
+ *  2026/10/17
+ ******************************************************************************/
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <math.h>
+#include    "DSP_and_Math.h"
+#include    "DSP_and_Math_threads.h"
+
+/******************************************************************************
+ * Test parameters
+ ******************************************************************************/
+#define     TEST_MAX_SIZE           10000000        // longest Goertzel array (10M samples)
+#define     TEST_AMPLITUDE          1000.0          // amplitude of the tone
+#define     TEST_GOERTZEL_TOL       1e-6            // relative error of the segmented Goertzel
+#define     TEST_POOL_THREADS       4
+
+static const size_t test_sizes[] = {4096, 65536, 262144, 1048576, 4194304, TEST_MAX_SIZE};
+static const double test_bins[] = {1.0, 37.0, 1000.0};
+
+static int16_t * signal;
+static dsp_pool_worker_t pool_workers[TEST_POOL_THREADS];
+static size_t pool_groupBuffer[DSP_POOL_GROUP_BUFFER_SIZE(1)];
+static dsp_pool_t pool;
+
+
+/******************************************************************************
+ * Reference - magnitude of one bin (2*|X|/N) by the DFT sum in double
+ ******************************************************************************/
+static double test_DftMagnitude(const int16_t * input, size_t size, double bin)
+{
+    double w = (2.0 * 3.14159265358979323846 * bin) / (double)size;
+    double re = 0.0, im = 0.0;
+    size_t n;
+
+    for (n = 0; n < size; n++)
+    {
+        double angle = w * (double)n;
+        re += input[n] * cos(angle);
+        im -= input[n] * sin(angle);
+    }
+    return (2.0 * sqrt((re * re) + (im * im))) / (double)size;
+}
+
+
+/******************************************************************************
+ * Segmented Goertzel (lanes and pool) against the DFT - sweep of sizes
+ ******************************************************************************/
+static int test_GoertzelSegmented(void)
+{
+    int failures = 0;
+    size_t s, b, n;
+
+    printf("%-10s %8s %12s %12s %12s %12s %10s\n", "size", "bin", "reference", "serial", "segmented", "pool", "rel.err");
+    for (s = 0; s < (sizeof(test_sizes) / sizeof(test_sizes[0])); s++)
+    {
+        size_t size = test_sizes[s];
+
+        for (b = 0; b < (sizeof(test_bins) / sizeof(test_bins[0])); b++)
+        {
+            double bin = test_bins[b];
+            double w = (2.0 * 3.14159265358979323846 * bin) / (double)size;
+            goertzel_array_float_t serial;
+            goertzel_segmented_float_t segmented, pooled;
+            double reference, error, error_pool;
+
+            /* tone at the bin, phase 0.3 rad, small noise (rounded to int16) */
+            for (n = 0; n < size; n++)
+            {
+                signal[n] = (int16_t)lrint((TEST_AMPLITUDE * cos((w * (double)n) + 0.3)) + (double)((int)(n % 7) - 3));
+            }
+            reference = test_DftMagnitude(signal, size, bin);
+
+            goertzelArrayInit_Float(&serial, (float)bin, size);
+            goertzelArrayInt16_Float(&serial, signal);
+            goertzelSegmentedInit_Float(&segmented, bin, size);
+            goertzelArraySegmentedInt16_Float(&segmented, signal);
+            goertzelSegmentedInit_Float(&pooled, bin, size);
+            dspPoolGoertzelInt16_Float(&pool, &pooled, signal);
+
+            error = fabs(segmented.result - reference) / reference;
+            error_pool = fabs(pooled.result - reference) / reference;
+            printf("%-10zu %8.1f %12.4f %12.4f %12.4f %12.4f %10.2e%s\n", size, bin, reference, serial.result,
+                   segmented.result, pooled.result, (error > error_pool) ? error : error_pool,
+                   ((error > TEST_GOERTZEL_TOL) || (error_pool > TEST_GOERTZEL_TOL)) ? "  FAIL" : "");
+            if ((error > TEST_GOERTZEL_TOL) || (error_pool > TEST_GOERTZEL_TOL))
+            {
+                failures++;
+            }
+        }
+    }
+    printf("(serial: goertzelArrayInt16_Float - float, for comparison only)\n\n");
+    return failures;
+}
+
+
+/******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void)
+{
+    int failures = 0;
+
+    signal = malloc(TEST_MAX_SIZE * sizeof(int16_t));
+    if (!signal)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    dspPoolInit(&pool, pool_workers, TEST_POOL_THREADS, DSP_POOL_NO_PIN, pool_groupBuffer, 1);
+
+    printf("SIMD level: %s\n\n", dspSimd_LevelName(dspSimd_GetLevel()));
+    failures += test_GoertzelSegmented();
+
+    dspPoolDestroy(&pool);
+    free(signal);
+    printf("%s (%d failures)\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}